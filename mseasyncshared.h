@@ -18,6 +18,8 @@
 #include <shared_mutex>
 #include <thread>
 #include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include <unordered_map>
 #include <cassert>
 #include <stdexcept>
@@ -27,6 +29,18 @@
 #include <vector>
 #include <future>
 #include <map>
+#include <deque>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#ifdef MSE_HAS_CXX20
+#ifdef __has_include
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine)
+#include <coroutine>
+#define MSE_HAS_COROUTINES
+#endif /*__has_include(<coroutine>) && defined(__cpp_impl_coroutine)*/
+#endif /*__has_include*/
+#endif /*MSE_HAS_CXX20*/
 
 #if defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)
 #define MSE_ASYNCSHAREDPOINTER_DISABLED
@@ -97,9 +111,30 @@ namespace mse {
 		_Ty& m_mutex_ref;
 	};
 
+	namespace impl {
+		namespace ns_recursive_shared_timed_mutex {
+			struct thread_readlock_record {
+				const void* m_mutex_ptr;
+				int m_count;
+				/* Whether the (outermost) shared lock was obtained via the "fast path" (i.e. without locking the
+				underlying mutex). */
+				bool m_is_fast;
+			};
+			/* Each thread keeps its own (typically very short) list of the recursive_shared_timed_mutexes on which it holds
+			shared locks, so that the recursion counts of shared locks can be maintained without synchronization. */
+			inline std::vector<thread_readlock_record>& thread_readlock_records() {
+				thread_local std::vector<thread_readlock_record> tl_records;
+				return tl_records;
+			}
+		}
+	}
+
 	/* Note that this "recursive_shared_timed_mutex" allows a thread to hold "read" (shared) locks and "write" locks at the
 	same time. It also provides "nonrecursive_lock()" member functions to obtain a lock that is exclusive within the thread
 	as well as between threads. */
+	/* In the common case where no exclusive lock is held or pending, a shared lock is obtained (and released) with a
+	single atomic operation on a counter, without locking the underlying mutex. Exclusive locks wait for the outstanding
+	"fast path" shared locks to be released. */
 	class recursive_shared_timed_mutex : private std::shared_timed_mutex {
 	public:
 		typedef std::shared_timed_mutex base_class;
@@ -115,36 +150,35 @@ namespace mse {
 			}
 			else {
 				bool the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = false;
-				if (1 <= m_readlock_count) {
+				const auto record_ptr = find_this_thread_readlock_record();
+				if (record_ptr) {
 					assert(0 == m_writelock_count);
-					const auto this_thread_id = std::this_thread::get_id();
-					const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-					if (m_thread_id_readlock_count_map.end() != found_it) {
-						assert(1 <= (*found_it).second);
-						if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock) {
-							/* There is another thread that holds a readlock and is blocked waiting for this thread to
-							release its readlock (so it can (additionally) obtain a writelock). If we attempt to obtain
-							a writelock now this thread will block waiting on the aforementioned thread to release its
-							readlock, but that thread is in turn blocked waiting for this thread to do the same,
-							resulting in a deadlock. It is possible that the deadlock may not be indefinite due to
-							time-outs on the blocking, but here we'll still consider it a deadlock. */
-							MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
-						}
-						/* This thread currently holds a shared_lock on the underlying mutex. We'll release it so as not
-						to prevent the exclusive_lock from being acquired (by us), but first we'll register the fact that
-						we did so to prevent any other thread from aquiring and holding the lock before we do. */
-						the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = true;
-						m_writelock_or_suspended_shared_lock_thread_id = this_thread_id;
-						m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = true;
-						base_class::unlock_shared();
+					assert(1 <= record_ptr->m_count);
+					if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock) {
+						/* There is another thread that holds a readlock and is blocked waiting for this thread to
+						release its readlock (so it can (additionally) obtain a writelock). If we attempt to obtain
+						a writelock now this thread will block waiting on the aforementioned thread to release its
+						readlock, but that thread is in turn blocked waiting for this thread to do the same,
+						resulting in a deadlock. It is possible that the deadlock may not be indefinite due to
+						time-outs on the blocking, but here we'll still consider it a deadlock. */
+						MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
 					}
+					/* This thread currently holds a shared_lock. We'll release it so as not to prevent the
+					exclusive_lock from being acquired (by us), but first we'll register the fact that we did so to
+					prevent any other thread from aquiring and holding the lock before we do. */
+					the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = true;
+					m_writelock_or_suspended_shared_lock_thread_id = std::this_thread::get_id();
+					m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = true;
+					release_shared_lock_of_this_thread(*record_ptr);
 				}
 
 				assert((0 == m_writelock_count) || (std::this_thread::get_id() != m_writelock_or_suspended_shared_lock_thread_id));
+				add_pending_writer();
 				while (true) {
 					{
 						unlock_guard<std::mutex> unlock1(m_state_mutex1);
 						base_class::lock();
+						wait_for_fast_shared_locks_to_drain();
 					}
 					if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock
 						&& (!the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock)) {
@@ -180,30 +214,34 @@ namespace mse {
 			}
 			else {
 				bool the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = false;
-				if (1 <= m_readlock_count) {
+				const auto record_ptr = find_this_thread_readlock_record();
+				if (record_ptr) {
 					assert(0 == m_writelock_count);
-					const auto this_thread_id = std::this_thread::get_id();
-					const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-					if (m_thread_id_readlock_count_map.end() != found_it) {
-						assert(1 <= (*found_it).second);
-						assert(!m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
-						/* This thread currently holds a shared_lock on the underlying mutex. We'll release it so as not
-						to prevent the exclusive_lock from being acquired (by us), but first we'll register the fact that
-						we did so to prevent any other thread from aquiring and holding the lock before we do. */
-						the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = true;
-						m_writelock_or_suspended_shared_lock_thread_id = this_thread_id;
-						m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = true;
-						base_class::unlock_shared();
-					}
+					assert(1 <= record_ptr->m_count);
+					assert(!m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
+					/* This thread currently holds a shared_lock. We'll release it so as not to prevent the
+					exclusive_lock from being acquired (by us), but first we'll register the fact that we did so to
+					prevent any other thread from aquiring and holding the lock before we do. */
+					the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = true;
+					m_writelock_or_suspended_shared_lock_thread_id = std::this_thread::get_id();
+					m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = true;
+					release_shared_lock_of_this_thread(*record_ptr);
 				}
 				{
 					assert((0 == m_writelock_count) || (std::this_thread::get_id() != m_writelock_or_suspended_shared_lock_thread_id));
 					assert((!m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock)
 						|| the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock);
 
+					add_pending_writer();
 					retval = base_class::try_lock();
+					if (retval && (0 != fast_shared_lock_count())) {
+						/* There are outstanding "fast path" shared locks. */
+						base_class::unlock();
+						retval = false;
+					}
 
 					if (!retval) {
+						remove_pending_writer();
 						if (the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock) {
 							{
 								/* reacquire the shared_lock that was released to facilitate the attempt to acquire an exclusive lock */
@@ -249,42 +287,45 @@ namespace mse {
 			}
 			else {
 				bool the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = false;
-				if (1 <= m_readlock_count) {
+				const auto record_ptr = find_this_thread_readlock_record();
+				if (record_ptr) {
 					assert(0 == m_writelock_count);
-					const auto this_thread_id = std::this_thread::get_id();
-					const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-					if (m_thread_id_readlock_count_map.end() != found_it) {
-						assert(1 <= (*found_it).second);
-						if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock) {
-							/* There is another thread that holds a readlock and is blocked waiting for this thread to
-							release its readlock (so it can (additionally) obtain a writelock). If we attempt to obtain
-							a writelock now this thread will block waiting on the aforementioned thread to release its
-							readlock, but that thread is in turn blocked waiting for this thread to do the same,
-							resulting in a deadlock. It is possible that the deadlock may not be indefinite due to
-							time-outs on the blocking, but here we'll still consider it a deadlock. */
-							return false;
-						}
-						/* This thread currently holds a shared_lock on the underlying mutex. We'll release it so as not
-						to prevent the exclusive_lock from being acquired (by us), but first we'll register the fact that
-						we did so to prevent any other thread from aquiring and holding the lock before we do. */
-						the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = true;
-						m_writelock_or_suspended_shared_lock_thread_id = this_thread_id;
-						m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = true;
-						base_class::unlock_shared();
+					assert(1 <= record_ptr->m_count);
+					if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock) {
+						/* There is another thread that holds a readlock and is blocked waiting for this thread to
+						release its readlock (so it can (additionally) obtain a writelock). If we attempt to obtain
+						a writelock now this thread will block waiting on the aforementioned thread to release its
+						readlock, but that thread is in turn blocked waiting for this thread to do the same,
+						resulting in a deadlock. It is possible that the deadlock may not be indefinite due to
+						time-outs on the blocking, but here we'll still consider it a deadlock. */
+						return false;
 					}
+					/* This thread currently holds a shared_lock. We'll release it so as not to prevent the
+					exclusive_lock from being acquired (by us), but first we'll register the fact that we did so to
+					prevent any other thread from aquiring and holding the lock before we do. */
+					the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock = true;
+					m_writelock_or_suspended_shared_lock_thread_id = std::this_thread::get_id();
+					m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = true;
+					release_shared_lock_of_this_thread(*record_ptr);
 				}
 				{
 					assert((0 == m_writelock_count) || (std::this_thread::get_id() != m_writelock_or_suspended_shared_lock_thread_id));
+					add_pending_writer();
 					retval = false;
 					while (std::chrono::steady_clock::now() < _Abs_time) {
 						{
 							unlock_guard<std::mutex> unlock1(m_state_mutex1);
 							retval = base_class::try_lock_until(_Abs_time);
+							if (retval && (!wait_for_fast_shared_locks_to_drain_until(_Abs_time))) {
+								base_class::unlock();
+								retval = false;
+							}
 						}
-						if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock
+						if (retval && m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock
 							&& (!the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock)) {
 							/* In this case we need to yield our (just obtained) writelock (to the thread that has "dibs"). */
 							base_class::unlock();
+							retval = false;
 						}
 						else {
 							break;
@@ -292,6 +333,7 @@ namespace mse {
 					}
 
 					if (!retval) {
+						remove_pending_writer();
 						if (the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock) {
 							{
 								/* reacquire the shared_lock that was released to facilitate the attempt to acquire an exclusive lock */
@@ -325,12 +367,17 @@ namespace mse {
 			}
 
 			if ((2 <= m_writelock_count) && (std::this_thread::get_id() == m_writelock_or_suspended_shared_lock_thread_id)) {
+				m_writelock_count -= 1;
 			}
 			else {
 				if (1 != m_writelock_count) {
 					MSE_THROW(std::system_error(std::make_error_code(std::errc::no_lock_available)));
 				}
+				/* The writelock count is updated before the suspended shared_lock (if any) is reacquired (below), as other
+				threads may obtain shared locks while the state mutex is released. */
+				m_writelock_count -= 1;
 				base_class::unlock();
+				remove_pending_writer();
 				m_writelock_is_nonrecursive = false;
 				if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock) {
 					assert(std::this_thread::get_id() == m_writelock_or_suspended_shared_lock_thread_id);
@@ -343,7 +390,6 @@ namespace mse {
 					m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
 				}
 			}
-			m_writelock_count -= 1;
 		}
 
 		void nonrecursive_lock()
@@ -354,20 +400,17 @@ namespace mse {
 				MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
 			}
 			else {
-				if (1 <= m_readlock_count) {
-					const auto this_thread_id = std::this_thread::get_id();
-					const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-					if (m_thread_id_readlock_count_map.end() != found_it) {
-						assert(1 <= (*found_it).second);
-						MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
-					}
+				if (find_this_thread_readlock_record()) {
+					MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
 				}
 
 				assert((std::this_thread::get_id() != m_writelock_or_suspended_shared_lock_thread_id) || (0 == m_writelock_count));
+				add_pending_writer();
 				while (true) {
 					{
 						unlock_guard<std::mutex> unlock1(m_state_mutex1);
 						base_class::lock();
+						wait_for_fast_shared_locks_to_drain();
 					}
 					if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock
 						/*&& (!the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock)*/) {
@@ -397,22 +440,26 @@ namespace mse {
 				retval = false;
 			}
 			else {
-				if (1 <= m_readlock_count) {
-					const auto this_thread_id = std::this_thread::get_id();
-					const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-					if (m_thread_id_readlock_count_map.end() != found_it) {
-						assert(1 <= (*found_it).second);
-						return false;
-					}
+				if (find_this_thread_readlock_record()) {
+					return false;
 				}
 
+				add_pending_writer();
 				retval = base_class::try_lock();
+				if (retval && (0 != fast_shared_lock_count())) {
+					/* There are outstanding "fast path" shared locks. */
+					base_class::unlock();
+					retval = false;
+				}
 				if (retval) {
 					m_writelock_or_suspended_shared_lock_thread_id = std::this_thread::get_id();
 					assert(0 == m_writelock_count);
 					m_writelock_count += 1;
 					m_writelock_is_nonrecursive = true;
 				}
+				else {
+					remove_pending_writer();
+				}
 			}
 			return retval;
 		}
@@ -433,25 +480,26 @@ namespace mse {
 				retval = false;
 			}
 			else {
-				if (1 <= m_readlock_count) {
-					const auto this_thread_id = std::this_thread::get_id();
-					const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-					if (m_thread_id_readlock_count_map.end() != found_it) {
-						assert(1 <= (*found_it).second);
-						return false;
-					}
+				if (find_this_thread_readlock_record()) {
+					return false;
 				}
 
+				add_pending_writer();
 				retval = false;
 				while (std::chrono::steady_clock::now() < _Abs_time) {
 					{
 						unlock_guard<std::mutex> unlock1(m_state_mutex1);
 						retval = base_class::try_lock_until(_Abs_time);
+						if (retval && (!wait_for_fast_shared_locks_to_drain_until(_Abs_time))) {
+							base_class::unlock();
+							retval = false;
+						}
 					}
-					if (m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock
+					if (retval && m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock
 						/*&& (!the_shared_lock_of_this_thread_is_suspended_to_allow_an_exclusive_lock)*/) {
 						/* In this case we need to yield our (just obtained) writelock (to the thread that has "dibs"). */
 						base_class::unlock();
+						retval = false;
 					}
 					else {
 						break;
@@ -463,6 +511,9 @@ namespace mse {
 					m_writelock_count += 1;
 					m_writelock_is_nonrecursive = true;
 				}
+				else {
+					remove_pending_writer();
+				}
 			}
 			return retval;
 		}
@@ -476,107 +527,93 @@ namespace mse {
 			if ((!m_writelock_is_nonrecursive) || (!(1 == m_writelock_count))) {
 				MSE_THROW(std::system_error(std::make_error_code(std::errc::no_lock_available)));
 			}
-			assert(0 == m_readlock_count);
+			assert(!find_this_thread_readlock_record());
 
 			base_class::unlock();
+			remove_pending_writer();
 			m_writelock_is_nonrecursive = false;
 			m_writelock_count -= 1;
 		}
 
 		void lock_shared()
 		{	// lock non-exclusive
+			const auto record_ptr = find_this_thread_readlock_record();
+			if (record_ptr) {
+				/* The recursion count is thread local, so no synchronization is required. */
+				assert(1 <= record_ptr->m_count);
+				record_ptr->m_count += 1;
+				return;
+			}
+			if (try_fast_lock_shared()) {
+				return;
+			}
+
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
 
 			const auto this_thread_id = std::this_thread::get_id();
-			const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-			if ((m_thread_id_readlock_count_map.end() != found_it) && (1 <= (*found_it).second)) {
-				(*found_it).second += 1;
-			}
-			else if ((1 <= m_writelock_count) && (this_thread_id == m_writelock_or_suspended_shared_lock_thread_id) && (!m_writelock_is_nonrecursive)) {
-				assert((m_thread_id_readlock_count_map.end() == found_it) || (0 == (*found_it).second));
+			if ((1 <= m_writelock_count) && (this_thread_id == m_writelock_or_suspended_shared_lock_thread_id) && (!m_writelock_is_nonrecursive)) {
 				assert(!m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
-				m_writelock_or_suspended_shared_lock_thread_id = this_thread_id;
 				m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = true;
 				MSE_TRY {
-					std::unordered_map<std::thread::id, int>::value_type item(this_thread_id, 1);
-					m_thread_id_readlock_count_map.insert(item);
+					add_this_thread_readlock_record(false);
 				}
 				MSE_CATCH_ANY {
 					m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
-					MSE_THROW(asyncshared_runtime_error("std::unordered_map<>::insert() failed? - mse::recursive_shared_timed_mutex"));
+					MSE_THROW(asyncshared_runtime_error("std::vector<>::push_back() failed? - mse::recursive_shared_timed_mutex"));
 				}
 			}
 			else {
-				assert((m_thread_id_readlock_count_map.end() == found_it) || (0 == (*found_it).second));
 				{
 					unlock_guard<std::mutex> unlock1(m_state_mutex1);
 					base_class::lock_shared();
 				}
 				MSE_TRY {
-					/* Things could've changed so we have to check again. */
-					const auto l_found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-					if (m_thread_id_readlock_count_map.end() != l_found_it) {
-						assert(0 <= (*l_found_it).second);
-						(*l_found_it).second += 1;
-					}
-					else {
-						std::unordered_map<std::thread::id, int>::value_type item(this_thread_id, 1);
-						m_thread_id_readlock_count_map.insert(item);
-					}
+					add_this_thread_readlock_record(false);
 				}
 				MSE_CATCH_ANY {
 					base_class::unlock_shared();
-					MSE_THROW(asyncshared_runtime_error("std::unordered_map<>::insert() failed? - mse::recursive_shared_timed_mutex"));
+					MSE_THROW(asyncshared_runtime_error("std::vector<>::push_back() failed? - mse::recursive_shared_timed_mutex"));
 				}
 			}
-			m_readlock_count += 1;
 		}
 
 		bool try_lock_shared()
 		{	// try to lock non-exclusive
 			bool retval = false;
+			const auto record_ptr = find_this_thread_readlock_record();
+			if (record_ptr) {
+				assert(1 <= record_ptr->m_count);
+				record_ptr->m_count += 1;
+				return true;
+			}
+			if (try_fast_lock_shared()) {
+				return true;
+			}
+
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
 
 			const auto this_thread_id = std::this_thread::get_id();
-			const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-			if ((m_thread_id_readlock_count_map.end() != found_it) && (1 <= (*found_it).second)) {
-				(*found_it).second += 1;
-				m_readlock_count += 1;
-				retval = true;
-			}
-			else if ((1 <= m_writelock_count) && (this_thread_id == m_writelock_or_suspended_shared_lock_thread_id) && (!m_writelock_is_nonrecursive)) {
-				assert((m_thread_id_readlock_count_map.end() == found_it) || (0 == (*found_it).second));
+			if ((1 <= m_writelock_count) && (this_thread_id == m_writelock_or_suspended_shared_lock_thread_id) && (!m_writelock_is_nonrecursive)) {
 				assert(!m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
-				m_writelock_or_suspended_shared_lock_thread_id = this_thread_id;
 				m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = true;
 				MSE_TRY {
-					std::unordered_map<std::thread::id, int>::value_type item(this_thread_id, 1);
-					m_thread_id_readlock_count_map.insert(item);
-					m_readlock_count += 1;
+					add_this_thread_readlock_record(false);
 					retval = true;
 				}
 				MSE_CATCH_ANY {
 					m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
-					MSE_THROW(asyncshared_runtime_error("std::unordered_map<>::insert() failed? - mse::recursive_shared_timed_mutex"));
+					MSE_THROW(asyncshared_runtime_error("std::vector<>::push_back() failed? - mse::recursive_shared_timed_mutex"));
 				}
 			}
 			else {
 				retval = base_class::try_lock_shared();
 				if (retval) {
 					MSE_TRY {
-						if (m_thread_id_readlock_count_map.end() != found_it) {
-							assert(0 <= (*found_it).second);
-							(*found_it).second += 1;
-						}
-						else {
-							std::unordered_map<std::thread::id, int>::value_type item(this_thread_id, 1);
-							m_thread_id_readlock_count_map.insert(item);
-						}
-						m_readlock_count += 1;
+						add_this_thread_readlock_record(false);
 					}
 					MSE_CATCH_ANY {
 						base_class::unlock_shared();
-						MSE_THROW(asyncshared_runtime_error("std::unordered_map<>::insert() failed? - mse::recursive_shared_timed_mutex"));
+						MSE_THROW(asyncshared_runtime_error("std::vector<>::push_back() failed? - mse::recursive_shared_timed_mutex"));
 					}
 				}
 			}
@@ -593,29 +630,29 @@ namespace mse {
 		bool try_lock_shared_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time)
 		{	// try to lock non-exclusive until absolute time
 			bool retval = false;
+			const auto record_ptr = find_this_thread_readlock_record();
+			if (record_ptr) {
+				assert(1 <= record_ptr->m_count);
+				record_ptr->m_count += 1;
+				return true;
+			}
+			if (try_fast_lock_shared()) {
+				return true;
+			}
+
 			std::lock_guard<std::mutex> lock1(m_state_mutex1);
 
 			const auto this_thread_id = std::this_thread::get_id();
-			const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-			if ((m_thread_id_readlock_count_map.end() != found_it) && (1 <= (*found_it).second)) {
-				(*found_it).second += 1;
-				m_readlock_count += 1;
-				retval = true;
-			}
-			else if ((1 <= m_writelock_count) && (this_thread_id == m_writelock_or_suspended_shared_lock_thread_id) && (!m_writelock_is_nonrecursive)) {
-				assert((m_thread_id_readlock_count_map.end() == found_it) || (0 == (*found_it).second));
+			if ((1 <= m_writelock_count) && (this_thread_id == m_writelock_or_suspended_shared_lock_thread_id) && (!m_writelock_is_nonrecursive)) {
 				assert(!m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock);
-				m_writelock_or_suspended_shared_lock_thread_id = this_thread_id;
 				m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = true;
 				MSE_TRY {
-					std::unordered_map<std::thread::id, int>::value_type item(this_thread_id, 1);
-					m_thread_id_readlock_count_map.insert(item);
-					m_readlock_count += 1;
+					add_this_thread_readlock_record(false);
 					retval = true;
 				}
 				MSE_CATCH_ANY {
 					m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
-					MSE_THROW(asyncshared_runtime_error("std::unordered_map<>::insert() failed? - mse::recursive_shared_timed_mutex"));
+					MSE_THROW(asyncshared_runtime_error("std::vector<>::push_back() failed? - mse::recursive_shared_timed_mutex"));
 				}
 			}
 			else {
@@ -625,19 +662,11 @@ namespace mse {
 				}
 				if (retval) {
 					MSE_TRY {
-						if (m_thread_id_readlock_count_map.end() != found_it) {
-							assert(0 <= (*found_it).second);
-							(*found_it).second += 1;
-						}
-						else {
-							std::unordered_map<std::thread::id, int>::value_type item(this_thread_id, 1);
-							m_thread_id_readlock_count_map.insert(item);
-						}
-						m_readlock_count += 1;
+						add_this_thread_readlock_record(false);
 					}
 					MSE_CATCH_ANY {
 						base_class::unlock_shared();
-						MSE_THROW(asyncshared_runtime_error("std::unordered_map<>::insert() failed? - mse::recursive_shared_timed_mutex"));
+						MSE_THROW(asyncshared_runtime_error("std::vector<>::push_back() failed? - mse::recursive_shared_timed_mutex"));
 					}
 				}
 			}
@@ -646,31 +675,30 @@ namespace mse {
 
 		void unlock_shared()
 		{	// unlock non-exclusive
-			std::lock_guard<std::mutex> lock1(m_state_mutex1);
+			const auto record_ptr = find_this_thread_readlock_record();
+			if (!record_ptr) {
+				assert(false);
+				MSE_THROW(asyncshared_runtime_error("unpaired unlock_shared() call? - mse::recursive_shared_timed_mutex"));
+			}
+			if (2 <= record_ptr->m_count) {
+				record_ptr->m_count -= 1;
+				return;
+			}
+			assert(1 == record_ptr->m_count);
+			const bool is_fast = record_ptr->m_is_fast;
+			remove_this_thread_readlock_record(record_ptr);
+			if (is_fast) {
+				fast_unlock_shared();
+				return;
+			}
 
-			const auto this_thread_id = std::this_thread::get_id();
-			const auto found_it = m_thread_id_readlock_count_map.find(this_thread_id);
-			if (m_thread_id_readlock_count_map.end() != found_it) {
-				if (2 <= (*found_it).second) {
-					(*found_it).second -= 1;
-				}
-				else {
-					assert(1 == (*found_it).second);
-					m_thread_id_readlock_count_map.erase(found_it);
-					if ((m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock) && (this_thread_id == m_writelock_or_suspended_shared_lock_thread_id)) {
-						m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
-					}
-					else {
-						base_class::unlock_shared();
-					}
-				}
+			std::lock_guard<std::mutex> lock1(m_state_mutex1);
+			if ((m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock) && (std::this_thread::get_id() == m_writelock_or_suspended_shared_lock_thread_id)) {
+				m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
 			}
 			else {
-				assert(false);
-				MSE_THROW(asyncshared_runtime_error("unpaired unlock_shared() call? - mse::recursive_shared_timed_mutex"));
-				//base_class::unlock_shared();
+				base_class::unlock_shared();
 			}
-			m_readlock_count -= 1;
 		}
 
 		//std::mutex m_write_mutex;
@@ -680,798 +708,1213 @@ namespace mse {
 		std::thread::id m_writelock_or_suspended_shared_lock_thread_id;
 		int m_writelock_count = 0;
 		bool m_writelock_is_nonrecursive = false;
-		std::unordered_map<std::thread::id, int> m_thread_id_readlock_count_map;
-		int m_readlock_count = 0;
 		bool m_a_shared_lock_is_suspended_to_allow_an_exclusive_lock = false;
-	};
-
-	//typedef std::shared_timed_mutex async_shared_timed_mutex_type;
-	typedef recursive_shared_timed_mutex async_shared_timed_mutex_type;
 
+	private:
+		typedef mse::impl::ns_recursive_shared_timed_mutex::thread_readlock_record readlock_record_t;
 
-	namespace us {
-		namespace impl {
-			template<typename _TAccessLease> class TAsyncSharedV2XWPReadWriteAccessRequesterBase;
-			template<typename _TAccessLease> class TAsyncSharedV2ReadWritePointerBase;
-			template<typename _TAccessLease> class TAsyncSharedV2ReadWriteConstPointerBase;
-			template<typename _TAccessLease> class TAsyncSharedV2ExclusiveReadWritePointerBase;
-			template<typename _TAccessLease> class TAsyncSharedV2XWPReadOnlyAccessRequesterBase;
-			template<typename _TAccessLease> class TAsyncSharedV2ReadOnlyConstPointerBase;
+		readlock_record_t* find_this_thread_readlock_record() const {
+			for (auto& record : mse::impl::ns_recursive_shared_timed_mutex::thread_readlock_records()) {
+				if (this == record.m_mutex_ptr) {
+					return std::addressof(record);
+				}
+			}
+			return nullptr;
+		}
+		void add_this_thread_readlock_record(bool is_fast) {
+			mse::impl::ns_recursive_shared_timed_mutex::thread_readlock_records().push_back(readlock_record_t{ this, 1, is_fast });
+		}
+		static void remove_this_thread_readlock_record(readlock_record_t* record_ptr) {
+			auto& records = mse::impl::ns_recursive_shared_timed_mutex::thread_readlock_records();
+			(*record_ptr) = records.back();
+			records.pop_back();
 		}
-	}
-
-	template<typename _TAccessLease> class TXScopeAsyncSharedV2XWPReadWriteAccessRequester;
-	template<typename _TAccessLease> class TXScopeAsyncSharedV2ReadWritePointer;
-	template<typename _TAccessLease> class TXScopeAsyncSharedV2ReadWriteConstPointer;
-	template<typename _TAccessLease> class TXScopeAsyncSharedV2ExclusiveReadWritePointer;
-	template<typename _TAccessLease> class TXScopeAsyncSharedV2XWPReadOnlyAccessRequester;
-	template<typename _TAccessLease> class TXScopeAsyncSharedV2ReadOnlyConstPointer;
 
-	template<typename _TAccessLease> class TAsyncSharedV2XWPReadWriteAccessRequester;
-	template<typename _TAccessLease> class TAsyncSharedV2ReadWritePointer;
-	template<typename _TAccessLease> class TAsyncSharedV2ReadWriteConstPointer;
-	template<typename _TAccessLease> class TAsyncSharedV2ExclusiveReadWritePointer;
-	template<typename _TAccessLease> class TAsyncSharedV2XWPReadOnlyAccessRequester;
-	template<typename _TAccessLease> class TAsyncSharedV2ReadOnlyConstPointer;
+		/* The low half of m_fast_state holds the number of outstanding "fast path" shared locks, and the high half holds
+		the number of held or pending exclusive locks. "Fast path" shared locks are only granted while the latter is
+		zero. */
+		typedef uint64_t fast_state_t;
+		static fast_state_t fast_shared_lock_count_mask() { return fast_state_t(0xffffffff); }
+		static fast_state_t pending_writer_increment() { return fast_state_t(1) << 32; }
 
-	template <typename _TAccessLease>
-	class TAsyncSharedXWPAccessLeaseObj {
-	public:
-		TAsyncSharedXWPAccessLeaseObj(_TAccessLease&& access_lease)
-			: m_access_lease(std::forward<_TAccessLease>(access_lease)) {}
-		const _TAccessLease& cref() const {
-			return m_access_lease;
+		bool try_fast_lock_shared() {
+			fast_state_t state = m_fast_state.load(std::memory_order_relaxed);
+			while (0 == (state & ~fast_shared_lock_count_mask())) {
+				if (m_fast_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+					MSE_TRY {
+						add_this_thread_readlock_record(true);
+					}
+					MSE_CATCH_ANY {
+						fast_unlock_shared();
+						MSE_THROW(asyncshared_runtime_error("std::vector<>::push_back() failed? - mse::recursive_shared_timed_mutex"));
+					}
+					return true;
+				}
+			}
+			return false;
+		}
+		void fast_unlock_shared() {
+			const fast_state_t prev_state = m_fast_state.fetch_sub(1, std::memory_order_release);
+			if ((1 == (prev_state & fast_shared_lock_count_mask())) && (0 != (prev_state & ~fast_shared_lock_count_mask()))) {
+				/* The last outstanding "fast path" shared lock has been released and a writer may be waiting for it. */
+				std::lock_guard<std::mutex> lock2(m_fast_shared_locks_drained_mutex);
+				m_fast_shared_locks_drained_cv.notify_all();
+			}
 		}
-		async_shared_timed_mutex_type& mutex_ref() const {
-			return m_mutex1;
+		fast_state_t fast_shared_lock_count() const {
+			return (m_fast_state.load(std::memory_order_acquire) & fast_shared_lock_count_mask());
+		}
+		void add_pending_writer() {
+			m_fast_state.fetch_add(pending_writer_increment());
+		}
+		void remove_pending_writer() {
+			m_fast_state.fetch_sub(pending_writer_increment());
+		}
+		void wait_for_fast_shared_locks_to_drain() {
+			if (0 != fast_shared_lock_count()) {
+				std::unique_lock<std::mutex> lock2(m_fast_shared_locks_drained_mutex);
+				m_fast_shared_locks_drained_cv.wait(lock2, [this]() { return (0 == fast_shared_lock_count()); });
+			}
+		}
+		template<class _Clock, class _Duration>
+		bool wait_for_fast_shared_locks_to_drain_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			if (0 != fast_shared_lock_count()) {
+				std::unique_lock<std::mutex> lock2(m_fast_shared_locks_drained_mutex);
+				return m_fast_shared_locks_drained_cv.wait_until(lock2, _Abs_time, [this]() { return (0 == fast_shared_lock_count()); });
+			}
+			return true;
+		}
+		/* Releases the shared lock held by this thread (to make way for an exclusive lock). */
+		void release_shared_lock_of_this_thread(readlock_record_t& record) {
+			if (record.m_is_fast) {
+				/* The shared lock will subsequently be reacquired on the underlying mutex. */
+				record.m_is_fast = false;
+				fast_unlock_shared();
+			}
+			else {
+				base_class::unlock_shared();
+			}
 		}
-	private:
-		_TAccessLease m_access_lease;
-
-		mutable async_shared_timed_mutex_type m_mutex1;
 
-		friend class mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease>;
-		friend class mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease>;
-		friend class mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease>;
-		friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
-		friend class mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease>;
+		std::atomic<fast_state_t> m_fast_state{ 0 };
+		std::mutex m_fast_shared_locks_drained_mutex;
+		std::condition_variable m_fast_shared_locks_drained_cv;
 	};
 
-	namespace us {
-		namespace impl {
-			template<typename _TAccessLease>
-			class TAsyncSharedV2ReadWritePointerBase : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotPassableTagBase {
-			public:
-				TAsyncSharedV2ReadWritePointerBase(const TAsyncSharedV2ReadWritePointerBase& src) : m_shptr(src.m_shptr), m_unique_lock(src.m_shptr->m_mutex1) {}
-				TAsyncSharedV2ReadWritePointerBase(TAsyncSharedV2ReadWritePointerBase&& src) = default;
-				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadWritePointerBase() {}
+	//typedef std::shared_timed_mutex async_shared_timed_mutex_type;
+	typedef recursive_shared_timed_mutex async_shared_timed_mutex_type;
 
-				operator bool() const {
-					//assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
-					return m_shptr.operator bool();
+	/* The following "access mutex" types can be used (as the _TAccessMutex template parameter of
+	TAsyncSharedV2ReadWriteAccessRequester<> and TAsyncSharedV2ReadOnlyAccessRequester<>) in place of the default
+	(recursive_shared_timed_mutex). Unlike the default, they do not support holding more than one lock pointer (to the
+	same shared object) at a time in the same thread, and do not detect the deadlocks that doing so can cause. In
+	exchange they are significantly cheaper to lock and unlock, which can matter when the critical sections are short.
+	(std::shared_timed_mutex and std::shared_mutex can also be used.) */
+
+	namespace impl {
+		namespace ns_access_mutex {
+			/* Used while busy-waiting. Initially just hints to the processor that we're spinning, but eventually yields
+			the rest of the time slice. */
+			inline void spin_pause(int& spin_count) {
+				if (64 > spin_count) {
+					spin_count += 1;
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+					__builtin_ia32_pause();
+#endif /*(defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))*/
 				}
-				typedef std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr_t;
-				/* gcc5 crashes if you uncomment the explicit return type declaration (Nov 2017). */
-				auto& operator*() const/* -> typename std::add_lvalue_reference<decltype(*((*std::declval<m_shptr_t>()).cref()))>::type*/ {
-					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
-					return (*((*m_shptr).cref()));
+				else {
+					std::this_thread::yield();
 				}
-				auto operator->() const/* -> decltype(std::addressof(*((*std::declval<m_shptr_t>()).cref())))*/ {
-					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
-					return std::addressof(*((*m_shptr).cref()));
+			}
+
+			/* Threads are assigned (sequential) indexes in order of first use. Used to distribute threads among
+			per-thread "slots" in round-robin fashion. */
+			inline size_t this_thread_round_robin_index() {
+				static std::atomic<size_t> s_next_index{ 0 };
+				thread_local const size_t tl_index = s_next_index.fetch_add(1, std::memory_order_relaxed);
+				return tl_index;
+			}
+
+			/* Implements the timed (and "nonrecursive") locking functions in terms of the derived class' try_lock() and
+			try_lock_shared(). */
+			template<class _TDerived>
+			class TSpinningTimedLockingBase {
+			public:
+				template<class _Rep, class _Period>
+				bool try_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+					return try_lock_until(std::chrono::steady_clock::now() + _Rel_time);
 				}
-				void async_not_passable_tag() const {}
-			private:
-				TAsyncSharedV2ReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1) {}
-				TAsyncSharedV2ReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_unique_lock.try_lock()) {
-						m_shptr = nullptr;
+				template<class _Clock, class _Duration>
+				bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+					int spin_count = 0;
+					while (!derived().try_lock()) {
+						if (_Clock::now() >= _Abs_time) {
+							return false;
+						}
+						spin_pause(spin_count);
 					}
+					return true;
 				}
 				template<class _Rep, class _Period>
-				TAsyncSharedV2ReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::duration<_Rep, _Period>& _Rel_time) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_unique_lock.try_lock_for(_Rel_time)) {
-						m_shptr = nullptr;
-					}
+				bool try_lock_shared_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+					return try_lock_shared_until(std::chrono::steady_clock::now() + _Rel_time);
 				}
 				template<class _Clock, class _Duration>
-				TAsyncSharedV2ReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_unique_lock.try_lock_until(_Abs_time)) {
-						m_shptr = nullptr;
+				bool try_lock_shared_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+					int spin_count = 0;
+					while (!derived().try_lock_shared()) {
+						if (_Clock::now() >= _Abs_time) {
+							return false;
+						}
+						spin_pause(spin_count);
 					}
+					return true;
 				}
-				TAsyncSharedV2ReadWritePointerBase& operator=(const TAsyncSharedV2ReadWritePointerBase& _Right_cref) = delete;
-				TAsyncSharedV2ReadWritePointerBase& operator=(TAsyncSharedV2ReadWritePointerBase&& _Right) = delete;
-
-				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-
-				bool is_valid() const {
-					bool retval = m_shptr.operator bool();
-					return retval;
-				}
+			private:
+				_TDerived& derived() { return static_cast<_TDerived&>(*this); }
+			};
 
-				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
-				std::unique_lock<async_shared_timed_mutex_type> m_unique_lock;
+			template<typename _TMutex, typename = void>
+			struct has_nonrecursive_lock : std::false_type {};
+			template<typename _TMutex>
+			struct has_nonrecursive_lock<_TMutex, mse::impl::void_t<decltype(std::declval<_TMutex&>().nonrecursive_lock())> > : std::true_type {};
 
-				friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
-				friend class TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>;
-				friend class TAsyncSharedV2ReadWritePointer<_TAccessLease>;
-				friend class mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease>;
-			};
+			/* Exclusive lock pointers use "nonrecursive" locks when the mutex supports them. (A lock on a mutex that
+			doesn't support recursion is already exclusive within the thread as well as between threads.) */
+			template<typename _TMutex>
+			using unique_nonrecursive_lock_t = typename std::conditional<has_nonrecursive_lock<_TMutex>::value
+				, unique_nonrecursive_lock<_TMutex>, std::unique_lock<_TMutex> >::type;
 		}
 	}
 
-	template<typename _TAccessLease>
-	class TXScopeAsyncSharedV2ReadWritePointer : public mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	/* A "readers-writer" spinlock. Pending exclusive locks take precedence over (new) shared locks. */
+	class spin_shared_mutex : public mse::impl::ns_access_mutex::TSpinningTimedLockingBase<spin_shared_mutex> {
 	public:
-		typedef mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease> base_class;
+		spin_shared_mutex() {}
+		spin_shared_mutex(const spin_shared_mutex&) = delete;
+		spin_shared_mutex& operator=(const spin_shared_mutex&) = delete;
+
+		void lock() {
+			int spin_count = 0;
+			while (true) {
+				uint32_t state = m_state.load(std::memory_order_relaxed);
+				if (0 == (state & ~sc_writer_waiting)) {
+					if (m_state.compare_exchange_weak(state, sc_writer, std::memory_order_acquire, std::memory_order_relaxed)) {
+						return;
+					}
+				}
+				else if (0 == (state & sc_writer_waiting)) {
+					m_state.fetch_or(sc_writer_waiting, std::memory_order_relaxed);
+				}
+				mse::impl::ns_access_mutex::spin_pause(spin_count);
+			}
+		}
+		bool try_lock() {
+			uint32_t state = m_state.load(std::memory_order_relaxed);
+			return (0 == (state & ~sc_writer_waiting))
+				&& m_state.compare_exchange_strong(state, sc_writer, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+		void unlock() {
+			m_state.fetch_and(~sc_writer, std::memory_order_release);
+		}
 
-		TXScopeAsyncSharedV2ReadWritePointer(const TXScopeAsyncSharedV2ReadWritePointer& src) = default;
-		TXScopeAsyncSharedV2ReadWritePointer(TXScopeAsyncSharedV2ReadWritePointer&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2ReadWritePointer() {}
+		void lock_shared() {
+			int spin_count = 0;
+			while (!try_lock_shared()) {
+				mse::impl::ns_access_mutex::spin_pause(spin_count);
+			}
+		}
+		bool try_lock_shared() {
+			uint32_t state = m_state.load(std::memory_order_relaxed);
+			while (0 == (state & (sc_writer | sc_writer_waiting))) {
+				if (m_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+					return true;
+				}
+			}
+			return false;
+		}
+		void unlock_shared() {
+			m_state.fetch_sub(1, std::memory_order_release);
+		}
 
-		void async_not_passable_tag() const {}
 	private:
-		TXScopeAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TXScopeAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
-		template<class _Rep, class _Period>
-		TXScopeAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
-		template<class _Clock, class _Duration>
-		TXScopeAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
-
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-
-		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
+		/* The low bits hold the number of shared locks. */
+		static const uint32_t sc_writer = uint32_t(1) << 31;
+		static const uint32_t sc_writer_waiting = uint32_t(1) << 30;
+		std::atomic<uint32_t> m_state{ 0 };
 	};
 
-	template<typename _TAccessLease>
-	class TAsyncSharedV2ReadWritePointer : public mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease> {
+	/* A "ticket" lock. Locks are granted in the order they were requested, so no thread can be starved. Shared locks
+	are also exclusive. */
+	class ticket_shared_mutex : public mse::impl::ns_access_mutex::TSpinningTimedLockingBase<ticket_shared_mutex> {
 	public:
-		typedef mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease> base_class;
+		ticket_shared_mutex() {}
+		ticket_shared_mutex(const ticket_shared_mutex&) = delete;
+		ticket_shared_mutex& operator=(const ticket_shared_mutex&) = delete;
+
+		void lock() {
+			const uint32_t ticket = m_next_ticket.fetch_add(1, std::memory_order_relaxed);
+			int spin_count = 0;
+			while (ticket != m_now_serving.load(std::memory_order_acquire)) {
+				mse::impl::ns_access_mutex::spin_pause(spin_count);
+			}
+		}
+		bool try_lock() {
+			/* A ticket can only be taken if it would be served immediately. */
+			uint32_t ticket = m_now_serving.load(std::memory_order_acquire);
+			return m_next_ticket.compare_exchange_strong(ticket, ticket + 1, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+		void unlock() {
+			m_now_serving.store(m_now_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
 
-		TAsyncSharedV2ReadWritePointer(const TAsyncSharedV2ReadWritePointer& src) = default;
-		TAsyncSharedV2ReadWritePointer(TAsyncSharedV2ReadWritePointer&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadWritePointer() {}
+		void lock_shared() { lock(); }
+		bool try_lock_shared() { return try_lock(); }
+		void unlock_shared() { unlock(); }
 
-		void async_not_passable_tag() const {}
 	private:
-		TAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
-		template<class _Rep, class _Period>
-		TAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
-		template<class _Clock, class _Duration>
-		TAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
+		std::atomic<uint32_t> m_next_ticket{ 0 };
+		std::atomic<uint32_t> m_now_serving{ 0 };
+	};
 
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+	/* A "big reader" lock. Shared locks only modify a counter (one of several, each occupying its own cache line)
+	associated with the current thread, so threads obtaining shared locks don't contend with each other. Exclusive
+	locks are correspondingly more expensive, as they must inspect all of the counters. */
+	class brlock_shared_mutex : public mse::impl::ns_access_mutex::TSpinningTimedLockingBase<brlock_shared_mutex> {
+	public:
+		static const size_t sc_reader_slot_count = 16;
 
-		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
-	};
-
-	namespace us {
-		namespace impl {
-			template<typename _TAccessLease>
-			class TAsyncSharedV2ReadWriteConstPointerBase : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotPassableTagBase {
-			public:
-				TAsyncSharedV2ReadWriteConstPointerBase(const TAsyncSharedV2ReadWriteConstPointerBase& src) : m_shptr(src.m_shptr), m_shared_lock(src.m_shptr->m_mutex1) {}
-				TAsyncSharedV2ReadWriteConstPointerBase(TAsyncSharedV2ReadWriteConstPointerBase&& src) = default;
-				TAsyncSharedV2ReadWriteConstPointerBase(const mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease>& src) : m_shptr(src.m_shptr), m_shared_lock(src.m_shptr->m_mutex1) {}
-				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadWriteConstPointerBase() {}
+		brlock_shared_mutex() {}
+		brlock_shared_mutex(const brlock_shared_mutex&) = delete;
+		brlock_shared_mutex& operator=(const brlock_shared_mutex&) = delete;
 
-				operator bool() const {
-					//assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWriteConstPointerBase")); }
-					return m_shptr.operator bool();
+		void lock() {
+			int spin_count = 0;
+			while (!try_acquire_writer_flag()) {
+				mse::impl::ns_access_mutex::spin_pause(spin_count);
+			}
+			for (auto& slot : m_reader_slots) {
+				while (0 != slot.m_count.load(std::memory_order_seq_cst)) {
+					mse::impl::ns_access_mutex::spin_pause(spin_count);
 				}
-				typedef std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr_t;
-				const auto& operator*() const/* -> typename std::add_const<typename std::add_lvalue_reference<decltype(*((*std::declval<m_shptr_t>()).cref()))>::type>::type*/ {
-					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
-					return (*((*m_shptr).cref()));
+			}
+		}
+		bool try_lock() {
+			if (!try_acquire_writer_flag()) {
+				return false;
+			}
+			for (auto& slot : m_reader_slots) {
+				if (0 != slot.m_count.load(std::memory_order_seq_cst)) {
+					m_writer.store(false, std::memory_order_release);
+					return false;
 				}
-				const auto operator->() const/* -> typename std::add_const<decltype(std::addressof(*((*std::declval<m_shptr_t>()).cref())))>::type*/ {
-					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
-					return std::addressof(*((*m_shptr).cref()));
+			}
+			return true;
+		}
+		void unlock() {
+			m_writer.store(false, std::memory_order_release);
+		}
+
+		void lock_shared() {
+			int spin_count = 0;
+			while (!try_lock_shared()) {
+				while (m_writer.load(std::memory_order_relaxed)) {
+					mse::impl::ns_access_mutex::spin_pause(spin_count);
 				}
-				void async_not_passable_tag() const {}
-			private:
-				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1) {}
-				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_shared_lock.try_lock()) {
-						m_shptr = nullptr;
-					}
+			}
+		}
+		bool try_lock_shared() {
+			auto& count = m_reader_slots[this_thread_slot_index()].m_count;
+			/* The (sequentially consistent) increment of the counter followed by the check of the writer flag is the
+			mirror image of the writer's setting of the flag followed by checking the counters. So at least one of the
+			two will see the other. */
+			count.fetch_add(1, std::memory_order_seq_cst);
+			if (!m_writer.load(std::memory_order_seq_cst)) {
+				return true;
+			}
+			count.fetch_sub(1, std::memory_order_release);
+			return false;
+		}
+		void unlock_shared() {
+			m_reader_slots[this_thread_slot_index()].m_count.fetch_sub(1, std::memory_order_release);
+		}
+
+	private:
+		bool try_acquire_writer_flag() {
+			bool expected = false;
+			return ((!m_writer.load(std::memory_order_relaxed))
+				&& m_writer.compare_exchange_strong(expected, true, std::memory_order_seq_cst, std::memory_order_relaxed));
+		}
+		static size_t this_thread_slot_index() {
+			return mse::impl::ns_access_mutex::this_thread_round_robin_index() % sc_reader_slot_count;
+		}
+
+		struct reader_slot_t {
+			std::atomic<uint32_t> m_count{ 0 };
+			/* Padding to keep each counter on its own cache line. */
+			char m_padding[mse::impl::sc_cache_line_size - sizeof(std::atomic<uint32_t>)];
+		};
+		reader_slot_t m_reader_slots[sc_reader_slot_count];
+		std::atomic<bool> m_writer{ false };
+	};
+
+	/* instrumented_mutex<> wraps a given mutex type and records, for each mutex object, the number of (exclusive and
+	shared) locks acquired, how many of those had to wait, histograms of the wait and hold times, and the maximum number
+	of threads holding shared locks at the same time. If MSE_ASYNC_LOCK_STATS is defined, the access mutexes of all
+	TAsyncSharedV2 access requesters are instrumented. TAccessControlledObj<>s can be instrumented by specifying
+	instrumented_mutex<> as the access mutex type. The statistics of all (existing) instrumented mutexes can be obtained
+	via lock_stats_snapshots(), lock_stats_text() and lock_stats_json(). */
+
+	namespace impl {
+		namespace ns_lock_stats {
+			/* Histogram bucket i counts durations (in nanoseconds) in the range [2^i, 2^(i+1)), except that bucket 0 also
+			counts zero durations and the last bucket also counts anything longer. */
+			static const size_t sc_histogram_bucket_count = 32;
+
+			inline size_t histogram_bucket_index(uint64_t nanoseconds) {
+				size_t retval = 0;
+				while ((1 < nanoseconds) && (sc_histogram_bucket_count - 1 > retval)) {
+					nanoseconds >>= 1;
+					retval += 1;
 				}
-				template<class _Rep, class _Period>
-				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::duration<_Rep, _Period>& _Rel_time) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_shared_lock.try_lock_for(_Rel_time)) {
-						m_shptr = nullptr;
+				return retval;
+			}
+			inline uint64_t nanoseconds_since(const std::chrono::steady_clock::time_point& start) {
+				const auto duration = std::chrono::steady_clock::now() - start;
+				return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+			}
+			inline void atomic_fetch_max(std::atomic<uint64_t>& target, uint64_t value) {
+				uint64_t current = target.load(std::memory_order_relaxed);
+				while ((current < value) && (!target.compare_exchange_weak(current, value, std::memory_order_relaxed))) {}
+			}
+
+			class lock_stats_record {
+			public:
+				lock_stats_record();
+				~lock_stats_record();
+				lock_stats_record(const lock_stats_record&) = delete;
+				lock_stats_record& operator=(const lock_stats_record&) = delete;
+
+				void record_acquisition(bool is_shared, bool was_contended, uint64_t wait_nanoseconds) {
+					(is_shared ? m_shared_lock_count : m_exclusive_lock_count).fetch_add(1, std::memory_order_relaxed);
+					if (was_contended) {
+						m_contended_lock_count.fetch_add(1, std::memory_order_relaxed);
+						m_total_wait_nanoseconds.fetch_add(wait_nanoseconds, std::memory_order_relaxed);
+						atomic_fetch_max(m_max_wait_nanoseconds, wait_nanoseconds);
 					}
+					m_wait_histogram[histogram_bucket_index(wait_nanoseconds)].fetch_add(1, std::memory_order_relaxed);
 				}
-				template<class _Clock, class _Duration>
-				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_shared_lock.try_lock_until(_Abs_time)) {
-						m_shptr = nullptr;
-					}
+				void record_failed_try() {
+					m_failed_try_count.fetch_add(1, std::memory_order_relaxed);
 				}
-				TAsyncSharedV2ReadWriteConstPointerBase& operator=(const TAsyncSharedV2ReadWriteConstPointerBase& _Right_cref) = delete;
-				TAsyncSharedV2ReadWriteConstPointerBase& operator=(TAsyncSharedV2ReadWriteConstPointerBase&& _Right) = delete;
+				void record_hold(uint64_t hold_nanoseconds) {
+					m_total_hold_nanoseconds.fetch_add(hold_nanoseconds, std::memory_order_relaxed);
+					atomic_fetch_max(m_max_hold_nanoseconds, hold_nanoseconds);
+					m_hold_histogram[histogram_bucket_index(hold_nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+				}
+				void reader_arrived() {
+					const uint64_t readers = m_current_readers.fetch_add(1, std::memory_order_relaxed) + 1;
+					atomic_fetch_max(m_max_concurrent_readers, readers);
+				}
+				void reader_departed() {
+					m_current_readers.fetch_sub(1, std::memory_order_relaxed);
+				}
+				void set_label(const std::string& label);
+
+				std::atomic<uint64_t> m_exclusive_lock_count{ 0 };
+				std::atomic<uint64_t> m_shared_lock_count{ 0 };
+				std::atomic<uint64_t> m_contended_lock_count{ 0 };
+				std::atomic<uint64_t> m_failed_try_count{ 0 };
+				std::atomic<uint64_t> m_total_wait_nanoseconds{ 0 };
+				std::atomic<uint64_t> m_max_wait_nanoseconds{ 0 };
+				std::atomic<uint64_t> m_total_hold_nanoseconds{ 0 };
+				std::atomic<uint64_t> m_max_hold_nanoseconds{ 0 };
+				std::atomic<uint64_t> m_current_readers{ 0 };
+				std::atomic<uint64_t> m_max_concurrent_readers{ 0 };
+				std::atomic<uint64_t> m_wait_histogram[sc_histogram_bucket_count];
+				std::atomic<uint64_t> m_hold_histogram[sc_histogram_bucket_count];
+				/* Guarded by the registry mutex. */
+				std::string m_label;
+			};
 
-				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+			/* The set of existing records. (Intentionally never destroyed, as (static duration) instrumented mutexes
+			may unregister themselves after it otherwise would have been.) */
+			struct lock_stats_registry {
+				std::mutex m_mutex;
+				std::vector<lock_stats_record*> m_records;
+			};
+			inline lock_stats_registry& registry() {
+				static lock_stats_registry* s_registry_ptr = new lock_stats_registry();
+				return *s_registry_ptr;
+			}
 
-				bool is_valid() const {
-					bool retval = m_shptr.operator bool();
-					return retval;
+			inline lock_stats_record::lock_stats_record() {
+				for (auto& count : m_wait_histogram) {
+					count.store(0, std::memory_order_relaxed);
 				}
+				for (auto& count : m_hold_histogram) {
+					count.store(0, std::memory_order_relaxed);
+				}
+				auto& reg = registry();
+				std::lock_guard<std::mutex> lock(reg.m_mutex);
+				reg.m_records.push_back(this);
+			}
+			inline lock_stats_record::~lock_stats_record() {
+				auto& reg = registry();
+				std::lock_guard<std::mutex> lock(reg.m_mutex);
+				auto found_it = std::find(reg.m_records.begin(), reg.m_records.end(), this);
+				if (reg.m_records.end() != found_it) {
+					reg.m_records.erase(found_it);
+				}
+			}
+			inline void lock_stats_record::set_label(const std::string& label) {
+				auto& reg = registry();
+				std::lock_guard<std::mutex> lock(reg.m_mutex);
+				m_label = label;
+			}
 
-				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
-				std::shared_lock<async_shared_timed_mutex_type> m_shared_lock;
-
-				friend class TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>;
-				friend class TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>;
-				friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
+			/* Hold times are measured from the acquisition of a thread's outermost (possibly recursive) lock to its
+			release, so each thread keeps track of the locks it holds. */
+			struct held_lock_t {
+				const lock_stats_record* m_record_ptr;
+				bool m_is_shared;
+				size_t m_depth;
+				std::chrono::steady_clock::time_point m_acquisition_time;
 			};
+			inline std::vector<held_lock_t>& this_thread_held_locks() {
+				thread_local std::vector<held_lock_t> tl_held_locks;
+				return tl_held_locks;
+			}
+			inline void note_acquired(lock_stats_record& record, bool is_shared) {
+				auto& held_locks = this_thread_held_locks();
+				for (auto& held_lock : held_locks) {
+					if ((&record == held_lock.m_record_ptr) && (is_shared == held_lock.m_is_shared)) {
+						held_lock.m_depth += 1;
+						return;
+					}
+				}
+				if (is_shared) {
+					record.reader_arrived();
+				}
+				held_locks.push_back(held_lock_t{ &record, is_shared, 1, std::chrono::steady_clock::now() });
+			}
+			inline void note_released(lock_stats_record& record, bool is_shared) {
+				auto& held_locks = this_thread_held_locks();
+				for (auto it = held_locks.begin(); held_locks.end() != it; ++it) {
+					if ((&record == it->m_record_ptr) && (is_shared == it->m_is_shared)) {
+						it->m_depth -= 1;
+						if (0 == it->m_depth) {
+							record.record_hold(nanoseconds_since(it->m_acquisition_time));
+							if (is_shared) {
+								record.reader_departed();
+							}
+							held_locks.erase(it);
+						}
+						return;
+					}
+				}
+				/* A lock released by a thread other than the one that acquired it isn't timed. */
+			}
+
+			template<typename _TMutex>
+			using nonrecursive_lock_t = decltype(std::declval<_TMutex&>().nonrecursive_lock());
+			template<typename _TMutex>
+			using lock_shared_t = decltype(std::declval<_TMutex&>().lock_shared());
 		}
 	}
 
-	template<typename _TAccessLease>
-	class TXScopeAsyncSharedV2ReadWriteConstPointer : public mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	template<class _TMutex = async_shared_timed_mutex_type>
+	class instrumented_mutex {
 	public:
-		typedef mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease> base_class;
-
-		TXScopeAsyncSharedV2ReadWriteConstPointer(const TXScopeAsyncSharedV2ReadWriteConstPointer& src) = default;
-		TXScopeAsyncSharedV2ReadWriteConstPointer(TXScopeAsyncSharedV2ReadWriteConstPointer&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2ReadWriteConstPointer() {}
-
-		void async_not_passable_tag() const {}
-	private:
-		TXScopeAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TXScopeAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
+		typedef _TMutex base_mutex_type;
+
+		instrumented_mutex() {}
+		instrumented_mutex(const instrumented_mutex&) = delete;
+		instrumented_mutex& operator=(const instrumented_mutex&) = delete;
+
+		void lock() {
+			if (!m_mutex.try_lock()) {
+				const auto start = std::chrono::steady_clock::now();
+				m_mutex.lock();
+				acquired(false, true, mse::impl::ns_lock_stats::nanoseconds_since(start));
+				return;
+			}
+			acquired(false, false, 0);
+		}
+		bool try_lock() {
+			return try_acquired(false, m_mutex.try_lock());
+		}
 		template<class _Rep, class _Period>
-		TXScopeAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
+		bool try_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return try_lock_until(std::chrono::steady_clock::now() + _Rel_time);
+		}
 		template<class _Clock, class _Duration>
-		TXScopeAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
-
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-
-		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
-	};
+		bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			if (m_mutex.try_lock()) {
+				acquired(false, false, 0);
+				return true;
+			}
+			const auto start = std::chrono::steady_clock::now();
+			return timed_acquired(false, m_mutex.try_lock_until(_Abs_time), start);
+		}
+		void unlock() {
+			released(false);
+			m_mutex.unlock();
+		}
 
-	template<typename _TAccessLease>
-	class TAsyncSharedV2ReadWriteConstPointer : public mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease> {
-	public:
-		typedef mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease> base_class;
+		template<class _TMutex2 = _TMutex, class = mse::impl::ns_lock_stats::lock_shared_t<_TMutex2> >
+		void lock_shared() {
+			if (!m_mutex.try_lock_shared()) {
+				const auto start = std::chrono::steady_clock::now();
+				m_mutex.lock_shared();
+				acquired(true, true, mse::impl::ns_lock_stats::nanoseconds_since(start));
+				return;
+			}
+			acquired(true, false, 0);
+		}
+		template<class _TMutex2 = _TMutex, class = mse::impl::ns_lock_stats::lock_shared_t<_TMutex2> >
+		bool try_lock_shared() {
+			return try_acquired(true, m_mutex.try_lock_shared());
+		}
+		template<class _Rep, class _Period>
+		bool try_lock_shared_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return try_lock_shared_until(std::chrono::steady_clock::now() + _Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		bool try_lock_shared_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			if (m_mutex.try_lock_shared()) {
+				acquired(true, false, 0);
+				return true;
+			}
+			const auto start = std::chrono::steady_clock::now();
+			return timed_acquired(true, m_mutex.try_lock_shared_until(_Abs_time), start);
+		}
+		template<class _TMutex2 = _TMutex, class = mse::impl::ns_lock_stats::lock_shared_t<_TMutex2> >
+		void unlock_shared() {
+			released(true);
+			m_mutex.unlock_shared();
+		}
+
+		/* The "nonrecursive" locking functions are only available if the underlying mutex supports them. */
+		template<class _TMutex2 = _TMutex, class = mse::impl::ns_lock_stats::nonrecursive_lock_t<_TMutex2> >
+		void nonrecursive_lock() {
+			if (!m_mutex.try_nonrecursive_lock()) {
+				const auto start = std::chrono::steady_clock::now();
+				m_mutex.nonrecursive_lock();
+				acquired(false, true, mse::impl::ns_lock_stats::nanoseconds_since(start));
+				return;
+			}
+			acquired(false, false, 0);
+		}
+		template<class _TMutex2 = _TMutex, class = mse::impl::ns_lock_stats::nonrecursive_lock_t<_TMutex2> >
+		bool try_nonrecursive_lock() {
+			return try_acquired(false, m_mutex.try_nonrecursive_lock());
+		}
+		template<class _Rep, class _Period>
+		bool try_nonrecursive_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return try_nonrecursive_lock_until(std::chrono::steady_clock::now() + _Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		bool try_nonrecursive_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			if (m_mutex.try_nonrecursive_lock()) {
+				acquired(false, false, 0);
+				return true;
+			}
+			const auto start = std::chrono::steady_clock::now();
+			return timed_acquired(false, m_mutex.try_nonrecursive_lock_until(_Abs_time), start);
+		}
+		template<class _TMutex2 = _TMutex, class = mse::impl::ns_lock_stats::nonrecursive_lock_t<_TMutex2> >
+		void nonrecursive_unlock() {
+			released(false);
+			m_mutex.nonrecursive_unlock();
+		}
 
-		TAsyncSharedV2ReadWriteConstPointer(const TAsyncSharedV2ReadWriteConstPointer& src) = default;
-		TAsyncSharedV2ReadWriteConstPointer(TAsyncSharedV2ReadWriteConstPointer&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadWriteConstPointer() {}
+		/* The label identifies the mutex in the reported statistics. */
+		void set_lock_stats_label(const std::string& label) {
+			m_record.set_label(label);
+		}
 
-		void async_not_passable_tag() const {}
 	private:
-		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
-		template<class _Rep, class _Period>
-		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
-		template<class _Clock, class _Duration>
-		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
+		void acquired(bool is_shared, bool was_contended, uint64_t wait_nanoseconds) {
+			m_record.record_acquisition(is_shared, was_contended, wait_nanoseconds);
+			mse::impl::ns_lock_stats::note_acquired(m_record, is_shared);
+		}
+		bool try_acquired(bool is_shared, bool succeeded) {
+			if (succeeded) {
+				acquired(is_shared, false, 0);
+			}
+			else {
+				m_record.record_failed_try();
+			}
+			return succeeded;
+		}
+		bool timed_acquired(bool is_shared, bool succeeded, const std::chrono::steady_clock::time_point& start) {
+			if (succeeded) {
+				acquired(is_shared, true, mse::impl::ns_lock_stats::nanoseconds_since(start));
+			}
+			else {
+				m_record.record_failed_try();
+			}
+			return succeeded;
+		}
+		void released(bool is_shared) {
+			mse::impl::ns_lock_stats::note_released(m_record, is_shared);
+		}
 
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+		_TMutex m_mutex;
+		mse::impl::ns_lock_stats::lock_stats_record m_record;
+	};
 
-		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
+	namespace impl {
+		/* Instrumented mutexes have the (thread safety) properties of the mutexes they wrap. */
+		template <typename _TMutex> struct is_thread_safety_enforcing_mutex_msemsearray<instrumented_mutex<_TMutex> >
+			: is_thread_safety_enforcing_mutex_msemsearray<_TMutex> {};
+		template <typename _TMutex> struct is_exclusive_writer_enforcing_mutex_msemsearray<instrumented_mutex<_TMutex> >
+			: is_exclusive_writer_enforcing_mutex_msemsearray<_TMutex> {};
+		template <typename _TMutex> struct is_supported_aco_mutex_msemsearray<instrumented_mutex<_TMutex> >
+			: is_supported_aco_mutex_msemsearray<_TMutex> {};
+
+		namespace ns_lock_stats {
+			template<typename _TMutex>
+			void set_label(_TMutex&, const std::string&) {}
+			template<typename _TMutex>
+			void set_label(instrumented_mutex<_TMutex>& mutex, const std::string& label) {
+				mutex.set_lock_stats_label(label);
+			}
+		}
+	}
+
+	struct lock_stats_snapshot {
+		std::string label;
+		const void* address = nullptr;
+		uint64_t exclusive_lock_count = 0;
+		uint64_t shared_lock_count = 0;
+		/* The number of acquisitions that had to wait for the lock. */
+		uint64_t contended_lock_count = 0;
+		/* The number of "try lock" attempts that failed (or timed out). */
+		uint64_t failed_try_count = 0;
+		uint64_t total_wait_nanoseconds = 0;
+		uint64_t max_wait_nanoseconds = 0;
+		uint64_t total_hold_nanoseconds = 0;
+		uint64_t max_hold_nanoseconds = 0;
+		uint64_t max_concurrent_readers = 0;
+		/* See mse::impl::ns_lock_stats::sc_histogram_bucket_count for the bucket ranges. */
+		std::vector<uint64_t> wait_histogram;
+		std::vector<uint64_t> hold_histogram;
 	};
 
-	namespace us {
-		namespace impl {
-			template<typename _TAccessLease>
-			class TAsyncSharedV2ExclusiveReadWritePointerBase : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotPassableTagBase, public mse::us::impl::StrongExclusivePointerTagBase {
-			public:
-				TAsyncSharedV2ExclusiveReadWritePointerBase(const TAsyncSharedV2ExclusiveReadWritePointerBase& src) = delete;
-				TAsyncSharedV2ExclusiveReadWritePointerBase(TAsyncSharedV2ExclusiveReadWritePointerBase&& src) = default;
-				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ExclusiveReadWritePointerBase() {}
+	/* Returns the statistics of all existing instrumented mutexes, in order of construction. */
+	inline std::vector<lock_stats_snapshot> lock_stats_snapshots() {
+		std::vector<lock_stats_snapshot> retval;
+		auto& reg = mse::impl::ns_lock_stats::registry();
+		std::lock_guard<std::mutex> lock(reg.m_mutex);
+		retval.reserve(reg.m_records.size());
+		for (const auto record_ptr : reg.m_records) {
+			const auto& record = *record_ptr;
+			lock_stats_snapshot snapshot;
+			snapshot.label = record.m_label;
+			snapshot.address = record_ptr;
+			snapshot.exclusive_lock_count = record.m_exclusive_lock_count.load(std::memory_order_relaxed);
+			snapshot.shared_lock_count = record.m_shared_lock_count.load(std::memory_order_relaxed);
+			snapshot.contended_lock_count = record.m_contended_lock_count.load(std::memory_order_relaxed);
+			snapshot.failed_try_count = record.m_failed_try_count.load(std::memory_order_relaxed);
+			snapshot.total_wait_nanoseconds = record.m_total_wait_nanoseconds.load(std::memory_order_relaxed);
+			snapshot.max_wait_nanoseconds = record.m_max_wait_nanoseconds.load(std::memory_order_relaxed);
+			snapshot.total_hold_nanoseconds = record.m_total_hold_nanoseconds.load(std::memory_order_relaxed);
+			snapshot.max_hold_nanoseconds = record.m_max_hold_nanoseconds.load(std::memory_order_relaxed);
+			snapshot.max_concurrent_readers = record.m_max_concurrent_readers.load(std::memory_order_relaxed);
+			for (const auto& count : record.m_wait_histogram) {
+				snapshot.wait_histogram.push_back(count.load(std::memory_order_relaxed));
+			}
+			for (const auto& count : record.m_hold_histogram) {
+				snapshot.hold_histogram.push_back(count.load(std::memory_order_relaxed));
+			}
+			retval.push_back(std::move(snapshot));
+		}
+		return retval;
+	}
 
-				operator bool() const {
-					//assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ExclusiveReadWritePointerBase")); }
-					return m_shptr.operator bool();
-				}
-				typedef std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr_t;
-				auto& operator*() const/* -> typename std::add_lvalue_reference<decltype(*((*std::declval<m_shptr_t>()).cref()))>::type*/ {
-					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
-					return (*((*m_shptr).cref()));
-				}
-				auto operator->() const/* -> decltype(std::addressof(*((*std::declval<m_shptr_t>()).cref())))*/ {
-					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
-					return std::addressof(*((*m_shptr).cref()));
-				}
-				void async_shareable_and_passable_tag() const {}
-			private:
-				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1) {}
-				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_unique_lock.try_lock()) {
-						m_shptr = nullptr;
+	namespace impl {
+		namespace ns_lock_stats {
+			inline std::string address_string(const void* address) {
+				char buffer[2 + 2 * sizeof(uintptr_t) + 1];
+				const char* digits = "0123456789abcdef";
+				auto value = reinterpret_cast<uintptr_t>(address);
+				size_t index = sizeof(buffer) - 1;
+				buffer[index] = '\0';
+				do {
+					index -= 1;
+					buffer[index] = digits[value & 0xf];
+					value >>= 4;
+				} while ((0 != value) && (2 < index));
+				buffer[--index] = 'x';
+				buffer[--index] = '0';
+				return std::string(buffer + index);
+			}
+			inline std::string json_string(const std::string& str) {
+				std::string retval = "\"";
+				for (const char ch : str) {
+					if (('"' == ch) || ('\\' == ch)) {
+						retval += '\\';
+						retval += ch;
 					}
-				}
-				template<class _Rep, class _Period>
-				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::duration<_Rep, _Period>& _Rel_time) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_unique_lock.try_lock_for(_Rel_time)) {
-						m_shptr = nullptr;
+					else if (0x20 > static_cast<unsigned char>(ch)) {
+						const char* digits = "0123456789abcdef";
+						retval += "\\u00";
+						retval += digits[(static_cast<unsigned char>(ch) >> 4) & 0xf];
+						retval += digits[static_cast<unsigned char>(ch) & 0xf];
+					}
+					else {
+						retval += ch;
 					}
 				}
-				template<class _Clock, class _Duration>
-				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_unique_lock.try_lock_until(_Abs_time)) {
-						m_shptr = nullptr;
+				retval += '"';
+				return retval;
+			}
+			inline std::string json_array(const std::vector<uint64_t>& values) {
+				std::string retval = "[";
+				for (size_t i = 0; values.size() > i; i += 1) {
+					retval += ((0 == i) ? "" : ",") + std::to_string(values[i]);
+				}
+				retval += ']';
+				return retval;
+			}
+			/* Lists the non-empty buckets as "<lower bound>ns:<count>". */
+			inline std::string text_histogram(const std::vector<uint64_t>& values) {
+				std::string retval;
+				for (size_t i = 0; values.size() > i; i += 1) {
+					if (0 != values[i]) {
+						retval += " " + std::to_string((0 == i) ? uint64_t(0) : (uint64_t(1) << i)) + "ns:" + std::to_string(values[i]);
 					}
 				}
-				TAsyncSharedV2ExclusiveReadWritePointerBase& operator=(const TAsyncSharedV2ExclusiveReadWritePointerBase& _Right_cref) = delete;
-				TAsyncSharedV2ExclusiveReadWritePointerBase& operator=(TAsyncSharedV2ExclusiveReadWritePointerBase&& _Right) = delete;
-
-				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+				return retval;
+			}
+		}
+	}
 
-				bool is_valid() const {
-					bool retval = m_shptr.operator bool();
-					return retval;
-				}
+	/* A human readable summary of the statistics of all existing instrumented mutexes. */
+	inline std::string lock_stats_text() {
+		using namespace mse::impl::ns_lock_stats;
+		std::string retval;
+		for (const auto& snapshot : lock_stats_snapshots()) {
+			const auto lock_count = snapshot.exclusive_lock_count + snapshot.shared_lock_count;
+			retval += (snapshot.label.empty() ? std::string("(unlabeled)") : snapshot.label) + " [" + address_string(snapshot.address) + "]\n";
+			retval += "  locks: " + std::to_string(lock_count) + " (exclusive: " + std::to_string(snapshot.exclusive_lock_count)
+				+ ", shared: " + std::to_string(snapshot.shared_lock_count) + "), contended: " + std::to_string(snapshot.contended_lock_count)
+				+ ", failed tries: " + std::to_string(snapshot.failed_try_count)
+				+ ", max concurrent readers: " + std::to_string(snapshot.max_concurrent_readers) + "\n";
+			retval += "  wait: total " + std::to_string(snapshot.total_wait_nanoseconds) + "ns, max " + std::to_string(snapshot.max_wait_nanoseconds)
+				+ "ns, histogram:" + text_histogram(snapshot.wait_histogram) + "\n";
+			retval += "  hold: total " + std::to_string(snapshot.total_hold_nanoseconds) + "ns, max " + std::to_string(snapshot.max_hold_nanoseconds)
+				+ "ns, histogram:" + text_histogram(snapshot.hold_histogram) + "\n";
+		}
+		return retval;
+	}
 
-				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
-				unique_nonrecursive_lock<async_shared_timed_mutex_type> m_unique_lock;
+	/* The statistics of all existing instrumented mutexes as a JSON array. Histogram element i counts durations in the
+	range [2^i, 2^(i+1)) nanoseconds. */
+	inline std::string lock_stats_json() {
+		using namespace mse::impl::ns_lock_stats;
+		std::string retval = "[";
+		bool is_first = true;
+		for (const auto& snapshot : lock_stats_snapshots()) {
+			retval += is_first ? "\n" : ",\n";
+			is_first = false;
+			retval += "{\"label\":" + json_string(snapshot.label)
+				+ ",\"address\":" + json_string(address_string(snapshot.address))
+				+ ",\"exclusive_lock_count\":" + std::to_string(snapshot.exclusive_lock_count)
+				+ ",\"shared_lock_count\":" + std::to_string(snapshot.shared_lock_count)
+				+ ",\"contended_lock_count\":" + std::to_string(snapshot.contended_lock_count)
+				+ ",\"failed_try_count\":" + std::to_string(snapshot.failed_try_count)
+				+ ",\"total_wait_ns\":" + std::to_string(snapshot.total_wait_nanoseconds)
+				+ ",\"max_wait_ns\":" + std::to_string(snapshot.max_wait_nanoseconds)
+				+ ",\"total_hold_ns\":" + std::to_string(snapshot.total_hold_nanoseconds)
+				+ ",\"max_hold_ns\":" + std::to_string(snapshot.max_hold_nanoseconds)
+				+ ",\"max_concurrent_readers\":" + std::to_string(snapshot.max_concurrent_readers)
+				+ ",\"wait_histogram\":" + json_array(snapshot.wait_histogram)
+				+ ",\"hold_histogram\":" + json_array(snapshot.hold_histogram) + "}";
+		}
+		retval += is_first ? "]" : "\n]";
+		return retval;
+	}
 
-				friend class TXScopeAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>;
-				friend class TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>;
-				friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
+	namespace impl {
+		namespace ns_access_mutex {
+			/* The access mutex type used by the access requesters for a given access lease type. Lease types can specify
+			one via an "async_shared_access_mutex_type" member type. */
+			template<typename _TAccessLease, typename = void>
+			struct specified_access_lease_mutex {
+				typedef async_shared_timed_mutex_type type;
+			};
+			template<typename _TAccessLease>
+			struct specified_access_lease_mutex<_TAccessLease, mse::impl::void_t<typename _TAccessLease::async_shared_access_mutex_type> > {
+				typedef typename _TAccessLease::async_shared_access_mutex_type type;
+			};
+#ifdef MSE_ASYNC_LOCK_STATS
+			template<typename _TMutex>
+			struct instrumented_mutex_of {
+				typedef instrumented_mutex<_TMutex> type;
+			};
+			template<typename _TMutex>
+			struct instrumented_mutex_of<instrumented_mutex<_TMutex> > {
+				typedef instrumented_mutex<_TMutex> type;
+			};
+			template<typename _TAccessLease>
+			struct access_lease_mutex {
+				typedef typename instrumented_mutex_of<typename specified_access_lease_mutex<_TAccessLease>::type>::type type;
 			};
+#else // MSE_ASYNC_LOCK_STATS
+			template<typename _TAccessLease>
+			struct access_lease_mutex : specified_access_lease_mutex<_TAccessLease> {};
+#endif // MSE_ASYNC_LOCK_STATS
 		}
 	}
 
-	template<typename _TAccessLease>
-	class TXScopeAsyncSharedV2ExclusiveReadWritePointer : public mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
-	public:
-		typedef mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease> base_class;
-
-		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const TXScopeAsyncSharedV2ExclusiveReadWritePointer& src) = delete;
-		TXScopeAsyncSharedV2ExclusiveReadWritePointer(TXScopeAsyncSharedV2ExclusiveReadWritePointer&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2ExclusiveReadWritePointer() {}
-
-		void async_not_passable_tag() const {}
-	private:
-		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
-		template<class _Rep, class _Period>
-		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
-		template<class _Clock, class _Duration>
-		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
-
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-
-		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
-	};
-
-	template<typename _TAccessLease>
-	class TAsyncSharedV2ExclusiveReadWritePointer : public mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease> {
-	public:
-		typedef mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease> base_class;
-
-		TAsyncSharedV2ExclusiveReadWritePointer(const TAsyncSharedV2ExclusiveReadWritePointer& src) = delete;
-		TAsyncSharedV2ExclusiveReadWritePointer(TAsyncSharedV2ExclusiveReadWritePointer&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ExclusiveReadWritePointer() {}
-
-		void async_not_passable_tag() const {}
-	private:
-		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
-		template<class _Rep, class _Period>
-		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
-		template<class _Clock, class _Duration>
-		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
-
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-
-		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
-	};
 
 	namespace us {
 		namespace impl {
-			template<typename _TAccessLease>
-			class TAsyncSharedV2XWPReadWriteAccessRequesterBase {
-			public:
-				TAsyncSharedV2XWPReadWriteAccessRequesterBase(const TAsyncSharedV2XWPReadWriteAccessRequesterBase& src_cref) = default;
-				TAsyncSharedV2XWPReadWriteAccessRequesterBase(_TAccessLease&& exclusive_write_pointer) {
-					m_shptr = std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease> >(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer));
-				}
-				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2XWPReadWriteAccessRequesterBase() {
-					valid_if_TAccessLease_is_marked_as_an_exclusive_pointer();
-					valid_if_TAccessLease_is_marked_as_a_strong_pointer();
-				}
+			template<typename _TAccessLease> class TAsyncSharedV2XWPReadWriteAccessRequesterBase;
+			template<typename _TAccessLease> class TAsyncSharedV2ReadWritePointerBase;
+			template<typename _TAccessLease> class TAsyncSharedV2ReadWriteConstPointerBase;
+			template<typename _TAccessLease> class TAsyncSharedV2ExclusiveReadWritePointerBase;
+			template<typename _TAccessLease> class TAsyncSharedV2XWPReadOnlyAccessRequesterBase;
+			template<typename _TAccessLease> class TAsyncSharedV2ReadOnlyConstPointerBase;
+		}
+	}
 
-				TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease> xscope_writelock_ptr() const {
-					return TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr);
-				}
-				mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>> xscope_try_writelock_ptr() const {
-					mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>> retval(TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr, std::try_to_lock));
-					if (!((*retval).is_valid())) {
-						return{};
+	template<typename _TAccessLease> class TXScopeAsyncSharedV2XWPReadWriteAccessRequester;
+	template<typename _TAccessLease> class TXScopeAsyncSharedV2ReadWritePointer;
+	template<typename _TAccessLease> class TXScopeAsyncSharedV2ReadWriteConstPointer;
+	template<typename _TAccessLease> class TXScopeAsyncSharedV2ExclusiveReadWritePointer;
+	template<typename _TAccessLease> class TXScopeAsyncSharedV2XWPReadOnlyAccessRequester;
+	template<typename _TAccessLease> class TXScopeAsyncSharedV2ReadOnlyConstPointer;
+
+	template<typename _TAccessLease> class TAsyncSharedV2XWPReadWriteAccessRequester;
+	template<typename _TAccessLease> class TAsyncSharedV2ReadWritePointer;
+	template<typename _TAccessLease> class TAsyncSharedV2ReadWriteConstPointer;
+	template<typename _TAccessLease> class TAsyncSharedV2ExclusiveReadWritePointer;
+	template<typename _TAccessLease> class TAsyncSharedV2XWPReadOnlyAccessRequester;
+	template<typename _TAccessLease> class TAsyncSharedV2ReadOnlyConstPointer;
+
+	/* Asynchronous (non-blocking) lock requests (i.e. async_writelock_ptr() and async_readlock_ptr()) are only available if
+	MSE_ASYNC_LOCK_REQUESTS is defined. Supporting them adds some bookkeeping to the acquisition and release of every lock
+	pointer, so if the symbol isn't defined, lock pointers don't incur that cost. */
+	namespace impl {
+		namespace ns_async_lock {
+#ifdef MSE_ASYNC_LOCK_REQUESTS
+			/* Each thread keeps its own (typically very short) list of the (access lease) mutexes on which it holds locks
+			(via lock pointers), so that a thread doesn't service queued asynchronous lock requests while it holds a lock
+			on the same object. (With a recursive mutex, the queued request's "try lock" would succeed, and its function
+			would be executed in the middle of the thread's critical section.) */
+			struct thread_lock_record {
+				const void* m_mutex_ptr;
+				size_t m_count;
+			};
+			inline std::vector<thread_lock_record>& thread_lock_records() {
+				thread_local std::vector<thread_lock_record> tl_records;
+				return tl_records;
+			}
+			inline void add_this_thread_lock_record(const void* mutex_ptr) {
+				auto& records = thread_lock_records();
+				for (auto& record : records) {
+					if (mutex_ptr == record.m_mutex_ptr) {
+						record.m_count += 1;
+						return;
 					}
-					return retval;
 				}
-				template<class _Rep, class _Period>
-				mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>> xscope_try_writelock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-					mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>> retval(TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr, std::try_to_lock, _Rel_time));
-					if (!((*retval).is_valid())) {
-						return{};
+				records.push_back(thread_lock_record{ mutex_ptr, 1 });
+			}
+			inline void remove_this_thread_lock_record(const void* mutex_ptr) {
+				auto& records = thread_lock_records();
+				for (auto it = records.begin(); records.end() != it; it++) {
+					if (mutex_ptr == it->m_mutex_ptr) {
+						it->m_count -= 1;
+						if (0 == it->m_count) {
+							records.erase(it);
+						}
+						return;
 					}
-					return retval;
 				}
-				template<class _Clock, class _Duration>
-				mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>> xscope_try_writelock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-					mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>> retval(TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr, std::try_to_lock, _Abs_time));
-					if (!((*retval).is_valid())) {
-						return{};
+				assert(false);
+			}
+			inline bool this_thread_holds_a_lock_on(const void* mutex_ptr) {
+				for (const auto& record : thread_lock_records()) {
+					if (mutex_ptr == record.m_mutex_ptr) {
+						return true;
 					}
-					return retval;
 				}
-				TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease> xscope_readlock_ptr() const {
-					return TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr);
+				return false;
+			}
+
+			/* A lock (std::unique_lock<>, std::shared_lock<> or unique_nonrecursive_lock<>) that maintains the current
+			thread's lock records. (Lock pointers aren't passable between threads, so the thread that releases the lock is
+			the one that obtained it.) */
+			template<typename _TLock>
+			class thread_recorded_lock : public _TLock {
+			public:
+				typedef _TLock base_class;
+				typedef typename base_class::mutex_type mutex_type;
+
+				explicit thread_recorded_lock(mutex_type& mutex_ref) : base_class(mutex_ref) {
+					add_this_thread_lock_record(std::addressof(mutex_ref));
 				}
-				mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> xscope_try_readlock_ptr() const {
-					mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> retval(TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr, std::try_to_lock));
-					if (!((*retval).is_valid())) {
-						return{};
+				thread_recorded_lock(mutex_type& mutex_ref, std::defer_lock_t) : base_class(mutex_ref, std::defer_lock) {}
+				thread_recorded_lock(thread_recorded_lock&& src) = default;
+				~thread_recorded_lock() {
+					if (base_class::owns_lock()) {
+						remove_this_thread_lock_record(base_class::mutex());
 					}
-					return retval;
+				}
+
+				void lock() {
+					base_class::lock();
+					add_this_thread_lock_record(base_class::mutex());
+				}
+				bool try_lock() {
+					return record_if(base_class::try_lock());
 				}
 				template<class _Rep, class _Period>
-				mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> xscope_try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-					mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> retval(TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr, std::try_to_lock, _Rel_time));
-					if (!((*retval).is_valid())) {
-						return{};
-					}
-					return retval;
+				bool try_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+					return record_if(base_class::try_lock_for(_Rel_time));
 				}
 				template<class _Clock, class _Duration>
-				mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> xscope_try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-					mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> retval(TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr, std::try_to_lock, _Abs_time));
-					if (!((*retval).is_valid())) {
-						return{};
-					}
-					return retval;
+				bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+					return record_if(base_class::try_lock_until(_Abs_time));
 				}
-				/* Note that an exclusive_writelock_ptr cannot coexist with any other lock_ptrs (targeting the same object), including ones in
-				the same thread. Thus, using exclusive_writelock_ptrs without sufficient care introduces the potential for exceptions (in a way
-				that sticking to (regular) writelock_ptrs doesn't). */
-				TXScopeAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease> xscope_exclusive_writelock_ptr() const {
-					return TXScopeAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>(m_shptr);
-				}
-				auto xscope_exclusive_pointer() const {
-					return xscope_exclusive_writelock_ptr();
+				void unlock() {
+					base_class::unlock();
+					remove_this_thread_lock_record(base_class::mutex());
 				}
 
-				static TAsyncSharedV2XWPReadWriteAccessRequesterBase make(_TAccessLease&& exclusive_write_pointer) {
-					return TAsyncSharedV2XWPReadWriteAccessRequesterBase(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
+			private:
+				thread_recorded_lock& operator=(thread_recorded_lock&&) = delete;
+				bool record_if(bool obtained) {
+					if (obtained) {
+						add_this_thread_lock_record(base_class::mutex());
+					}
+					return obtained;
 				}
+			};
 
-				void async_shareable_and_passable_tag() const {}
-
-			protected:
-				TAsyncSharedV2ReadWritePointer<_TAccessLease> writelock_ptr() const {
-					return TAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr);
-				}
-				mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr() const {
-					mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> retval(TAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr, std::try_to_lock));
-					if (!((*retval).is_valid())) {
-						return{};
+			/* A queued asynchronous lock request. */
+			class waiter_base {
+			public:
+				virtual ~waiter_base() {}
+				/* Attempts (without blocking) to obtain the requested lock. If successful, the request's function is invoked
+				(with the lock pointer) and true is returned. */
+				virtual bool try_complete() = 0;
+			};
+			template<typename _TTryLockFunction, typename _TResult, typename _TPointer>
+			class waiter : public waiter_base {
+			public:
+				waiter(_TTryLockFunction&& try_lock_function, std::packaged_task<_TResult(_TPointer&)>&& task)
+					: m_try_lock_function(std::forward<_TTryLockFunction>(try_lock_function)), m_task(std::move(task)) {}
+				bool try_complete() override {
+					auto ptr = m_try_lock_function();
+					if (!ptr) {
+						return false;
 					}
-					return retval;
+					/* Any exception thrown by the function is delivered via the future. */
+					m_task(ptr);
+					return true;
 				}
-				template<class _Rep, class _Period>
-				mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-					mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> retval(TAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr, std::try_to_lock, _Rel_time));
-					if (!((*retval).is_valid())) {
-						return{};
-					}
-					return retval;
+			private:
+				_TTryLockFunction m_try_lock_function;
+				std::packaged_task<_TResult(_TPointer&)> m_task;
+			};
+
+			/* Asynchronous lock requests are queued (in FIFO order) and serviced whenever a lock (on the same shared object) is
+			released. Only one thread services the queue at a time. A thread that finds the queue already being serviced
+			just flags that another pass is needed and returns, so releasing a lock never blocks on the queue. A thread
+			that (still) holds a lock on the object doesn't service the queue. It will do so once it releases its last
+			lock on the object. */
+			class waiter_queue {
+			public:
+				explicit waiter_queue(const void* mutex_ptr) : m_mutex_ptr(mutex_ptr) {}
+
+				template<typename _TTryLockFunction, typename _TFunction>
+				auto enqueue(_TTryLockFunction try_lock_function, _TFunction&& func) {
+					typedef decltype(try_lock_function()) pointer_t;
+					typedef decltype(func(std::declval<pointer_t&>())) result_t;
+					std::packaged_task<result_t(pointer_t&)> task(std::forward<_TFunction>(func));
+					auto future = task.get_future();
+					push(std::make_unique<waiter<_TTryLockFunction, result_t, pointer_t> >(std::move(try_lock_function), std::move(task)));
+					return future;
 				}
-				template<class _Clock, class _Duration>
-				mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-					mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> retval(TAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr, std::try_to_lock, _Abs_time));
-					if (!((*retval).is_valid())) {
-						return{};
+
+				/* Called after a lock has been released. */
+				void notify_lock_released() {
+					/* This (sequentially consistent) fence (following the release of the lock) is the mirror image of the
+					increment of the waiter count (preceding the first attempt to service a new request) in push(). So either
+					this thread will see the new request or the request's first attempt will see the released lock. */
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					if (0 != m_waiter_count.load(std::memory_order_relaxed)) {
+						service();
 					}
-					return retval;
-				}
-				TAsyncSharedV2ReadWriteConstPointer<_TAccessLease> readlock_ptr() const {
-					return TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr);
 				}
-				mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr() const {
-					mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> retval(TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr, std::try_to_lock));
-					if (!((*retval).is_valid())) {
-						return{};
+
+			private:
+				void push(std::unique_ptr<waiter_base>&& waiter_uqptr) {
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_waiters.push_back(std::move(waiter_uqptr));
+						m_waiter_count.fetch_add(1, std::memory_order_seq_cst);
 					}
-					return retval;
+					service();
 				}
-				template<class _Rep, class _Period>
-				mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-					mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> retval(TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr, std::try_to_lock, _Rel_time));
-					if (!((*retval).is_valid())) {
-						return{};
+				void service() {
+					if (this_thread_holds_a_lock_on(m_mutex_ptr)) {
+						return;
 					}
-					return retval;
-				}
-				template<class _Clock, class _Duration>
-				mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-					mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> retval(TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr, std::try_to_lock, _Abs_time));
-					if (!((*retval).is_valid())) {
-						return{};
+					m_service_requested.store(true, std::memory_order_seq_cst);
+					while (m_service_requested.load(std::memory_order_seq_cst)) {
+						bool expected = false;
+						if (!m_is_being_serviced.compare_exchange_strong(expected, true, std::memory_order_seq_cst)) {
+							/* The thread servicing the queue will do another pass. */
+							return;
+						}
+						m_service_requested.store(false, std::memory_order_seq_cst);
+						while (true) {
+							waiter_base* front_ptr = nullptr;
+							{
+								std::lock_guard<std::mutex> lock(m_mutex);
+								if (m_waiters.empty()) {
+									break;
+								}
+								/* Only the servicing thread removes elements, so the front element remains valid. */
+								front_ptr = m_waiters.front().get();
+							}
+							if (!front_ptr->try_complete()) {
+								break;
+							}
+							std::unique_ptr<waiter_base> completed_waiter_uqptr;
+							{
+								std::lock_guard<std::mutex> lock(m_mutex);
+								completed_waiter_uqptr = std::move(m_waiters.front());
+								m_waiters.pop_front();
+								m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+							}
+						}
+						m_is_being_serviced.store(false, std::memory_order_seq_cst);
 					}
-					return retval;
-				}
-				/* Note that an exclusive_writelock_ptr cannot coexist with any other lock_ptrs (targeting the same object), including ones in
-				the same thread. Thus, using exclusive_writelock_ptrs without sufficient care introduces the potential for exceptions (in a way
-				that sticking to (regular) writelock_ptrs doesn't). */
-				TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease> exclusive_writelock_ptr() const {
-					return TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>(m_shptr);
 				}
-				auto exclusive_pointer() const {
-					return exclusive_writelock_ptr();
-				}
-
-			private:
-				TAsyncSharedV2XWPReadWriteAccessRequesterBase(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : m_shptr(shptr) {}
-				TAsyncSharedV2XWPReadWriteAccessRequesterBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : m_shptr(std::forward<decltype(shptr)>(shptr)) {}
-
-				template<class _Ty2 = _TAccessLease, class = typename std::enable_if<(std::is_same<_Ty2, _TAccessLease>::value) && (std::is_base_of<mse::us::impl::ExclusivePointerTagBase, _TAccessLease>::value), void>::type>
-				void valid_if_TAccessLease_is_marked_as_an_exclusive_pointer() const {}
-
-#if !defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_REFCOUNTINGPOINTER_DISABLED) && !defined(MSE_NORADPOINTER_DISABLED)
-				template<class _Ty2 = _TAccessLease, class = typename std::enable_if<(std::is_same<_Ty2, _TAccessLease>::value) && (std::is_base_of<mse::us::impl::StrongPointerTagBase, _TAccessLease>::value), void>::type>
-#endif /*!defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_REFCOUNTINGPOINTER_DISABLED) && !defined(MSE_NORADPOINTER_DISABLED)*/
-				void valid_if_TAccessLease_is_marked_as_a_strong_pointer() const {}
-
-				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-
-				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
 
-				friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
-				friend class TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>;
-				friend class TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>;
+				const void* m_mutex_ptr = nullptr;
+				std::mutex m_mutex;
+				std::deque<std::unique_ptr<waiter_base> > m_waiters;
+				std::atomic<size_t> m_waiter_count{ 0 };
+				std::atomic<bool> m_is_being_serviced{ false };
+				std::atomic<bool> m_service_requested{ false };
 			};
+#else // MSE_ASYNC_LOCK_REQUESTS
+			template<typename _TLock>
+			using thread_recorded_lock = _TLock;
+#endif // MSE_ASYNC_LOCK_REQUESTS
 		}
 	}
 
-	template<typename _TAccessLease>
-	class TXScopeAsyncSharedV2XWPReadWriteAccessRequester : public mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	template <typename _TAccessLease>
+	class TAsyncSharedXWPAccessLeaseObj {
 	public:
-		typedef mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease> base_class;
-		typedef typename std::remove_reference<decltype(*std::declval<_TAccessLease>())>::type target_type;
-		TXScopeAsyncSharedV2XWPReadWriteAccessRequester(const TXScopeAsyncSharedV2XWPReadWriteAccessRequester& src_cref) = default;
-		TXScopeAsyncSharedV2XWPReadWriteAccessRequester(_TAccessLease&& exclusive_write_pointer) : base_class(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)) {}
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2XWPReadWriteAccessRequester() {
-			valid_if_target_type_is_marked_as_xscope_shareable();
-		}
+		typedef typename mse::impl::ns_access_mutex::access_lease_mutex<_TAccessLease>::type mutex_type;
 
-		/* Prefer the "xscope_" prefixed versions to acknowledge that scope iterators are returned. */
-		auto writelock_ptr() const {
-			return base_class::xscope_writelock_ptr();
-		}
-		auto try_writelock_ptr() const {
-			return base_class::xscope_try_writelock_ptr();
-		}
-		template<class _Rep, class _Period>
-		auto try_writelock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-			return base_class::xscope_try_writelock_ptr_for(_Rel_time);
-		}
-		template<class _Clock, class _Duration>
-		auto try_writelock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-			return base_class::xscope_try_writelock_ptr_until(_Abs_time);
-		}
-		auto readlock_ptr() const {
-			return base_class::xscope_readlock_ptr();
-		}
-		auto try_readlock_ptr() const {
-			return base_class::xscope_try_readlock_ptr();
-		}
-		template<class _Rep, class _Period>
-		auto try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-			return base_class::xscope_try_readlock_ptr_for(_Rel_time);
+#ifdef MSE_ASYNC_LOCK_REQUESTS
+		TAsyncSharedXWPAccessLeaseObj(_TAccessLease&& access_lease)
+			: m_access_lease(std::forward<_TAccessLease>(access_lease)), m_waiter_queue(std::addressof(m_mutex1)) {}
+#else // MSE_ASYNC_LOCK_REQUESTS
+		TAsyncSharedXWPAccessLeaseObj(_TAccessLease&& access_lease)
+			: m_access_lease(std::forward<_TAccessLease>(access_lease)) {}
+#endif // MSE_ASYNC_LOCK_REQUESTS
+		const _TAccessLease& cref() const {
+			return m_access_lease;
 		}
-		template<class _Clock, class _Duration>
-		auto try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-			return base_class::xscope_try_readlock_ptr_until(_Abs_time);
+		mutex_type& mutex_ref() const {
+			return m_mutex1;
 		}
-		auto exclusive_writelock_ptr() const {
-			return base_class::xscope_exclusive_writelock_ptr();
+
+#ifdef MSE_ASYNC_LOCK_REQUESTS
+		/* Queues a request for a lock (obtained via the given "try lock" function) and returns a future for the result of
+		invoking the given function with the lock pointer. The function is invoked as soon as the lock becomes available,
+		in whichever thread releases the lock that was preventing it (or in the current thread if the lock is available
+		immediately). */
+		template<typename _TTryLockFunction, typename _TFunction>
+		auto enqueue_async_lock_request(_TTryLockFunction try_lock_function, _TFunction&& func) const {
+			return m_waiter_queue.enqueue(std::move(try_lock_function), std::forward<_TFunction>(func));
 		}
-		auto exclusive_pointer() const {
-			return exclusive_writelock_ptr();
+		void notify_lock_released() const {
+			m_waiter_queue.notify_lock_released();
 		}
+#else // MSE_ASYNC_LOCK_REQUESTS
+		void notify_lock_released() const {}
+#endif // MSE_ASYNC_LOCK_REQUESTS
 
-		static TXScopeAsyncSharedV2XWPReadWriteAccessRequester make(_TAccessLease&& exclusive_write_pointer) {
-			return TXScopeAsyncSharedV2XWPReadWriteAccessRequester(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
-		}
+	private:
+		_TAccessLease m_access_lease;
 
-		void xscope_async_shareable_and_passable_tag() const {}
+		mutable mutex_type m_mutex1;
+#ifdef MSE_ASYNC_LOCK_REQUESTS
+		mutable mse::impl::ns_async_lock::waiter_queue m_waiter_queue;
+#endif // MSE_ASYNC_LOCK_REQUESTS
 
-	private:
-		TXScopeAsyncSharedV2XWPReadWriteAccessRequester(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TXScopeAsyncSharedV2XWPReadWriteAccessRequester(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : base_class(std::forward<decltype(shptr)>(shptr)) {}
-		TXScopeAsyncSharedV2XWPReadWriteAccessRequester& operator=(const TXScopeAsyncSharedV2XWPReadWriteAccessRequester& _Right_cref) = delete;
-
-		/* If the target type is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
-		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
-		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
-		template<class _target_type2 = target_type, class = typename std::enable_if<(std::is_same<_target_type2, target_type>::value)
-			&& (mse::impl::is_marked_as_xscope_shareable_msemsearray<_target_type2>::value), void>::type>
-		void valid_if_target_type_is_marked_as_xscope_shareable() const {}
-
-		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
-	};
-
-	template<typename _TAccessLease, class = MSE_IMPL_ENABLE_IF_NOT_RETURNABLE_FPARAM(_TAccessLease)>
-	auto make_xscope_asyncsharedv2xwpreadwrite(_TAccessLease&& exclusive_write_pointer) {
-		return TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>::make(std::forward<_TAccessLease>(exclusive_write_pointer));
-	}
-	/* Overloads for rsv::TReturnableFParam<>. */
-	MSE_OVERLOAD_FOR_RETURNABLE_FPARAM_DECLARATION(make_xscope_asyncsharedv2xwpreadwrite)
-
-	template<typename _TAccessLease> class TAsyncSharedV2XWPWeakReadWriteAccessRequester;
-
-	template<typename _TAccessLease>
-	class TAsyncSharedV2XWPReadWriteAccessRequester : public mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease> {
-	public:
-		typedef mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease> base_class;
-		typedef typename std::remove_reference<decltype(*std::declval<_TAccessLease>())>::type target_type;
-		TAsyncSharedV2XWPReadWriteAccessRequester(const TAsyncSharedV2XWPReadWriteAccessRequester& src_cref) = default;
-		TAsyncSharedV2XWPReadWriteAccessRequester(_TAccessLease&& exclusive_write_pointer) : base_class(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)) {}
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2XWPReadWriteAccessRequester() {
-			mse::impl::T_valid_if_not_an_xscope_type<_TAccessLease>();
-			valid_if_target_type_is_marked_as_shareable();
-		}
-
-		TAsyncSharedV2ReadWritePointer<_TAccessLease> writelock_ptr() const {
-			return base_class::writelock_ptr();
-		}
-		mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr() const {
-			return base_class::try_writelock_ptr();
-		}
-		template<class _Rep, class _Period>
-		mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-			return base_class::try_writelock_ptr_for(_Rel_time);
-		}
-		template<class _Clock, class _Duration>
-		mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-			return base_class::try_writelock_ptr_until(_Abs_time);
-		}
-		TAsyncSharedV2ReadWriteConstPointer<_TAccessLease> readlock_ptr() const {
-			return base_class::readlock_ptr();
-		}
-		mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr() const {
-			return base_class::try_readlock_ptr();
-		}
-		template<class _Rep, class _Period>
-		mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-			return base_class::try_readlock_ptr_for(_Rel_time);
-		}
-		template<class _Clock, class _Duration>
-		mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-			return base_class::try_readlock_ptr_until(_Abs_time);
-		}
-		/* Note that an exclusive_writelock_ptr cannot coexist with any other lock_ptrs (targeting the same object), including ones in
-		the same thread. Thus, using exclusive_writelock_ptrs without sufficient care introduces the potential for exceptions (in a way
-		that sticking to (regular) writelock_ptrs doesn't). */
-		TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease> exclusive_writelock_ptr() const {
-			return base_class::exclusive_writelock_ptr();
-		}
-		auto exclusive_pointer() const {
-			return exclusive_writelock_ptr();
-		}
-
-		static TAsyncSharedV2XWPReadWriteAccessRequester make(_TAccessLease&& exclusive_write_pointer) {
-			return TAsyncSharedV2XWPReadWriteAccessRequester(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
-		}
-
-		void async_shareable_and_passable_tag() const {}
-
-	private:
-		TAsyncSharedV2XWPReadWriteAccessRequester(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TAsyncSharedV2XWPReadWriteAccessRequester(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : base_class(std::forward<decltype(shptr)>(shptr)) {}
-
-		auto shptr() const {
-			return (*this).m_shptr;
-		}
-
-		/* If the target type is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
-		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
-		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
-		template<class _target_type2 = target_type, class = typename std::enable_if<(std::is_same<_target_type2, target_type>::value) && (
-			mse::impl::is_marked_as_shareable_msemsearray<_target_type2>::value), void>::type>
-		void valid_if_target_type_is_marked_as_shareable() const {}
-
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-
-		//friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
-		friend class TAsyncSharedV2XWPWeakReadWriteAccessRequester<_TAccessLease>;
-	};
-
-	template<typename _TAccessLease>
-	TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease> make_asyncsharedv2xwpreadwrite(_TAccessLease&& exclusive_write_pointer) {
-		return TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>::make(std::forward<_TAccessLease>(exclusive_write_pointer));
-	}
-
-	template<typename _TAccessLease>
-	class TAsyncSharedV2XWPWeakReadWriteAccessRequester {
-	public:
-		TAsyncSharedV2XWPWeakReadWriteAccessRequester(const TAsyncSharedV2XWPWeakReadWriteAccessRequester&) = default;
-		TAsyncSharedV2XWPWeakReadWriteAccessRequester(const TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>& src) : m_wkptr(src.shptr()) {}
-
-		mse::mstd::optional<TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>> try_strong_access_requester() const {
-			return try_strong_access_requester_helper1(m_wkptr.lock());
-		}
-
-		void async_shareable_and_passable_tag() const {}
-
-	private:
-		mse::mstd::optional<TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>> try_strong_access_requester_helper1(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) const {
-			if (shptr) {
-				return TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>(std::forward<decltype(shptr)>(shptr));
-			}
-			else {
-				return {};
-			}
-		}
-
-		std::weak_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_wkptr;
+		friend class mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease>;
+		friend class mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease>;
+		friend class mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease>;
+		friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
+		friend class mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease>;
 	};
 
-#ifdef MSE_HAS_CXX17
-	/* deduction guide */
-	template<typename _TAccessLease>
-	TAsyncSharedV2XWPWeakReadWriteAccessRequester(TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>)->TAsyncSharedV2XWPWeakReadWriteAccessRequester<_TAccessLease>;
-#endif /* MSE_HAS_CXX17 */
-
-#ifdef MSESCOPE_H_
-	template<typename _Ty> using TXScopeAsyncSharedV2ReadWriteStore = TXScopeStrongNotNullPointerStore<TAsyncSharedV2ReadWritePointer<_Ty> >;
-	template<typename _Ty> using TXScopeAsyncSharedV2ReadWriteConstStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2ReadWriteConstPointer<_Ty> >;
-#endif // MSESCOPE_H_
-
 	namespace us {
 		namespace impl {
 			template<typename _TAccessLease>
-			class TAsyncSharedV2ReadOnlyConstPointerBase : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotPassableTagBase {
+			class TAsyncSharedV2ReadWritePointerBase : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotPassableTagBase {
 			public:
-				TAsyncSharedV2ReadOnlyConstPointerBase(const TAsyncSharedV2ReadOnlyConstPointerBase& src) : m_shptr(src.m_shptr), m_shared_lock(src.m_shptr->m_mutex1) {}
-				TAsyncSharedV2ReadOnlyConstPointerBase(TAsyncSharedV2ReadOnlyConstPointerBase&& src) = default;
-				//TAsyncSharedV2ReadOnlyConstPointerBase(const TAsyncSharedV2ReadOnlyPointerBase<_TAccessLease>& src) : m_shptr(src.m_shptr), m_shared_lock(src.m_shptr->m_mutex1) {}
-				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadOnlyConstPointerBase() {}
+				TAsyncSharedV2ReadWritePointerBase(const TAsyncSharedV2ReadWritePointerBase& src) : m_shptr(src.m_shptr), m_unique_lock(src.m_shptr->m_mutex1) {}
+				TAsyncSharedV2ReadWritePointerBase(TAsyncSharedV2ReadWritePointerBase&& src) = default;
+				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadWritePointerBase() {
+					if (m_unique_lock.owns_lock()) {
+						m_unique_lock.unlock();
+						if (m_shptr) {
+							m_shptr->notify_lock_released();
+						}
+					}
+				}
 
 				operator bool() const {
-					//assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadOnlyConstPointerBase")); }
+					//assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
 					return m_shptr.operator bool();
 				}
 				typedef std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr_t;
-				const auto& operator*() const/* -> typename std::add_const<typename std::add_lvalue_reference<decltype(*((*std::declval<m_shptr_t>()).cref()))>::type>::type*/ {
-					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadOnlyPointerBase")); }
+				/* gcc5 crashes if you uncomment the explicit return type declaration (Nov 2017). */
+				auto& operator*() const/* -> typename std::add_lvalue_reference<decltype(*((*std::declval<m_shptr_t>()).cref()))>::type*/ {
+					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
 					return (*((*m_shptr).cref()));
 				}
-				const auto operator->() const/* -> typename std::add_const<decltype(std::addressof(*((*std::declval<m_shptr_t>()).cref())))>::type*/ {
-					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadOnlyPointerBase")); }
+				auto operator->() const/* -> decltype(std::addressof(*((*std::declval<m_shptr_t>()).cref())))*/ {
+					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
 					return std::addressof(*((*m_shptr).cref()));
 				}
 				void async_not_passable_tag() const {}
 			private:
-				TAsyncSharedV2ReadOnlyConstPointerBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1) {}
-				TAsyncSharedV2ReadOnlyConstPointerBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_shared_lock.try_lock()) {
+				TAsyncSharedV2ReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1) {}
+				TAsyncSharedV2ReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_unique_lock.try_lock()) {
 						m_shptr = nullptr;
 					}
 				}
 				template<class _Rep, class _Period>
-				TAsyncSharedV2ReadOnlyConstPointerBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::duration<_Rep, _Period>& _Rel_time) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_shared_lock.try_lock_for(_Rel_time)) {
+				TAsyncSharedV2ReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::duration<_Rep, _Period>& _Rel_time) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_unique_lock.try_lock_for(_Rel_time)) {
 						m_shptr = nullptr;
 					}
 				}
 				template<class _Clock, class _Duration>
-				TAsyncSharedV2ReadOnlyConstPointerBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
-					if (!m_shared_lock.try_lock_until(_Abs_time)) {
+				TAsyncSharedV2ReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_unique_lock.try_lock_until(_Abs_time)) {
 						m_shptr = nullptr;
 					}
 				}
-				TAsyncSharedV2ReadOnlyConstPointerBase& operator=(const TAsyncSharedV2ReadOnlyConstPointerBase& _Right_cref) = delete;
-				TAsyncSharedV2ReadOnlyConstPointerBase& operator=(TAsyncSharedV2ReadOnlyConstPointerBase&& _Right) = delete;
+				TAsyncSharedV2ReadWritePointerBase& operator=(const TAsyncSharedV2ReadWritePointerBase& _Right_cref) = delete;
+				TAsyncSharedV2ReadWritePointerBase& operator=(TAsyncSharedV2ReadWritePointerBase&& _Right) = delete;
 
 				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
@@ -1480,1410 +1923,4076 @@ namespace mse {
 					return retval;
 				}
 
-				std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
-				std::shared_lock<async_shared_timed_mutex_type> m_shared_lock;
+				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
+				mse::impl::ns_async_lock::thread_recorded_lock<std::unique_lock<typename TAsyncSharedXWPAccessLeaseObj<_TAccessLease>::mutex_type> > m_unique_lock;
 
-				friend class TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>;
-				friend class TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>;
-				friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
-				friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+				friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
+				friend class TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>;
+				friend class TAsyncSharedV2ReadWritePointer<_TAccessLease>;
+				friend class mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease>;
 			};
 		}
 	}
 
 	template<typename _TAccessLease>
-	class TXScopeAsyncSharedV2ReadOnlyConstPointer : public mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	class TXScopeAsyncSharedV2ReadWritePointer : public mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
 	public:
-		typedef mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease> base_class;
+		typedef mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease> base_class;
 
-		TXScopeAsyncSharedV2ReadOnlyConstPointer(const TXScopeAsyncSharedV2ReadOnlyConstPointer& src) = default;
-		TXScopeAsyncSharedV2ReadOnlyConstPointer(TXScopeAsyncSharedV2ReadOnlyConstPointer&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2ReadOnlyConstPointer() {}
+		TXScopeAsyncSharedV2ReadWritePointer(const TXScopeAsyncSharedV2ReadWritePointer& src) = default;
+		TXScopeAsyncSharedV2ReadWritePointer(TXScopeAsyncSharedV2ReadWritePointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2ReadWritePointer() {}
 
 		void async_not_passable_tag() const {}
 	private:
-		TXScopeAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TXScopeAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
+		TXScopeAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TXScopeAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
 		template<class _Rep, class _Period>
-		TXScopeAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
+		TXScopeAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
 		template<class _Clock, class _Duration>
-		TXScopeAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
+		TXScopeAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
-		friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
 	};
 
 	template<typename _TAccessLease>
-	class TAsyncSharedV2ReadOnlyConstPointer : public mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease> {
+	class TAsyncSharedV2ReadWritePointer : public mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease> {
 	public:
-		typedef mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease> base_class;
+		typedef mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease> base_class;
 
-		TAsyncSharedV2ReadOnlyConstPointer(const TAsyncSharedV2ReadOnlyConstPointer& src) = default;
-		TAsyncSharedV2ReadOnlyConstPointer(TAsyncSharedV2ReadOnlyConstPointer&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadOnlyConstPointer() {}
+		TAsyncSharedV2ReadWritePointer(const TAsyncSharedV2ReadWritePointer& src) = default;
+		TAsyncSharedV2ReadWritePointer(TAsyncSharedV2ReadWritePointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadWritePointer() {}
 
 		void async_not_passable_tag() const {}
 	private:
-		TAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
+		TAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
 		template<class _Rep, class _Period>
-		TAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
+		TAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
 		template<class _Clock, class _Duration>
-		TAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
+		TAsyncSharedV2ReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
-		friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
 	};
 
 	namespace us {
 		namespace impl {
 			template<typename _TAccessLease>
-			class TAsyncSharedV2XWPReadOnlyAccessRequesterBase {
+			class TAsyncSharedV2ReadWriteConstPointerBase : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotPassableTagBase {
 			public:
-				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(const TAsyncSharedV2XWPReadOnlyAccessRequesterBase& src_cref) = default;
-				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(const mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>& src_cref) : m_shptr(src_cref.m_shptr) {}
-				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(_TAccessLease&& exclusive_write_pointer) {
-					m_shptr = std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer));
-				}
-				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2XWPReadOnlyAccessRequesterBase() {
-					valid_if_TAccessLease_is_marked_as_an_exclusive_pointer();
-					valid_if_TAccessLease_is_marked_as_a_strong_pointer();
+				TAsyncSharedV2ReadWriteConstPointerBase(const TAsyncSharedV2ReadWriteConstPointerBase& src) : m_shptr(src.m_shptr), m_shared_lock(src.m_shptr->m_mutex1) {}
+				TAsyncSharedV2ReadWriteConstPointerBase(TAsyncSharedV2ReadWriteConstPointerBase&& src) = default;
+				TAsyncSharedV2ReadWriteConstPointerBase(const mse::us::impl::TAsyncSharedV2ReadWritePointerBase<_TAccessLease>& src) : m_shptr(src.m_shptr), m_shared_lock(src.m_shptr->m_mutex1) {}
+				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadWriteConstPointerBase() {
+					if (m_shared_lock.owns_lock()) {
+						m_shared_lock.unlock();
+						if (m_shptr) {
+							m_shptr->notify_lock_released();
+						}
+					}
 				}
 
-				TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> xscope_readlock_ptr() const {
-					return TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr);
+				operator bool() const {
+					//assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWriteConstPointerBase")); }
+					return m_shptr.operator bool();
 				}
-				mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> xscope_try_readlock_ptr() const {
-					mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> retval(TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr, std::try_to_lock));
-					if (!((*retval).is_valid())) {
-						return{};
-					}
-					return retval;
-				}
-				template<class _Rep, class _Period>
-				mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> xscope_try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-					mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> retval(TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr, std::try_to_lock, _Rel_time));
-					if (!((*retval).is_valid())) {
-						return{};
-					}
-					return retval;
-				}
-				template<class _Clock, class _Duration>
-				mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> xscope_try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-					mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> retval(TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr, std::try_to_lock, _Abs_time));
-					if (!((*retval).is_valid())) {
-						return{};
-					}
-					return retval;
-				}
-
-				static TAsyncSharedV2XWPReadOnlyAccessRequesterBase make(_TAccessLease&& exclusive_write_pointer) {
-					return TAsyncSharedV2XWPReadOnlyAccessRequesterBase(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
+				typedef std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr_t;
+				const auto& operator*() const/* -> typename std::add_const<typename std::add_lvalue_reference<decltype(*((*std::declval<m_shptr_t>()).cref()))>::type>::type*/ {
+					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
+					return (*((*m_shptr).cref()));
 				}
-
-				void async_shareable_and_passable_tag() const {}
-
-			protected:
-				TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> readlock_ptr() const {
-					return TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr);
+				const auto operator->() const/* -> typename std::add_const<decltype(std::addressof(*((*std::declval<m_shptr_t>()).cref())))>::type*/ {
+					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
+					return std::addressof(*((*m_shptr).cref()));
 				}
-				mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr() const {
-					mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> retval(TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr, std::try_to_lock));
-					if (!((*retval).is_valid())) {
-						return{};
+				void async_not_passable_tag() const {}
+			private:
+				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1) {}
+				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_shared_lock.try_lock()) {
+						m_shptr = nullptr;
 					}
-					return retval;
 				}
 				template<class _Rep, class _Period>
-				mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-					mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> retval(TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr, std::try_to_lock, _Rel_time));
-					if (!((*retval).is_valid())) {
-						return{};
+				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::duration<_Rep, _Period>& _Rel_time) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_shared_lock.try_lock_for(_Rel_time)) {
+						m_shptr = nullptr;
 					}
-					return retval;
 				}
 				template<class _Clock, class _Duration>
-				mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-					mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> retval(TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr, std::try_to_lock, _Abs_time));
-					if (!((*retval).is_valid())) {
-						return{};
+				TAsyncSharedV2ReadWriteConstPointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_shared_lock.try_lock_until(_Abs_time)) {
+						m_shptr = nullptr;
 					}
-					return retval;
 				}
-
-			private:
-				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : m_shptr(shptr) {}
-				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : m_shptr(std::forward<decltype(shptr)>(shptr)) {}
-
-				template<class _Ty2 = _TAccessLease, class = typename std::enable_if<(std::is_same<_Ty2, _TAccessLease>::value) && (std::is_base_of<mse::us::impl::ExclusivePointerTagBase, _TAccessLease>::value), void>::type>
-				void valid_if_TAccessLease_is_marked_as_an_exclusive_pointer() const {}
-
-#if !defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_REFCOUNTINGPOINTER_DISABLED) && !defined(MSE_NORADPOINTER_DISABLED)
-				template<class _Ty2 = _TAccessLease, class = typename std::enable_if<(std::is_same<_Ty2, _TAccessLease>::value) && (std::is_base_of<mse::us::impl::StrongPointerTagBase, _TAccessLease>::value), void>::type>
-#endif /*!defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_REFCOUNTINGPOINTER_DISABLED) && !defined(MSE_NORADPOINTER_DISABLED)*/
-				void valid_if_TAccessLease_is_marked_as_a_strong_pointer() const {}
+				TAsyncSharedV2ReadWriteConstPointerBase& operator=(const TAsyncSharedV2ReadWriteConstPointerBase& _Right_cref) = delete;
+				TAsyncSharedV2ReadWriteConstPointerBase& operator=(TAsyncSharedV2ReadWriteConstPointerBase&& _Right) = delete;
 
 				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-				std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
+				bool is_valid() const {
+					bool retval = m_shptr.operator bool();
+					return retval;
+				}
 
-				friend class TXScopeAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
-				friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
+				mse::impl::ns_async_lock::thread_recorded_lock<std::shared_lock<typename TAsyncSharedXWPAccessLeaseObj<_TAccessLease>::mutex_type> > m_shared_lock;
+
+				friend class TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>;
+				friend class TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>;
+				friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
 			};
 		}
 	}
 
 	template<typename _TAccessLease>
-	class TXScopeAsyncSharedV2XWPReadOnlyAccessRequester : public mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	class TXScopeAsyncSharedV2ReadWriteConstPointer : public mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
 	public:
-		typedef mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease> base_class;
-		typedef typename std::remove_reference<decltype(*std::declval<_TAccessLease>())>::type target_type;
-		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(const TXScopeAsyncSharedV2XWPReadOnlyAccessRequester& src_cref) = default;
-		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(const TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>& src_cref) : base_class(src_cref) {}
-		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(_TAccessLease&& exclusive_write_pointer) : base_class(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)) {}
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2XWPReadOnlyAccessRequester() {
-			valid_if_target_type_is_marked_as_xscope_shareable_and_passable();
-		}
-
-		/* Prefer the "xscope_" prefixed versions to acknowledge that scope iterators are returned. */
-		auto readlock_ptr() const {
-			return base_class::xscope_readlock_ptr();
-		}
-		auto try_readlock_ptr() const {
-			return base_class::xscope_try_readlock_ptr();
-		}
-		template<class _Rep, class _Period>
-		auto try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-			return base_class::xscope_try_readlock_ptr_for(_Rel_time);
-		}
-		template<class _Clock, class _Duration>
-		auto try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-			return base_class::xscope_try_readlock_ptr_until(_Abs_time);
-		}
-
-		static TXScopeAsyncSharedV2XWPReadOnlyAccessRequester make(_TAccessLease&& exclusive_write_pointer) {
-			return TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
-		}
+		typedef mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease> base_class;
 
-		void xscope_async_shareable_and_passable_tag() const {}
+		TXScopeAsyncSharedV2ReadWriteConstPointer(const TXScopeAsyncSharedV2ReadWriteConstPointer& src) = default;
+		TXScopeAsyncSharedV2ReadWriteConstPointer(TXScopeAsyncSharedV2ReadWriteConstPointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2ReadWriteConstPointer() {}
 
+		void async_not_passable_tag() const {}
 	private:
-		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : base_class(std::forward<decltype(shptr)>(shptr)) {}
-		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester& operator=(const TXScopeAsyncSharedV2XWPReadOnlyAccessRequester& _Right_cref) = delete;
+		TXScopeAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TXScopeAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
+		template<class _Rep, class _Period>
+		TXScopeAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
+		template<class _Clock, class _Duration>
+		TXScopeAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
 
-		/* If the target type is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
-		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
-		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
-		template<class _target_type2 = target_type, class = typename std::enable_if<(std::is_same<_target_type2, target_type>::value)
-			&& (mse::impl::is_marked_as_xscope_shareable_and_passable_msemsearray<_target_type2>::value), void>::type>
-		void valid_if_target_type_is_marked_as_xscope_shareable_and_passable() const {}
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
 	};
 
-	template<typename _TAccessLease, class = MSE_IMPL_ENABLE_IF_NOT_RETURNABLE_FPARAM(_TAccessLease)>
-	auto make_xscope_asyncsharedv2xwpreadonly(_TAccessLease&& exclusive_write_pointer) {
-		return TXScopeAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>::make(std::forward<_TAccessLease>(exclusive_write_pointer));
-	}
-	/* Overloads for rsv::TReturnableFParam<>. */
-	MSE_OVERLOAD_FOR_RETURNABLE_FPARAM_DECLARATION(make_xscope_asyncsharedv2xwpreadonly)
-
 	template<typename _TAccessLease>
-	class TAsyncSharedV2XWPReadOnlyAccessRequester : public mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	class TAsyncSharedV2ReadWriteConstPointer : public mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease> {
 	public:
-		typedef mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease> base_class;
-		typedef typename std::remove_reference<decltype(*std::declval<_TAccessLease>())>::type target_type;
-		TAsyncSharedV2XWPReadOnlyAccessRequester(const TAsyncSharedV2XWPReadOnlyAccessRequester& src_cref) = default;
-		TAsyncSharedV2XWPReadOnlyAccessRequester(const TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>& src_cref) : base_class(src_cref) {}
-		TAsyncSharedV2XWPReadOnlyAccessRequester(_TAccessLease&& exclusive_write_pointer) : base_class(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)) {}
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2XWPReadOnlyAccessRequester() {
-			mse::impl::T_valid_if_not_an_xscope_type<_TAccessLease>();
-			valid_if_target_type_is_marked_as_shareable();
-		}
-
-		TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> readlock_ptr() const {
-			return base_class::readlock_ptr();
-		}
-		mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr() const {
-			return base_class::try_readlock_ptr();
-		}
-		template<class _Rep, class _Period>
-		mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
-			return base_class::try_readlock_ptr_for(_Rel_time);
-		}
-		template<class _Clock, class _Duration>
-		mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
-			return base_class::try_readlock_ptr_until(_Abs_time);
-		}
-
-		static TAsyncSharedV2XWPReadOnlyAccessRequester make(_TAccessLease&& exclusive_write_pointer) {
-			return TAsyncSharedV2XWPReadOnlyAccessRequester(std::make_shared<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
-		}
+		typedef mse::us::impl::TAsyncSharedV2ReadWriteConstPointerBase<_TAccessLease> base_class;
 
-		void async_shareable_and_passable_tag() const {}
+		TAsyncSharedV2ReadWriteConstPointer(const TAsyncSharedV2ReadWriteConstPointer& src) = default;
+		TAsyncSharedV2ReadWriteConstPointer(TAsyncSharedV2ReadWriteConstPointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadWriteConstPointer() {}
 
+		void async_not_passable_tag() const {}
 	private:
-		TAsyncSharedV2XWPReadOnlyAccessRequester(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
-		TAsyncSharedV2XWPReadOnlyAccessRequester(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : base_class(std::forward<decltype(shptr)>(shptr)) {}
-
-		/* If the target type is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
-		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
-		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
-		template<class _target_type2 = target_type, class = typename std::enable_if<(std::is_same<_target_type2, target_type>::value) && (
-			mse::impl::is_marked_as_shareable_msemsearray<_target_type2>::value), void>::type>
-			void valid_if_target_type_is_marked_as_shareable() const {}
+		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
+		template<class _Rep, class _Period>
+		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
+		template<class _Clock, class _Duration>
+		TAsyncSharedV2ReadWriteConstPointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-	};
-
-	template<typename _TAccessLease>
-	TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease> make_asyncsharedv2xwpreadonly(_TAccessLease&& exclusive_write_pointer) {
-		return TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>::make(std::forward<_TAccessLease>(exclusive_write_pointer));
-	}
-
-#ifdef MSESCOPE_H_
-	template<typename _Ty> using TXScopeAsyncSharedV2ReadOnlyConstStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2ReadOnlyConstPointer<_Ty> >;
-#endif // MSESCOPE_H_
 
-	template <typename _Ty> class TAsyncSharedV2ReadWriteAccessRequester;
-	template <typename _Ty> class TAsyncSharedV2ReadOnlyAccessRequester;
+		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
+	};
 
 	namespace us {
 		namespace impl {
-			template <typename _Ty>
-			class TTaggedUniquePtr : public std::unique_ptr<_Ty>, public mse::us::impl::StrongExclusivePointerTagBase {
+			template<typename _TAccessLease>
+			class TAsyncSharedV2ExclusiveReadWritePointerBase : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotPassableTagBase, public mse::us::impl::StrongExclusivePointerTagBase {
 			public:
+				TAsyncSharedV2ExclusiveReadWritePointerBase(const TAsyncSharedV2ExclusiveReadWritePointerBase& src) = delete;
+				TAsyncSharedV2ExclusiveReadWritePointerBase(TAsyncSharedV2ExclusiveReadWritePointerBase&& src) = default;
+				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ExclusiveReadWritePointerBase() {
+					if (m_unique_lock.owns_lock()) {
+						m_unique_lock.unlock();
+						if (m_shptr) {
+							m_shptr->notify_lock_released();
+						}
+					}
+				}
+
+				operator bool() const {
+					//assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ExclusiveReadWritePointerBase")); }
+					return m_shptr.operator bool();
+				}
+				typedef std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr_t;
+				auto& operator*() const/* -> typename std::add_lvalue_reference<decltype(*((*std::declval<m_shptr_t>()).cref()))>::type*/ {
+					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
+					return (*((*m_shptr).cref()));
+				}
+				auto operator->() const/* -> decltype(std::addressof(*((*std::declval<m_shptr_t>()).cref())))*/ {
+					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadWritePointerBase")); }
+					return std::addressof(*((*m_shptr).cref()));
+				}
+				void async_shareable_and_passable_tag() const {}
 			private:
-				typedef std::unique_ptr<_Ty> base_class;
-				TTaggedUniquePtr(std::unique_ptr<_Ty>&& uqptr) : base_class(std::forward<decltype(uqptr)>(uqptr)) {}
+				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1) {}
+				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_unique_lock.try_lock()) {
+						m_shptr = nullptr;
+					}
+				}
+				template<class _Rep, class _Period>
+				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::duration<_Rep, _Period>& _Rel_time) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_unique_lock.try_lock_for(_Rel_time)) {
+						m_shptr = nullptr;
+					}
+				}
+				template<class _Clock, class _Duration>
+				TAsyncSharedV2ExclusiveReadWritePointerBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : m_shptr(shptr), m_unique_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_unique_lock.try_lock_until(_Abs_time)) {
+						m_shptr = nullptr;
+					}
+				}
+				TAsyncSharedV2ExclusiveReadWritePointerBase& operator=(const TAsyncSharedV2ExclusiveReadWritePointerBase& _Right_cref) = delete;
+				TAsyncSharedV2ExclusiveReadWritePointerBase& operator=(TAsyncSharedV2ExclusiveReadWritePointerBase&& _Right) = delete;
 
-				template <typename _Ty2> friend class mse::TAsyncSharedV2ReadWriteAccessRequester;
-				template <typename _Ty2> friend class mse::TAsyncSharedV2ReadOnlyAccessRequester;
-			};
-		}
-	}
+				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-	template<typename _Ty> class TAsyncSharedV2WeakReadWriteAccessRequester;
+				bool is_valid() const {
+					bool retval = m_shptr.operator bool();
+					return retval;
+				}
 
-	template <typename _Ty>
-	class TAsyncSharedV2ReadWriteAccessRequester : public TAsyncSharedV2XWPReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > {
-	public:
-		typedef TAsyncSharedV2XWPReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > base_class;
-		typedef decltype(std::declval<base_class>().writelock_ptr()) writelock_ptr_t;
-		typedef decltype(std::declval<base_class>().readlock_ptr()) readlock_ptr_t;
-
-		TAsyncSharedV2ReadWriteAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester& src_cref) = default;
+				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
+				mse::impl::ns_async_lock::thread_recorded_lock<mse::impl::ns_access_mutex::unique_nonrecursive_lock_t<typename TAsyncSharedXWPAccessLeaseObj<_TAccessLease>::mutex_type> > m_unique_lock;
 
-		~TAsyncSharedV2ReadWriteAccessRequester() {
-			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
-			valid_if_Ty_is_marked_as_shareable();
-			valid_if_Ty_is_not_an_xscope_type();
+				friend class TXScopeAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>;
+				friend class TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>;
+				friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
+			};
 		}
+	}
 
-		template <class... Args>
-		static TAsyncSharedV2ReadWriteAccessRequester make(Args&&... args) {
-			return TAsyncSharedV2ReadWriteAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty>(std::make_unique<_Ty>(std::forward<Args>(args)...)));
-		}
+	template<typename _TAccessLease>
+	class TXScopeAsyncSharedV2ExclusiveReadWritePointer : public mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	public:
+		typedef mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease> base_class;
 
-		void async_shareable_and_passable_tag() const {}
+		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const TXScopeAsyncSharedV2ExclusiveReadWritePointer& src) = delete;
+		TXScopeAsyncSharedV2ExclusiveReadWritePointer(TXScopeAsyncSharedV2ExclusiveReadWritePointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2ExclusiveReadWritePointer() {}
 
+		void async_not_passable_tag() const {}
 	private:
-		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
-		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
-		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value, void>::type>
-		void valid_if_Ty_is_marked_as_shareable() const {}
-
-		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
-		(intended) compile error. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
-		void valid_if_Ty_is_not_an_xscope_type() const {}
-
-		TAsyncSharedV2ReadWriteAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty>&& uqptr) : base_class(make_asyncsharedv2xwpreadwrite(std::forward<decltype(uqptr)>(uqptr))) {}
-		TAsyncSharedV2ReadWriteAccessRequester(const base_class& src) : base_class(src) {}
+		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
+		template<class _Rep, class _Period>
+		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
+		template<class _Clock, class _Duration>
+		TXScopeAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		friend class TAsyncSharedV2WeakReadWriteAccessRequester<_Ty>;
+		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
 	};
 
-	template <class X, class... Args>
-	TAsyncSharedV2ReadWriteAccessRequester<X> make_asyncsharedv2readwrite(Args&&... args) {
-		return TAsyncSharedV2ReadWriteAccessRequester<X>::make(std::forward<Args>(args)...);
-	}
-
-	template<typename _Ty>
-	class TAsyncSharedV2WeakReadWriteAccessRequester : public TAsyncSharedV2XWPWeakReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > {
+	template<typename _TAccessLease>
+	class TAsyncSharedV2ExclusiveReadWritePointer : public mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease> {
 	public:
-		typedef TAsyncSharedV2XWPWeakReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > base_class;
-		TAsyncSharedV2WeakReadWriteAccessRequester(const TAsyncSharedV2WeakReadWriteAccessRequester&) = default;
-		TAsyncSharedV2WeakReadWriteAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester<_Ty>& src) : base_class(src) {}
-
-		mse::mstd::optional<TAsyncSharedV2ReadWriteAccessRequester<_Ty>> try_strong_access_requester() const {
-			return try_strong_access_requester_helper1(base_class::try_strong_access_requester());
-		}
+		typedef mse::us::impl::TAsyncSharedV2ExclusiveReadWritePointerBase<_TAccessLease> base_class;
 
-		void async_shareable_and_passable_tag() const {}
+		TAsyncSharedV2ExclusiveReadWritePointer(const TAsyncSharedV2ExclusiveReadWritePointer& src) = delete;
+		TAsyncSharedV2ExclusiveReadWritePointer(TAsyncSharedV2ExclusiveReadWritePointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ExclusiveReadWritePointer() {}
 
+		void async_not_passable_tag() const {}
 	private:
-		mse::mstd::optional<TAsyncSharedV2ReadWriteAccessRequester<_Ty>> try_strong_access_requester_helper1(decltype(std::declval<base_class>().try_strong_access_requester())&& base_maybe_ar) const {
-			if (base_maybe_ar) {
-				return TAsyncSharedV2ReadWriteAccessRequester<_Ty>(std::forward<decltype(base_maybe_ar.value())>(base_maybe_ar.value()));
-			}
-			else {
-				return {};
-			}
-		}
+		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
+		template<class _Rep, class _Period>
+		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
+		template<class _Clock, class _Duration>
+		TAsyncSharedV2ExclusiveReadWritePointer(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>;
 	};
 
-#ifdef MSE_HAS_CXX17
-	/* deduction guide */
-	template<typename _TAccessLease>
-	TAsyncSharedV2WeakReadWriteAccessRequester(TAsyncSharedV2ReadWriteAccessRequester<_TAccessLease>)->TAsyncSharedV2WeakReadWriteAccessRequester<_TAccessLease>;
-#endif /* MSE_HAS_CXX17 */
+	namespace us {
+		namespace impl {
+			template<typename _TAccessLease>
+			class TAsyncSharedV2XWPReadWriteAccessRequesterBase {
+			public:
+				TAsyncSharedV2XWPReadWriteAccessRequesterBase(const TAsyncSharedV2XWPReadWriteAccessRequesterBase& src_cref) = default;
+				TAsyncSharedV2XWPReadWriteAccessRequesterBase(_TAccessLease&& exclusive_write_pointer) {
+					m_shptr = std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease> >(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer));
+				}
+				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2XWPReadWriteAccessRequesterBase() {
+					valid_if_TAccessLease_is_marked_as_an_exclusive_pointer();
+					valid_if_TAccessLease_is_marked_as_a_strong_pointer();
+				}
 
-	template <typename _Ty>
-	class TAsyncSharedV2ReadOnlyAccessRequester : public TAsyncSharedV2XWPReadOnlyAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > {
-	public:
-		typedef TAsyncSharedV2XWPReadOnlyAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty> > base_class;
-		typedef decltype(std::declval<base_class>().readlock_ptr()) readlock_ptr_t;
+				TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease> xscope_writelock_ptr() const {
+					return TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr);
+				}
+				mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>> xscope_try_writelock_ptr() const {
+					TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease> ptr(m_shptr, std::try_to_lock);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					/* The pointer is moved (rather than copied) into the optional, as copying would require (recursively)
+					acquiring another lock, which not all access mutex types support. */
+					return mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Rep, class _Period>
+				mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>> xscope_try_writelock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+					TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Rel_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Clock, class _Duration>
+				mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>> xscope_try_writelock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+					TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Abs_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::xscope_optional<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>>(std::move(ptr));
+				}
+				TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease> xscope_readlock_ptr() const {
+					return TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr);
+				}
+				mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> xscope_try_readlock_ptr() const {
+					TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Rep, class _Period>
+				mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> xscope_try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+					TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Rel_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Clock, class _Duration>
+				mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> xscope_try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+					TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Abs_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::xscope_optional<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				/* Note that an exclusive_writelock_ptr cannot coexist with any other lock_ptrs (targeting the same object), including ones in
+				the same thread. Thus, using exclusive_writelock_ptrs without sufficient care introduces the potential for exceptions (in a way
+				that sticking to (regular) writelock_ptrs doesn't). */
+				TXScopeAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease> xscope_exclusive_writelock_ptr() const {
+					return TXScopeAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>(m_shptr);
+				}
+				auto xscope_exclusive_pointer() const {
+					return xscope_exclusive_writelock_ptr();
+				}
 
-		TAsyncSharedV2ReadOnlyAccessRequester(const TAsyncSharedV2ReadOnlyAccessRequester& src_cref) = default;
-		TAsyncSharedV2ReadOnlyAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester<_Ty>& src_cref) : base_class(src_cref) {}
+#ifdef MSE_ASYNC_LOCK_REQUESTS
+				/* Non-blocking counterparts of writelock_ptr() and readlock_ptr(). Rather than waiting for the lock, the request
+				is queued and the given function is invoked (with an (xscope) lock pointer) once the lock is obtained. A
+				(std::)future for the function's return value is returned. Note that the function may be invoked in another
+				thread (whichever one releases the lock the request was waiting on), so it shouldn't block. */
+				template<typename _TFunction>
+				auto async_writelock_ptr(_TFunction&& func) const {
+					/* The function (and its return value) may be passed to another thread. */
+					mse::impl::async_passable(func);
+					mse::impl::T_valid_if_is_marked_as_passable_msemsearray<decltype(func(std::declval<TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>&>()))>();
+					auto shptr = m_shptr;
+					return m_shptr->enqueue_async_lock_request([shptr]() {
+						return TXScopeAsyncSharedV2ReadWritePointer<_TAccessLease>(shptr, std::try_to_lock);
+					}, std::forward<_TFunction>(func));
+				}
+				template<typename _TFunction>
+				auto async_readlock_ptr(_TFunction&& func) const {
+					/* The function (and its return value) may be passed to another thread. */
+					mse::impl::async_passable(func);
+					mse::impl::T_valid_if_is_marked_as_passable_msemsearray<decltype(func(std::declval<TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>&>()))>();
+					auto shptr = m_shptr;
+					return m_shptr->enqueue_async_lock_request([shptr]() {
+						return TXScopeAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(shptr, std::try_to_lock);
+					}, std::forward<_TFunction>(func));
+				}
+#endif // MSE_ASYNC_LOCK_REQUESTS
 
-		~TAsyncSharedV2ReadOnlyAccessRequester() {
-			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
-			valid_if_Ty_is_marked_as_shareable();
-			valid_if_Ty_is_not_an_xscope_type();
-		}
+				/* Sets the label that identifies the shared object in the lock statistics (if MSE_ASYNC_LOCK_STATS is
+				defined; otherwise it does nothing). */
+				void set_lock_stats_label(const std::string& label) const {
+					mse::impl::ns_lock_stats::set_label(m_shptr->mutex_ref(), label);
+				}
 
-		template <class... Args>
-		static TAsyncSharedV2ReadOnlyAccessRequester make(Args&&... args) {
-			return TAsyncSharedV2ReadOnlyAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty>(std::make_unique<_Ty>(std::forward<Args>(args)...)));
-		}
+				static TAsyncSharedV2XWPReadWriteAccessRequesterBase make(_TAccessLease&& exclusive_write_pointer) {
+					return TAsyncSharedV2XWPReadWriteAccessRequesterBase(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
+				}
 
-		void async_shareable_and_passable_tag() const {}
+				void async_shareable_and_passable_tag() const {}
 
-	private:
-		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
-		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
-		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value, void>::type>
-		void valid_if_Ty_is_marked_as_shareable() const {}
+			protected:
+				TAsyncSharedV2ReadWritePointer<_TAccessLease> writelock_ptr() const {
+					return TAsyncSharedV2ReadWritePointer<_TAccessLease>(m_shptr);
+				}
+				mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr() const {
+					TAsyncSharedV2ReadWritePointer<_TAccessLease> ptr(m_shptr, std::try_to_lock);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Rep, class _Period>
+				mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+					TAsyncSharedV2ReadWritePointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Rel_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Clock, class _Duration>
+				mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+					TAsyncSharedV2ReadWritePointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Abs_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>>(std::move(ptr));
+				}
+				TAsyncSharedV2ReadWriteConstPointer<_TAccessLease> readlock_ptr() const {
+					return TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>(m_shptr);
+				}
+				mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr() const {
+					TAsyncSharedV2ReadWriteConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Rep, class _Period>
+				mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+					TAsyncSharedV2ReadWriteConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Rel_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Clock, class _Duration>
+				mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+					TAsyncSharedV2ReadWriteConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Abs_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				/* Note that an exclusive_writelock_ptr cannot coexist with any other lock_ptrs (targeting the same object), including ones in
+				the same thread. Thus, using exclusive_writelock_ptrs without sufficient care introduces the potential for exceptions (in a way
+				that sticking to (regular) writelock_ptrs doesn't). */
+				TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease> exclusive_writelock_ptr() const {
+					return TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease>(m_shptr);
+				}
+				auto exclusive_pointer() const {
+					return exclusive_writelock_ptr();
+				}
 
-		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
-		(intended) compile error. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
-		void valid_if_Ty_is_not_an_xscope_type() const {}
+			private:
+				TAsyncSharedV2XWPReadWriteAccessRequesterBase(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : m_shptr(shptr) {}
+				TAsyncSharedV2XWPReadWriteAccessRequesterBase(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : m_shptr(std::forward<decltype(shptr)>(shptr)) {}
 
-		TAsyncSharedV2ReadOnlyAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty>&& uqptr) : base_class(make_asyncsharedv2xwpreadonly(std::forward<decltype(uqptr)>(uqptr))) {}
+				template<class _Ty2 = _TAccessLease, class = typename std::enable_if<(std::is_same<_Ty2, _TAccessLease>::value) && (std::is_base_of<mse::us::impl::ExclusivePointerTagBase, _TAccessLease>::value), void>::type>
+				void valid_if_TAccessLease_is_marked_as_an_exclusive_pointer() const {}
 
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-	};
+#if !defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_REFCOUNTINGPOINTER_DISABLED) && !defined(MSE_NORADPOINTER_DISABLED)
+				template<class _Ty2 = _TAccessLease, class = typename std::enable_if<(std::is_same<_Ty2, _TAccessLease>::value) && (std::is_base_of<mse::us::impl::StrongPointerTagBase, _TAccessLease>::value), void>::type>
+#endif /*!defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_REFCOUNTINGPOINTER_DISABLED) && !defined(MSE_NORADPOINTER_DISABLED)*/
+				void valid_if_TAccessLease_is_marked_as_a_strong_pointer() const {}
 
-	template <class X, class... Args>
-	TAsyncSharedV2ReadOnlyAccessRequester<X> make_asyncsharedv2readonly(Args&&... args) {
-		return TAsyncSharedV2ReadOnlyAccessRequester<X>::make(std::forward<Args>(args)...);
-	}
+				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex>
-	class TXScopeAsyncSharedV2ACOReadWriteAccessRequester
-		: public TXScopeAsyncSharedV2XWPReadWriteAccessRequester<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> {
-	public:
-		typedef TXScopeAsyncSharedV2XWPReadWriteAccessRequester<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> base_class;
-		typedef decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer()) _TExclusiveWritePointer;
+				std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
 
-		TXScopeAsyncSharedV2ACOReadWriteAccessRequester(const TXScopeAsyncSharedV2ACOReadWriteAccessRequester& src_cref) = default;
+				friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
+				friend class TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>;
+				friend class TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>;
+			};
+		}
+	}
 
-		~TXScopeAsyncSharedV2ACOReadWriteAccessRequester() {
-			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
-			valid_if_Ty_is_marked_as_xscope_shareable();
+	template<typename _TAccessLease>
+	class TXScopeAsyncSharedV2XWPReadWriteAccessRequester : public mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	public:
+		typedef mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease> base_class;
+		typedef typename std::remove_reference<decltype(*std::declval<_TAccessLease>())>::type target_type;
+		TXScopeAsyncSharedV2XWPReadWriteAccessRequester(const TXScopeAsyncSharedV2XWPReadWriteAccessRequester& src_cref) = default;
+		TXScopeAsyncSharedV2XWPReadWriteAccessRequester(_TAccessLease&& exclusive_write_pointer) : base_class(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2XWPReadWriteAccessRequester() {
+			valid_if_target_type_is_marked_as_xscope_shareable();
 		}
 
-		typedef mse::TXScopeFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> > xsac_obj_xscpptr_t;
-		typedef mse::TXScopeFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> > ac_obj_xscpptr_t;
-		static auto make(const xsac_obj_xscpptr_t& xscpptr) {
-			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
+		/* Prefer the "xscope_" prefixed versions to acknowledge that scope iterators are returned. */
+		auto writelock_ptr() const {
+			return base_class::xscope_writelock_ptr();
 		}
-		static auto make(const ac_obj_xscpptr_t& xscpptr) {
-			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
+		auto try_writelock_ptr() const {
+			return base_class::xscope_try_writelock_ptr();
 		}
-#ifndef MSE_SCOPEPOINTER_DISABLED
-		typedef mse::TXScopeObjFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> > xsac_obj_xscpfptr_t;
-		typedef mse::TXScopeObjFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> > ac_obj_xscpfptr_t;
-		static auto make(const xsac_obj_xscpfptr_t& xscpptr) {
-			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
+		template<class _Rep, class _Period>
+		auto try_writelock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+			return base_class::xscope_try_writelock_ptr_for(_Rel_time);
 		}
-		static auto make(const ac_obj_xscpfptr_t& xscpptr) {
-			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
+		template<class _Clock, class _Duration>
+		auto try_writelock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+			return base_class::xscope_try_writelock_ptr_until(_Abs_time);
 		}
-#endif //!MSE_SCOPEPOINTER_DISABLED
-		static auto make(mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex>& xs_aco) {
-			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester(xs_aco.exclusive_pointer());
+		auto readlock_ptr() const {
+			return base_class::xscope_readlock_ptr();
+		}
+		auto try_readlock_ptr() const {
+			return base_class::xscope_try_readlock_ptr();
+		}
+		template<class _Rep, class _Period>
+		auto try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+			return base_class::xscope_try_readlock_ptr_for(_Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		auto try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+			return base_class::xscope_try_readlock_ptr_until(_Abs_time);
+		}
+		auto exclusive_writelock_ptr() const {
+			return base_class::xscope_exclusive_writelock_ptr();
+		}
+		auto exclusive_pointer() const {
+			return exclusive_writelock_ptr();
+		}
+
+		static TXScopeAsyncSharedV2XWPReadWriteAccessRequester make(_TAccessLease&& exclusive_write_pointer) {
+			return TXScopeAsyncSharedV2XWPReadWriteAccessRequester(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
 		}
-		static void make(mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex>&&) = delete;
 
 		void xscope_async_shareable_and_passable_tag() const {}
 
 	private:
-		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "xscope_async_shareable_and_passable_tag()" member
+		TXScopeAsyncSharedV2XWPReadWriteAccessRequester(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TXScopeAsyncSharedV2XWPReadWriteAccessRequester(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : base_class(std::forward<decltype(shptr)>(shptr)) {}
+		TXScopeAsyncSharedV2XWPReadWriteAccessRequester& operator=(const TXScopeAsyncSharedV2XWPReadWriteAccessRequester& _Right_cref) = delete;
+
+		/* If the target type is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
 		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
 		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value)
-			&& (mse::impl::is_marked_as_xscope_shareable_msemsearray<_Ty2>::value), void>::type>
-		void valid_if_Ty_is_marked_as_xscope_shareable() const {}
-
-		TXScopeAsyncSharedV2ACOReadWriteAccessRequester(_TExclusiveWritePointer&& xwptr)
-			: base_class(make_xscope_asyncsharedv2xwpreadwrite(std::forward<decltype(xwptr)>(xwptr))) {}
+		template<class _target_type2 = target_type, class = typename std::enable_if<(std::is_same<_target_type2, target_type>::value)
+			&& (mse::impl::is_marked_as_xscope_shareable_msemsearray<_target_type2>::value), void>::type>
+		void valid_if_target_type_is_marked_as_xscope_shareable() const {}
 
 		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
 	};
 
-	template <typename TXScopeAccessControlledObj1>
-	auto make_xscope_asyncsharedv2acoreadwrite(const mse::TXScopeFixedPointer<TXScopeAccessControlledObj1>& xscpptr)
-		-> TXScopeAsyncSharedV2ACOReadWriteAccessRequester<typename TXScopeAccessControlledObj1::object_type, typename TXScopeAccessControlledObj1::access_mutex_type> {
-		return TXScopeAsyncSharedV2ACOReadWriteAccessRequester<typename TXScopeAccessControlledObj1::object_type, typename TXScopeAccessControlledObj1::access_mutex_type>::make(xscpptr);
-	}
-#ifndef MSE_SCOPEPOINTER_DISABLED
-	template <typename TXScopeAccessControlledObj1>
-	auto make_xscope_asyncsharedv2acoreadwrite(const mse::TXScopeObjFixedPointer<TXScopeAccessControlledObj1>& xscpptr)
-		-> TXScopeAsyncSharedV2ACOReadWriteAccessRequester<typename TXScopeAccessControlledObj1::object_type, typename TXScopeAccessControlledObj1::access_mutex_type> {
-		return TXScopeAsyncSharedV2ACOReadWriteAccessRequester<typename TXScopeAccessControlledObj1::object_type, typename TXScopeAccessControlledObj1::access_mutex_type>::make(xscpptr);
-	}
-#endif //!MSE_SCOPEPOINTER_DISABLED
-	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex>
-	auto make_xscope_asyncsharedv2acoreadwrite(mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex>& xs_aco)
-		-> TXScopeAsyncSharedV2ACOReadWriteAccessRequester<_Ty, _TAccessMutex> {
-		return TXScopeAsyncSharedV2ACOReadWriteAccessRequester<_Ty, _TAccessMutex>::make(xs_aco);
+	template<typename _TAccessLease, class = MSE_IMPL_ENABLE_IF_NOT_RETURNABLE_FPARAM(_TAccessLease)>
+	auto make_xscope_asyncsharedv2xwpreadwrite(_TAccessLease&& exclusive_write_pointer) {
+		return TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>::make(std::forward<_TAccessLease>(exclusive_write_pointer));
 	}
-	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex, class = MSE_IMPL_ENABLE_IF_NOT_RETURNABLE_FPARAM(_Ty)>
-	void make_xscope_asyncsharedv2acoreadwrite(mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex>&& xs_aco) = delete;
 	/* Overloads for rsv::TReturnableFParam<>. */
-	MSE_OVERLOAD_FOR_RETURNABLE_FPARAM_DECLARATION(make_xscope_asyncsharedv2acoreadwrite)
+	MSE_OVERLOAD_FOR_RETURNABLE_FPARAM_DECLARATION(make_xscope_asyncsharedv2xwpreadwrite)
 
+	template<typename _TAccessLease> class TAsyncSharedV2XWPWeakReadWriteAccessRequester;
 
-	/* For situations where the shared object is immutable (i.e. is never modified), you don't even need locks or access requesters. */
-	template<typename _Ty>
-	class TAsyncSharedV2ImmutableFixedPointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
+	template<typename _TAccessLease>
+	class TAsyncSharedV2XWPReadWriteAccessRequester : public mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease> {
 	public:
-		TAsyncSharedV2ImmutableFixedPointer(const TAsyncSharedV2ImmutableFixedPointer& src_cref) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ImmutableFixedPointer() {
-			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
-			valid_if_Ty_is_marked_as_shareable();
-			valid_if_Ty_is_not_an_xscope_type();
+		typedef mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease> base_class;
+		typedef typename std::remove_reference<decltype(*std::declval<_TAccessLease>())>::type target_type;
+		TAsyncSharedV2XWPReadWriteAccessRequester(const TAsyncSharedV2XWPReadWriteAccessRequester& src_cref) = default;
+		TAsyncSharedV2XWPReadWriteAccessRequester(_TAccessLease&& exclusive_write_pointer) : base_class(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2XWPReadWriteAccessRequester() {
+			mse::impl::T_valid_if_not_an_xscope_type<_TAccessLease>();
+			valid_if_target_type_is_marked_as_shareable();
 		}
 
-		operator bool() const {
-			return m_shptr.operator bool();
+		TAsyncSharedV2ReadWritePointer<_TAccessLease> writelock_ptr() const {
+			return base_class::writelock_ptr();
 		}
-		const auto& operator*() const {
-			return (*m_shptr);
+		mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr() const {
+			return base_class::try_writelock_ptr();
 		}
-		const auto operator->() const {
-			return std::addressof(*m_shptr);
+		template<class _Rep, class _Period>
+		mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+			return base_class::try_writelock_ptr_for(_Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		mse::mstd::optional<TAsyncSharedV2ReadWritePointer<_TAccessLease>> try_writelock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+			return base_class::try_writelock_ptr_until(_Abs_time);
+		}
+		TAsyncSharedV2ReadWriteConstPointer<_TAccessLease> readlock_ptr() const {
+			return base_class::readlock_ptr();
+		}
+		mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr() const {
+			return base_class::try_readlock_ptr();
+		}
+		template<class _Rep, class _Period>
+		mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+			return base_class::try_readlock_ptr_for(_Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		mse::mstd::optional<TAsyncSharedV2ReadWriteConstPointer<_TAccessLease>> try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+			return base_class::try_readlock_ptr_until(_Abs_time);
+		}
+		/* Note that an exclusive_writelock_ptr cannot coexist with any other lock_ptrs (targeting the same object), including ones in
+		the same thread. Thus, using exclusive_writelock_ptrs without sufficient care introduces the potential for exceptions (in a way
+		that sticking to (regular) writelock_ptrs doesn't). */
+		TAsyncSharedV2ExclusiveReadWritePointer<_TAccessLease> exclusive_writelock_ptr() const {
+			return base_class::exclusive_writelock_ptr();
+		}
+		auto exclusive_pointer() const {
+			return exclusive_writelock_ptr();
 		}
 
-		/* This operator is just for compatibility with existing/legacy code. */
-		explicit operator std::shared_ptr<const _Ty>() const { return m_shptr; }
-
-		template <class... Args>
-		static TAsyncSharedV2ImmutableFixedPointer make(Args&&... args) {
-			return TAsyncSharedV2ImmutableFixedPointer(std::make_shared<const _Ty>(std::forward<Args>(args)...));
+		static TAsyncSharedV2XWPReadWriteAccessRequester make(_TAccessLease&& exclusive_write_pointer) {
+			return TAsyncSharedV2XWPReadWriteAccessRequester(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
 		}
 
 		void async_shareable_and_passable_tag() const {}
 
 	private:
-		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
-		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
-		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value, void>::type>
-		void valid_if_Ty_is_marked_as_shareable() const {}
+		TAsyncSharedV2XWPReadWriteAccessRequester(const std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TAsyncSharedV2XWPReadWriteAccessRequester(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : base_class(std::forward<decltype(shptr)>(shptr)) {}
 
-		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
-		(intended) compile error. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
-		void valid_if_Ty_is_not_an_xscope_type() const {}
+		auto shptr() const {
+			return (*this).m_shptr;
+		}
 
-		TAsyncSharedV2ImmutableFixedPointer(std::shared_ptr<const _Ty> shptr) : m_shptr(shptr) {}
-		TAsyncSharedV2ImmutableFixedPointer<_Ty>& operator=(const TAsyncSharedV2ImmutableFixedPointer<_Ty>& _Right_cref) = delete;
+		/* If the target type is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
+		template<class _target_type2 = target_type, class = typename std::enable_if<(std::is_same<_target_type2, target_type>::value) && (
+			mse::impl::is_marked_as_shareable_msemsearray<_target_type2>::value), void>::type>
+		void valid_if_target_type_is_marked_as_shareable() const {}
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		std::shared_ptr<const _Ty> m_shptr;
+		//friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+		friend class TAsyncSharedV2XWPWeakReadWriteAccessRequester<_TAccessLease>;
 	};
 
-	template <class X, class... Args>
-	TAsyncSharedV2ImmutableFixedPointer<X> make_asyncsharedv2immutable(Args&&... args) {
-		return TAsyncSharedV2ImmutableFixedPointer<X>::make(std::forward<Args>(args)...);
+	template<typename _TAccessLease>
+	TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease> make_asyncsharedv2xwpreadwrite(_TAccessLease&& exclusive_write_pointer) {
+		return TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>::make(std::forward<_TAccessLease>(exclusive_write_pointer));
 	}
 
-#ifdef MSESCOPE_H_
-	template<typename _Ty> using TXScopeAsyncSharedV2ImmutableFixedStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2ImmutableFixedPointer<_Ty> >;
-#endif // MSESCOPE_H_
-
-
-	/* For situations where the shared object is atomic, you don't need locks or access requesters. */
-	template<typename _Ty>
-	class TAsyncSharedV2AtomicFixedPointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
+	template<typename _TAccessLease>
+	class TAsyncSharedV2XWPWeakReadWriteAccessRequester {
 	public:
-		TAsyncSharedV2AtomicFixedPointer(const TAsyncSharedV2AtomicFixedPointer& src_cref) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2AtomicFixedPointer() {
-			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
-			//valid_if_Ty_is_marked_as_shareable();
-			mse::impl::T_valid_if_is_marked_as_shareable_msemsearray<_Ty>();
-			valid_if_Ty_is_not_an_xscope_type();
-		}
-
-		operator bool() const {
-			return m_shptr.operator bool();
-		}
-		auto& operator*() const {
-			return (*m_shptr);
-		}
-		auto operator->() const {
-			return std::addressof(*m_shptr);
-		}
-
-		/* This operator is just for compatibility with existing/legacy code. */
-		explicit operator std::shared_ptr<std::atomic<_Ty> >() const { return m_shptr; }
+		TAsyncSharedV2XWPWeakReadWriteAccessRequester(const TAsyncSharedV2XWPWeakReadWriteAccessRequester&) = default;
+		TAsyncSharedV2XWPWeakReadWriteAccessRequester(const TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>& src) : m_wkptr(src.shptr()) {}
 
-		template <class... Args>
-		static TAsyncSharedV2AtomicFixedPointer make(Args&&... args) {
-			return TAsyncSharedV2AtomicFixedPointer(std::make_shared<std::atomic<_Ty> >(std::forward<Args>(args)...));
+		mse::mstd::optional<TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>> try_strong_access_requester() const {
+			return try_strong_access_requester_helper1(m_wkptr.lock());
 		}
 
 		void async_shareable_and_passable_tag() const {}
 
 	private:
-		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
-		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
-		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_and_passable_msemsearray<_Ty2>::value, void>::type>
-		void valid_if_Ty_is_marked_as_shareable() const {}
-
-		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
-		(intended) compile error. */
-		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
-		void valid_if_Ty_is_not_an_xscope_type() const {}
-
-		TAsyncSharedV2AtomicFixedPointer(std::shared_ptr<std::atomic<_Ty> > shptr) : m_shptr(shptr) {}
-		TAsyncSharedV2AtomicFixedPointer<_Ty>& operator=(const TAsyncSharedV2AtomicFixedPointer<_Ty>& _Right_cref) = delete;
-
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+		mse::mstd::optional<TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>> try_strong_access_requester_helper1(std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) const {
+			if (shptr) {
+				return TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>(std::forward<decltype(shptr)>(shptr));
+			}
+			else {
+				return {};
+			}
+		}
 
-		std::shared_ptr<std::atomic<_Ty> > m_shptr;
+		std::weak_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_wkptr;
 	};
 
-	template <class X, class... Args>
-	TAsyncSharedV2AtomicFixedPointer<X> make_asyncsharedv2atomic(Args&&... args) {
-		return TAsyncSharedV2AtomicFixedPointer<X>::make(std::forward<Args>(args)...);
-	}
+#ifdef MSE_HAS_CXX17
+	/* deduction guide */
+	template<typename _TAccessLease>
+	TAsyncSharedV2XWPWeakReadWriteAccessRequester(TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>)->TAsyncSharedV2XWPWeakReadWriteAccessRequester<_TAccessLease>;
+#endif /* MSE_HAS_CXX17 */
 
 #ifdef MSESCOPE_H_
-	template<typename _Ty> using TXScopeAsyncSharedV2AtomicFixedStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2AtomicFixedPointer<_Ty> >;
-#endif // MSESCOPE_H_
+	template<typename _Ty> using TXScopeAsyncSharedV2ReadWriteStore = TXScopeStrongNotNullPointerStore<TAsyncSharedV2ReadWritePointer<_Ty> >;
+	template<typename _Ty> using TXScopeAsyncSharedV2ReadWriteConstStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2ReadWriteConstPointer<_Ty> >;
+#endif // MSESCOPE_H_
+
+	namespace us {
+		namespace impl {
+			template<typename _TAccessLease>
+			class TAsyncSharedV2ReadOnlyConstPointerBase : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotPassableTagBase {
+			public:
+				TAsyncSharedV2ReadOnlyConstPointerBase(const TAsyncSharedV2ReadOnlyConstPointerBase& src) : m_shptr(src.m_shptr), m_shared_lock(src.m_shptr->m_mutex1) {}
+				TAsyncSharedV2ReadOnlyConstPointerBase(TAsyncSharedV2ReadOnlyConstPointerBase&& src) = default;
+				//TAsyncSharedV2ReadOnlyConstPointerBase(const TAsyncSharedV2ReadOnlyPointerBase<_TAccessLease>& src) : m_shptr(src.m_shptr), m_shared_lock(src.m_shptr->m_mutex1) {}
+				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadOnlyConstPointerBase() {
+					if (m_shared_lock.owns_lock()) {
+						m_shared_lock.unlock();
+						if (m_shptr) {
+							m_shptr->notify_lock_released();
+						}
+					}
+				}
+
+				operator bool() const {
+					//assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadOnlyConstPointerBase")); }
+					return m_shptr.operator bool();
+				}
+				typedef std::shared_ptr<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr_t;
+				const auto& operator*() const/* -> typename std::add_const<typename std::add_lvalue_reference<decltype(*((*std::declval<m_shptr_t>()).cref()))>::type>::type*/ {
+					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadOnlyPointerBase")); }
+					return (*((*m_shptr).cref()));
+				}
+				const auto operator->() const/* -> typename std::add_const<decltype(std::addressof(*((*std::declval<m_shptr_t>()).cref())))>::type*/ {
+					assert(is_valid()); //{ MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2ReadOnlyPointerBase")); }
+					return std::addressof(*((*m_shptr).cref()));
+				}
+				void async_not_passable_tag() const {}
+			private:
+				TAsyncSharedV2ReadOnlyConstPointerBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1) {}
+				TAsyncSharedV2ReadOnlyConstPointerBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_shared_lock.try_lock()) {
+						m_shptr = nullptr;
+					}
+				}
+				template<class _Rep, class _Period>
+				TAsyncSharedV2ReadOnlyConstPointerBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::duration<_Rep, _Period>& _Rel_time) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_shared_lock.try_lock_for(_Rel_time)) {
+						m_shptr = nullptr;
+					}
+				}
+				template<class _Clock, class _Duration>
+				TAsyncSharedV2ReadOnlyConstPointerBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> shptr, std::try_to_lock_t, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : m_shptr(shptr), m_shared_lock(shptr->m_mutex1, std::defer_lock) {
+					if (!m_shared_lock.try_lock_until(_Abs_time)) {
+						m_shptr = nullptr;
+					}
+				}
+				TAsyncSharedV2ReadOnlyConstPointerBase& operator=(const TAsyncSharedV2ReadOnlyConstPointerBase& _Right_cref) = delete;
+				TAsyncSharedV2ReadOnlyConstPointerBase& operator=(TAsyncSharedV2ReadOnlyConstPointerBase&& _Right) = delete;
+
+				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+				bool is_valid() const {
+					bool retval = m_shptr.operator bool();
+					return retval;
+				}
+
+				std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
+				mse::impl::ns_async_lock::thread_recorded_lock<std::shared_lock<typename TAsyncSharedXWPAccessLeaseObj<_TAccessLease>::mutex_type> > m_shared_lock;
+
+				friend class TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>;
+				friend class TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>;
+				friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
+				friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+			};
+		}
+	}
+
+	template<typename _TAccessLease>
+	class TXScopeAsyncSharedV2ReadOnlyConstPointer : public mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	public:
+		typedef mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease> base_class;
+
+		TXScopeAsyncSharedV2ReadOnlyConstPointer(const TXScopeAsyncSharedV2ReadOnlyConstPointer& src) = default;
+		TXScopeAsyncSharedV2ReadOnlyConstPointer(TXScopeAsyncSharedV2ReadOnlyConstPointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2ReadOnlyConstPointer() {}
+
+		void async_not_passable_tag() const {}
+	private:
+		TXScopeAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TXScopeAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
+		template<class _Rep, class _Period>
+		TXScopeAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
+		template<class _Clock, class _Duration>
+		TXScopeAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
+		friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+	};
+
+	template<typename _TAccessLease>
+	class TAsyncSharedV2ReadOnlyConstPointer : public mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease> {
+	public:
+		typedef mse::us::impl::TAsyncSharedV2ReadOnlyConstPointerBase<_TAccessLease> base_class;
+
+		TAsyncSharedV2ReadOnlyConstPointer(const TAsyncSharedV2ReadOnlyConstPointer& src) = default;
+		TAsyncSharedV2ReadOnlyConstPointer(TAsyncSharedV2ReadOnlyConstPointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ReadOnlyConstPointer() {}
+
+		void async_not_passable_tag() const {}
+	private:
+		TAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl) : base_class(shptr, ttl) {}
+		template<class _Rep, class _Period>
+		TAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::duration<_Rep, _Period>& _Rel_time) : base_class(shptr, ttl, _Rel_time) {}
+		template<class _Clock, class _Duration>
+		TAsyncSharedV2ReadOnlyConstPointer(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr, const std::try_to_lock_t& ttl, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) : base_class(shptr, ttl, _Abs_time) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>;
+		friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+	};
+
+	namespace us {
+		namespace impl {
+			template<typename _TAccessLease>
+			class TAsyncSharedV2XWPReadOnlyAccessRequesterBase {
+			public:
+				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(const TAsyncSharedV2XWPReadOnlyAccessRequesterBase& src_cref) = default;
+				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(const mse::us::impl::TAsyncSharedV2XWPReadWriteAccessRequesterBase<_TAccessLease>& src_cref) : m_shptr(src_cref.m_shptr) {}
+				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(_TAccessLease&& exclusive_write_pointer) {
+					m_shptr = std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer));
+				}
+				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2XWPReadOnlyAccessRequesterBase() {
+					valid_if_TAccessLease_is_marked_as_an_exclusive_pointer();
+					valid_if_TAccessLease_is_marked_as_a_strong_pointer();
+				}
+
+				TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> xscope_readlock_ptr() const {
+					return TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr);
+				}
+				mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> xscope_try_readlock_ptr() const {
+					TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Rep, class _Period>
+				mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> xscope_try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+					TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Rel_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Clock, class _Duration>
+				mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> xscope_try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+					TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Abs_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::xscope_optional<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+
+#ifdef MSE_ASYNC_LOCK_REQUESTS
+				/* Non-blocking counterpart of readlock_ptr(). (See TAsyncSharedV2XWPReadWriteAccessRequesterBase<>::async_readlock_ptr().) */
+				template<typename _TFunction>
+				auto async_readlock_ptr(_TFunction&& func) const {
+					/* The function (and its return value) may be passed to another thread. */
+					mse::impl::async_passable(func);
+					mse::impl::T_valid_if_is_marked_as_passable_msemsearray<decltype(func(std::declval<TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>&>()))>();
+					auto shptr = m_shptr;
+					return m_shptr->enqueue_async_lock_request([shptr]() {
+						return TXScopeAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(shptr, std::try_to_lock);
+					}, std::forward<_TFunction>(func));
+				}
+#endif // MSE_ASYNC_LOCK_REQUESTS
+
+				/* See TAsyncSharedV2XWPReadWriteAccessRequesterBase<>::set_lock_stats_label(). */
+				void set_lock_stats_label(const std::string& label) const {
+					mse::impl::ns_lock_stats::set_label(m_shptr->mutex_ref(), label);
+				}
+
+				static TAsyncSharedV2XWPReadOnlyAccessRequesterBase make(_TAccessLease&& exclusive_write_pointer) {
+					return TAsyncSharedV2XWPReadOnlyAccessRequesterBase(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
+				}
+
+				void async_shareable_and_passable_tag() const {}
+
+			protected:
+				TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> readlock_ptr() const {
+					return TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>(m_shptr);
+				}
+				mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr() const {
+					TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Rep, class _Period>
+				mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+					TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Rel_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+				template<class _Clock, class _Duration>
+				mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+					TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> ptr(m_shptr, std::try_to_lock, _Abs_time);
+					if (!ptr.is_valid()) {
+						return{};
+					}
+					return mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>>(std::move(ptr));
+				}
+
+			private:
+				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : m_shptr(shptr) {}
+				TAsyncSharedV2XWPReadOnlyAccessRequesterBase(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : m_shptr(std::forward<decltype(shptr)>(shptr)) {}
+
+				template<class _Ty2 = _TAccessLease, class = typename std::enable_if<(std::is_same<_Ty2, _TAccessLease>::value) && (std::is_base_of<mse::us::impl::ExclusivePointerTagBase, _TAccessLease>::value), void>::type>
+				void valid_if_TAccessLease_is_marked_as_an_exclusive_pointer() const {}
+
+#if !defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_REFCOUNTINGPOINTER_DISABLED) && !defined(MSE_NORADPOINTER_DISABLED)
+				template<class _Ty2 = _TAccessLease, class = typename std::enable_if<(std::is_same<_Ty2, _TAccessLease>::value) && (std::is_base_of<mse::us::impl::StrongPointerTagBase, _TAccessLease>::value), void>::type>
+#endif /*!defined(MSE_SCOPEPOINTER_DISABLED) && !defined(MSE_REFCOUNTINGPOINTER_DISABLED) && !defined(MSE_NORADPOINTER_DISABLED)*/
+				void valid_if_TAccessLease_is_marked_as_a_strong_pointer() const {}
+
+				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+				std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>> m_shptr;
+
+				friend class TXScopeAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+				friend class TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>;
+			};
+		}
+	}
+
+	template<typename _TAccessLease>
+	class TXScopeAsyncSharedV2XWPReadOnlyAccessRequester : public mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	public:
+		typedef mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease> base_class;
+		typedef typename std::remove_reference<decltype(*std::declval<_TAccessLease>())>::type target_type;
+		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(const TXScopeAsyncSharedV2XWPReadOnlyAccessRequester& src_cref) = default;
+		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(const TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>& src_cref) : base_class(src_cref) {}
+		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(_TAccessLease&& exclusive_write_pointer) : base_class(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2XWPReadOnlyAccessRequester() {
+			valid_if_target_type_is_marked_as_xscope_shareable_and_passable();
+		}
+
+		/* Prefer the "xscope_" prefixed versions to acknowledge that scope iterators are returned. */
+		auto readlock_ptr() const {
+			return base_class::xscope_readlock_ptr();
+		}
+		auto try_readlock_ptr() const {
+			return base_class::xscope_try_readlock_ptr();
+		}
+		template<class _Rep, class _Period>
+		auto try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+			return base_class::xscope_try_readlock_ptr_for(_Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		auto try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+			return base_class::xscope_try_readlock_ptr_until(_Abs_time);
+		}
+
+		static TXScopeAsyncSharedV2XWPReadOnlyAccessRequester make(_TAccessLease&& exclusive_write_pointer) {
+			return TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(std::make_shared<TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
+		}
+
+		void xscope_async_shareable_and_passable_tag() const {}
+
+	private:
+		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : base_class(std::forward<decltype(shptr)>(shptr)) {}
+		TXScopeAsyncSharedV2XWPReadOnlyAccessRequester& operator=(const TXScopeAsyncSharedV2XWPReadOnlyAccessRequester& _Right_cref) = delete;
+
+		/* If the target type is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
+		template<class _target_type2 = target_type, class = typename std::enable_if<(std::is_same<_target_type2, target_type>::value)
+			&& (mse::impl::is_marked_as_xscope_shareable_and_passable_msemsearray<_target_type2>::value), void>::type>
+		void valid_if_target_type_is_marked_as_xscope_shareable_and_passable() const {}
+
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+	};
+
+	template<typename _TAccessLease, class = MSE_IMPL_ENABLE_IF_NOT_RETURNABLE_FPARAM(_TAccessLease)>
+	auto make_xscope_asyncsharedv2xwpreadonly(_TAccessLease&& exclusive_write_pointer) {
+		return TXScopeAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>::make(std::forward<_TAccessLease>(exclusive_write_pointer));
+	}
+	/* Overloads for rsv::TReturnableFParam<>. */
+	MSE_OVERLOAD_FOR_RETURNABLE_FPARAM_DECLARATION(make_xscope_asyncsharedv2xwpreadonly)
+
+	template<typename _TAccessLease>
+	class TAsyncSharedV2XWPReadOnlyAccessRequester : public mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease>, public mse::us::impl::XScopeTagBase {
+	public:
+		typedef mse::us::impl::TAsyncSharedV2XWPReadOnlyAccessRequesterBase<_TAccessLease> base_class;
+		typedef typename std::remove_reference<decltype(*std::declval<_TAccessLease>())>::type target_type;
+		TAsyncSharedV2XWPReadOnlyAccessRequester(const TAsyncSharedV2XWPReadOnlyAccessRequester& src_cref) = default;
+		TAsyncSharedV2XWPReadOnlyAccessRequester(const TAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease>& src_cref) : base_class(src_cref) {}
+		TAsyncSharedV2XWPReadOnlyAccessRequester(_TAccessLease&& exclusive_write_pointer) : base_class(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2XWPReadOnlyAccessRequester() {
+			mse::impl::T_valid_if_not_an_xscope_type<_TAccessLease>();
+			valid_if_target_type_is_marked_as_shareable();
+		}
+
+		TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease> readlock_ptr() const {
+			return base_class::readlock_ptr();
+		}
+		mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr() const {
+			return base_class::try_readlock_ptr();
+		}
+		template<class _Rep, class _Period>
+		mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) const {
+			return base_class::try_readlock_ptr_for(_Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		mse::mstd::optional<TAsyncSharedV2ReadOnlyConstPointer<_TAccessLease>> try_readlock_ptr_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) const {
+			return base_class::try_readlock_ptr_until(_Abs_time);
+		}
+
+		static TAsyncSharedV2XWPReadOnlyAccessRequester make(_TAccessLease&& exclusive_write_pointer) {
+			return TAsyncSharedV2XWPReadOnlyAccessRequester(std::make_shared<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>(std::forward<decltype(exclusive_write_pointer)>(exclusive_write_pointer)));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		TAsyncSharedV2XWPReadOnlyAccessRequester(const std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>& shptr) : base_class(shptr) {}
+		TAsyncSharedV2XWPReadOnlyAccessRequester(std::shared_ptr<const TAsyncSharedXWPAccessLeaseObj<_TAccessLease>>&& shptr) : base_class(std::forward<decltype(shptr)>(shptr)) {}
+
+		/* If the target type is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
+		template<class _target_type2 = target_type, class = typename std::enable_if<(std::is_same<_target_type2, target_type>::value) && (
+			mse::impl::is_marked_as_shareable_msemsearray<_target_type2>::value), void>::type>
+			void valid_if_target_type_is_marked_as_shareable() const {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+	};
+
+	template<typename _TAccessLease>
+	TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease> make_asyncsharedv2xwpreadonly(_TAccessLease&& exclusive_write_pointer) {
+		return TAsyncSharedV2XWPReadOnlyAccessRequester<_TAccessLease>::make(std::forward<_TAccessLease>(exclusive_write_pointer));
+	}
+
+#ifdef MSESCOPE_H_
+	template<typename _Ty> using TXScopeAsyncSharedV2ReadOnlyConstStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2ReadOnlyConstPointer<_Ty> >;
+#endif // MSESCOPE_H_
+
+	template <typename _Ty, class _TAccessMutex = async_shared_timed_mutex_type> class TAsyncSharedV2ReadWriteAccessRequester;
+	template <typename _Ty, class _TAccessMutex = async_shared_timed_mutex_type> class TAsyncSharedV2ReadOnlyAccessRequester;
+
+	namespace us {
+		namespace impl {
+			template <typename _Ty, class _TAccessMutex = async_shared_timed_mutex_type>
+			class TTaggedUniquePtr : public std::unique_ptr<_Ty>, public mse::us::impl::StrongExclusivePointerTagBase {
+			public:
+				typedef _TAccessMutex async_shared_access_mutex_type;
+			private:
+				typedef std::unique_ptr<_Ty> base_class;
+				TTaggedUniquePtr(std::unique_ptr<_Ty>&& uqptr) : base_class(std::forward<decltype(uqptr)>(uqptr)) {}
+
+				template <typename _Ty2, class _TAccessMutex2> friend class mse::TAsyncSharedV2ReadWriteAccessRequester;
+				template <typename _Ty2, class _TAccessMutex2> friend class mse::TAsyncSharedV2ReadOnlyAccessRequester;
+			};
+		}
+	}
+
+	template<typename _Ty, class _TAccessMutex = async_shared_timed_mutex_type> class TAsyncSharedV2WeakReadWriteAccessRequester;
+
+	/* The (optional) _TAccessMutex template parameter specifies the type of mutex used to control access to the
+	shared object. See spin_shared_mutex, ticket_shared_mutex and brlock_shared_mutex. */
+	template <typename _Ty, class _TAccessMutex/* = async_shared_timed_mutex_type*/>
+	class TAsyncSharedV2ReadWriteAccessRequester : public TAsyncSharedV2XWPReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex> > {
+	public:
+		typedef TAsyncSharedV2XWPReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex> > base_class;
+		typedef decltype(std::declval<base_class>().writelock_ptr()) writelock_ptr_t;
+		typedef decltype(std::declval<base_class>().readlock_ptr()) readlock_ptr_t;
+		typedef decltype(std::declval<base_class>().xscope_writelock_ptr()) xscope_writelock_ptr_t;
+		typedef decltype(std::declval<base_class>().xscope_readlock_ptr()) xscope_readlock_ptr_t;
+
+		TAsyncSharedV2ReadWriteAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester& src_cref) = default;
+
+		~TAsyncSharedV2ReadWriteAccessRequester() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			valid_if_Ty_is_marked_as_shareable();
+			valid_if_Ty_is_not_an_xscope_type();
+		}
+
+		template <class... Args>
+		static TAsyncSharedV2ReadWriteAccessRequester make(Args&&... args) {
+			return TAsyncSharedV2ReadWriteAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex>(std::make_unique<_Ty>(std::forward<Args>(args)...)));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value, void>::type>
+		void valid_if_Ty_is_marked_as_shareable() const {}
+
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		TAsyncSharedV2ReadWriteAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex>&& uqptr) : base_class(make_asyncsharedv2xwpreadwrite(std::forward<decltype(uqptr)>(uqptr))) {}
+		TAsyncSharedV2ReadWriteAccessRequester(const base_class& src) : base_class(src) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class TAsyncSharedV2WeakReadWriteAccessRequester<_Ty, _TAccessMutex>;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2ReadWriteAccessRequester<X> make_asyncsharedv2readwrite(Args&&... args) {
+		return TAsyncSharedV2ReadWriteAccessRequester<X>::make(std::forward<Args>(args)...);
+	}
+
+	template<typename _Ty, class _TAccessMutex/* = async_shared_timed_mutex_type*/>
+	class TAsyncSharedV2WeakReadWriteAccessRequester : public TAsyncSharedV2XWPWeakReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex> > {
+	public:
+		typedef TAsyncSharedV2XWPWeakReadWriteAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex> > base_class;
+		TAsyncSharedV2WeakReadWriteAccessRequester(const TAsyncSharedV2WeakReadWriteAccessRequester&) = default;
+		TAsyncSharedV2WeakReadWriteAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TAccessMutex>& src) : base_class(src) {}
+
+		mse::mstd::optional<TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TAccessMutex>> try_strong_access_requester() const {
+			return try_strong_access_requester_helper1(base_class::try_strong_access_requester());
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		mse::mstd::optional<TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TAccessMutex>> try_strong_access_requester_helper1(decltype(std::declval<base_class>().try_strong_access_requester())&& base_maybe_ar) const {
+			if (base_maybe_ar) {
+				return TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TAccessMutex>(std::forward<decltype(base_maybe_ar.value())>(base_maybe_ar.value()));
+			}
+			else {
+				return {};
+			}
+		}
+	};
+
+#ifdef MSE_HAS_CXX17
+	/* deduction guide */
+	template<typename _TAccessLease, class _TAccessMutex>
+	TAsyncSharedV2WeakReadWriteAccessRequester(TAsyncSharedV2ReadWriteAccessRequester<_TAccessLease, _TAccessMutex>)->TAsyncSharedV2WeakReadWriteAccessRequester<_TAccessLease, _TAccessMutex>;
+#endif /* MSE_HAS_CXX17 */
+
+	template <typename _Ty, class _TAccessMutex/* = async_shared_timed_mutex_type*/>
+	class TAsyncSharedV2ReadOnlyAccessRequester : public TAsyncSharedV2XWPReadOnlyAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex> > {
+	public:
+		typedef TAsyncSharedV2XWPReadOnlyAccessRequester<mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex> > base_class;
+		typedef decltype(std::declval<base_class>().readlock_ptr()) readlock_ptr_t;
+		typedef decltype(std::declval<base_class>().xscope_readlock_ptr()) xscope_readlock_ptr_t;
+
+		TAsyncSharedV2ReadOnlyAccessRequester(const TAsyncSharedV2ReadOnlyAccessRequester& src_cref) = default;
+		TAsyncSharedV2ReadOnlyAccessRequester(const TAsyncSharedV2ReadWriteAccessRequester<_Ty, _TAccessMutex>& src_cref) : base_class(src_cref) {}
+
+		~TAsyncSharedV2ReadOnlyAccessRequester() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			valid_if_Ty_is_marked_as_shareable();
+			valid_if_Ty_is_not_an_xscope_type();
+		}
+
+		template <class... Args>
+		static TAsyncSharedV2ReadOnlyAccessRequester make(Args&&... args) {
+			return TAsyncSharedV2ReadOnlyAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex>(std::make_unique<_Ty>(std::forward<Args>(args)...)));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value, void>::type>
+		void valid_if_Ty_is_marked_as_shareable() const {}
+
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		TAsyncSharedV2ReadOnlyAccessRequester(mse::us::impl::TTaggedUniquePtr<_Ty, _TAccessMutex>&& uqptr) : base_class(make_asyncsharedv2xwpreadonly(std::forward<decltype(uqptr)>(uqptr))) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2ReadOnlyAccessRequester<X> make_asyncsharedv2readonly(Args&&... args) {
+		return TAsyncSharedV2ReadOnlyAccessRequester<X>::make(std::forward<Args>(args)...);
+	}
+
+	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex>
+	class TXScopeAsyncSharedV2ACOReadWriteAccessRequester
+		: public TXScopeAsyncSharedV2XWPReadWriteAccessRequester<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> {
+	public:
+		typedef TXScopeAsyncSharedV2XWPReadWriteAccessRequester<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> base_class;
+		typedef decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer()) _TExclusiveWritePointer;
+
+		TXScopeAsyncSharedV2ACOReadWriteAccessRequester(const TXScopeAsyncSharedV2ACOReadWriteAccessRequester& src_cref) = default;
+
+		~TXScopeAsyncSharedV2ACOReadWriteAccessRequester() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			valid_if_Ty_is_marked_as_xscope_shareable();
+		}
+
+		typedef mse::TXScopeFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> > xsac_obj_xscpptr_t;
+		typedef mse::TXScopeFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> > ac_obj_xscpptr_t;
+		static auto make(const xsac_obj_xscpptr_t& xscpptr) {
+			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
+		}
+		static auto make(const ac_obj_xscpptr_t& xscpptr) {
+			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
+		}
+#ifndef MSE_SCOPEPOINTER_DISABLED
+		typedef mse::TXScopeObjFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> > xsac_obj_xscpfptr_t;
+		typedef mse::TXScopeObjFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> > ac_obj_xscpfptr_t;
+		static auto make(const xsac_obj_xscpfptr_t& xscpptr) {
+			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
+		}
+		static auto make(const ac_obj_xscpfptr_t& xscpptr) {
+			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester((*xscpptr).exclusive_pointer());
+		}
+#endif //!MSE_SCOPEPOINTER_DISABLED
+		static auto make(mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex>& xs_aco) {
+			return TXScopeAsyncSharedV2ACOReadWriteAccessRequester(xs_aco.exclusive_pointer());
+		}
+		static void make(mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex>&&) = delete;
+
+		void xscope_async_shareable_and_passable_tag() const {}
+
+	private:
+		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "xscope_async_shareable_and_passable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value)
+			&& (mse::impl::is_marked_as_xscope_shareable_msemsearray<_Ty2>::value), void>::type>
+		void valid_if_Ty_is_marked_as_xscope_shareable() const {}
+
+		TXScopeAsyncSharedV2ACOReadWriteAccessRequester(_TExclusiveWritePointer&& xwptr)
+			: base_class(make_xscope_asyncsharedv2xwpreadwrite(std::forward<decltype(xwptr)>(xwptr))) {}
+
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+	};
+
+	template <typename TXScopeAccessControlledObj1>
+	auto make_xscope_asyncsharedv2acoreadwrite(const mse::TXScopeFixedPointer<TXScopeAccessControlledObj1>& xscpptr)
+		-> TXScopeAsyncSharedV2ACOReadWriteAccessRequester<typename TXScopeAccessControlledObj1::object_type, typename TXScopeAccessControlledObj1::access_mutex_type> {
+		return TXScopeAsyncSharedV2ACOReadWriteAccessRequester<typename TXScopeAccessControlledObj1::object_type, typename TXScopeAccessControlledObj1::access_mutex_type>::make(xscpptr);
+	}
+#ifndef MSE_SCOPEPOINTER_DISABLED
+	template <typename TXScopeAccessControlledObj1>
+	auto make_xscope_asyncsharedv2acoreadwrite(const mse::TXScopeObjFixedPointer<TXScopeAccessControlledObj1>& xscpptr)
+		-> TXScopeAsyncSharedV2ACOReadWriteAccessRequester<typename TXScopeAccessControlledObj1::object_type, typename TXScopeAccessControlledObj1::access_mutex_type> {
+		return TXScopeAsyncSharedV2ACOReadWriteAccessRequester<typename TXScopeAccessControlledObj1::object_type, typename TXScopeAccessControlledObj1::access_mutex_type>::make(xscpptr);
+	}
+#endif //!MSE_SCOPEPOINTER_DISABLED
+	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex>
+	auto make_xscope_asyncsharedv2acoreadwrite(mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex>& xs_aco)
+		-> TXScopeAsyncSharedV2ACOReadWriteAccessRequester<_Ty, _TAccessMutex> {
+		return TXScopeAsyncSharedV2ACOReadWriteAccessRequester<_Ty, _TAccessMutex>::make(xs_aco);
+	}
+	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex, class = MSE_IMPL_ENABLE_IF_NOT_RETURNABLE_FPARAM(_Ty)>
+	void make_xscope_asyncsharedv2acoreadwrite(mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex>&& xs_aco) = delete;
+	/* Overloads for rsv::TReturnableFParam<>. */
+	MSE_OVERLOAD_FOR_RETURNABLE_FPARAM_DECLARATION(make_xscope_asyncsharedv2acoreadwrite)
+
+
+	/* xscope_lock_all() obtains (xscope) lock pointers from multiple access requesters "all at once", without risk of
+	deadlock (regardless of the order in which other threads obtain them). Each argument specifies an access requester
+	and whether a write lock or read lock is to be obtained from it. For example:
+
+	auto [xs_writelock_ptr1, xs_readlock_ptr2] = mse::xscope_lock_all(mse::writelock_request(ar1), mse::readlock_request(ar2));
+
+	Like std::lock(), it uses a "try and back off" algorithm. It blocks on one of the locks, then attempts to obtain the
+	others without blocking. If any of those attempts fail, all the obtained locks are released and the process is
+	repeated, this time blocking on the lock that couldn't be obtained. */
+
+	namespace impl {
+		namespace ns_lock_all {
+			template<typename _TAccessRequester>
+			class writelock_request_t {
+			public:
+				typedef decltype(std::declval<const _TAccessRequester&>().xscope_writelock_ptr()) pointer_type;
+
+				explicit writelock_request_t(const _TAccessRequester& access_requester) : m_access_requester(access_requester) {}
+				pointer_type lock() const { return m_access_requester.xscope_writelock_ptr(); }
+				auto try_lock() const { return m_access_requester.xscope_try_writelock_ptr(); }
+			private:
+				/* Access requesters are cheap to copy (they just hold a shared_ptr), and holding a copy means the request
+				can't outlive the requester. */
+				_TAccessRequester m_access_requester;
+			};
+			template<typename _TAccessRequester>
+			class readlock_request_t {
+			public:
+				typedef decltype(std::declval<const _TAccessRequester&>().xscope_readlock_ptr()) pointer_type;
+
+				explicit readlock_request_t(const _TAccessRequester& access_requester) : m_access_requester(access_requester) {}
+				pointer_type lock() const { return m_access_requester.xscope_readlock_ptr(); }
+				auto try_lock() const { return m_access_requester.xscope_try_readlock_ptr(); }
+			private:
+				_TAccessRequester m_access_requester;
+			};
+
+			template<size_t I, typename _TRequestTuple, typename _TMaybePointerTuple>
+			bool lock_one(const _TRequestTuple& requests, _TMaybePointerTuple& maybe_ptrs) {
+				std::get<I>(maybe_ptrs).emplace(std::get<I>(requests).lock());
+				return true;
+			}
+			template<size_t I, typename _TRequestTuple, typename _TMaybePointerTuple>
+			bool try_lock_one(const _TRequestTuple& requests, _TMaybePointerTuple& maybe_ptrs) {
+				auto maybe_ptr = std::get<I>(requests).try_lock();
+				if (!maybe_ptr) {
+					return false;
+				}
+				std::get<I>(maybe_ptrs).emplace(std::move(maybe_ptr.value()));
+				return true;
+			}
+			template<size_t I, typename _TMaybePointerTuple>
+			bool unlock_one(_TMaybePointerTuple& maybe_ptrs) {
+				std::get<I>(maybe_ptrs).reset();
+				return true;
+			}
+
+			template<typename _TRequestTuple, typename _TMaybePointerTuple, size_t... Is>
+			auto lock_all_helper1(const _TRequestTuple& requests, _TMaybePointerTuple& maybe_ptrs, std::index_sequence<Is...>) {
+				typedef bool(*lock_function_t)(const _TRequestTuple&, _TMaybePointerTuple&);
+				const lock_function_t lock_functions[] = { &lock_one<Is, _TRequestTuple, _TMaybePointerTuple>... };
+				const lock_function_t try_lock_functions[] = { &try_lock_one<Is, _TRequestTuple, _TMaybePointerTuple>... };
+				const size_t count = sizeof...(Is);
+
+				size_t first_index = 0;
+				while (true) {
+					lock_functions[first_index](requests, maybe_ptrs);
+					size_t failed_index = count;
+					for (size_t i = 1; count > i; i += 1) {
+						const size_t index = (first_index + i) % count;
+						if (!try_lock_functions[index](requests, maybe_ptrs)) {
+							failed_index = index;
+							break;
+						}
+					}
+					if (count == failed_index) {
+						break;
+					}
+					/* Release the obtained locks (and give the thread holding the contended lock a chance to proceed)
+					before blocking on the lock that couldn't be obtained. */
+					std::initializer_list<bool>{ unlock_one<Is>(maybe_ptrs)... };
+					std::this_thread::yield();
+					first_index = failed_index;
+				}
+				return std::make_tuple(std::move(std::get<Is>(maybe_ptrs).value())...);
+			}
+		}
+	}
+
+	template<typename _TAccessRequester>
+	auto writelock_request(const _TAccessRequester& access_requester) {
+		return mse::impl::ns_lock_all::writelock_request_t<_TAccessRequester>(access_requester);
+	}
+	template<typename _TAccessRequester>
+	auto readlock_request(const _TAccessRequester& access_requester) {
+		return mse::impl::ns_lock_all::readlock_request_t<_TAccessRequester>(access_requester);
+	}
+
+	template<typename... _TLockRequests>
+	auto xscope_lock_all(const _TLockRequests&... lock_requests) {
+		static_assert(1 <= sizeof...(_TLockRequests), "xscope_lock_all() requires at least one lock request");
+		const auto requests = std::tie(lock_requests...);
+		std::tuple<mse::xscope_optional<typename _TLockRequests::pointer_type>...> maybe_ptrs;
+		return mse::impl::ns_lock_all::lock_all_helper1(requests, maybe_ptrs, std::index_sequence_for<_TLockRequests...>());
+	}
+
+
+	/* For situations where the shared object is immutable (i.e. is never modified), you don't even need locks or access requesters. */
+	template<typename _Ty>
+	class TAsyncSharedV2ImmutableFixedPointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
+	public:
+		TAsyncSharedV2ImmutableFixedPointer(const TAsyncSharedV2ImmutableFixedPointer& src_cref) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2ImmutableFixedPointer() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			valid_if_Ty_is_marked_as_shareable();
+			valid_if_Ty_is_not_an_xscope_type();
+		}
+
+		operator bool() const {
+			return m_shptr.operator bool();
+		}
+		const auto& operator*() const {
+			return (*m_shptr);
+		}
+		const auto operator->() const {
+			return std::addressof(*m_shptr);
+		}
+
+		/* This operator is just for compatibility with existing/legacy code. */
+		explicit operator std::shared_ptr<const _Ty>() const { return m_shptr; }
+
+		template <class... Args>
+		static TAsyncSharedV2ImmutableFixedPointer make(Args&&... args) {
+			return TAsyncSharedV2ImmutableFixedPointer(std::make_shared<const _Ty>(std::forward<Args>(args)...));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value, void>::type>
+		void valid_if_Ty_is_marked_as_shareable() const {}
+
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		TAsyncSharedV2ImmutableFixedPointer(std::shared_ptr<const _Ty> shptr) : m_shptr(shptr) {}
+		TAsyncSharedV2ImmutableFixedPointer<_Ty>& operator=(const TAsyncSharedV2ImmutableFixedPointer<_Ty>& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<const _Ty> m_shptr;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2ImmutableFixedPointer<X> make_asyncsharedv2immutable(Args&&... args) {
+		return TAsyncSharedV2ImmutableFixedPointer<X>::make(std::forward<Args>(args)...);
+	}
+
+#ifdef MSESCOPE_H_
+	template<typename _Ty> using TXScopeAsyncSharedV2ImmutableFixedStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2ImmutableFixedPointer<_Ty> >;
+#endif // MSESCOPE_H_
+
+
+	/* For situations where the shared object is read much more frequently than it is modified, the RCU ("read-copy-update")
+	access requester provides (wait-free) read access to immutable "snapshots" of the object. Modification is done by
+	copying the current snapshot, modifying the copy and then (atomically) publishing it as the new current snapshot.
+	Superseded snapshots are destroyed once no read pointer to them remains. */
+
+	template<typename _Ty> class TAsyncSharedV2RCUAccessRequester;
+	template<typename _Ty> class TXScopeAsyncSharedV2RCUConstPointer;
+	template<typename _Ty> class TAsyncSharedV2RCUConstPointer;
+
+	namespace impl {
+		namespace ns_rcu {
+			/* The state shared by an RCU access requester (and its copies) and the read pointers it issues. Superseded
+			snapshots are reclaimed using an "epoch based" scheme. Read pointers register themselves by incrementing one
+			of three counters (corresponding to the current epoch modulo three) in a reader "slot" before obtaining the
+			current snapshot. The epoch is only advanced when none of the reader slots has a reader registered in any
+			epoch other than the current one, so a snapshot superseded in a given epoch can no longer be referenced by
+			any reader once the epoch has been advanced twice (since then). */
+			template<typename _Ty>
+			class TRCUState {
+			public:
+				static const size_t sc_reader_slot_count = 16;
+				typedef std::atomic<uint32_t> reader_count_type;
+
+				explicit TRCUState(std::unique_ptr<const _Ty>&& uqptr) : m_current(uqptr.release()) {}
+				~TRCUState() {
+					if (has_registered_readers()) {
+						/* It would be unsafe to allow the state to be destroyed as there are outstanding (scope) read
+						pointers borrowing it. */
+#ifdef MSE_CUSTOM_FATAL_ERROR_MESSAGE_HANDLER
+						MSE_CUSTOM_FATAL_ERROR_MESSAGE_HANDLER("Fatal Error: mse::TAsyncSharedV2RCUAccessRequester<> state destructed with outstanding read pointers \n");
+#endif // MSE_CUSTOM_FATAL_ERROR_MESSAGE_HANDLER
+						assert(false); std::terminate();
+					}
+					delete m_current.load(std::memory_order_relaxed);
+					for (auto& retired : m_retired) {
+						delete retired.m_ptr;
+					}
+				}
+
+				/* Registers a reader and returns the current snapshot. The returned counter must be passed to
+				exit_read(). */
+				const _Ty* enter_read(reader_count_type*& reader_count_ptr) {
+					auto& slot = m_reader_slots[mse::impl::ns_access_mutex::this_thread_round_robin_index() % sc_reader_slot_count];
+					reader_count_ptr = &(slot.m_counts[m_epoch.load(std::memory_order_relaxed) % 3]);
+					/* The (sequentially consistent) increment of the counter followed by the load of the snapshot pointer is
+					the mirror image of the writer's replacement of the snapshot pointer followed by its inspection of the
+					counters. So either the writer will see the reader, or the reader will see the new snapshot. */
+					reader_count_ptr->fetch_add(1, std::memory_order_seq_cst);
+					return m_current.load(std::memory_order_seq_cst);
+				}
+				static void exit_read(reader_count_type* reader_count_ptr) {
+					reader_count_ptr->fetch_sub(1, std::memory_order_release);
+				}
+
+				template<typename _TFunction>
+				void update(const _TFunction& func) {
+					std::lock_guard<std::mutex> lock(m_writer_mutex);
+					std::unique_ptr<_Ty> uqptr(new _Ty(*m_current.load(std::memory_order_relaxed)));
+					func(*uqptr);
+					publish_while_locked(std::move(uqptr));
+				}
+				void replace(std::unique_ptr<_Ty>&& uqptr) {
+					std::lock_guard<std::mutex> lock(m_writer_mutex);
+					publish_while_locked(std::move(uqptr));
+				}
+				void reclaim() {
+					std::lock_guard<std::mutex> lock(m_writer_mutex);
+					reclaim_while_locked();
+				}
+
+			private:
+				bool has_registered_readers() const {
+					for (const auto& slot : m_reader_slots) {
+						for (const auto& count : slot.m_counts) {
+							if (0 != count.load(std::memory_order_acquire)) {
+								return true;
+							}
+						}
+					}
+					return false;
+				}
+				void publish_while_locked(std::unique_ptr<_Ty>&& uqptr) {
+					m_retired.reserve(m_retired.size() + 1);
+					const _Ty* old_ptr = m_current.exchange(uqptr.release(), std::memory_order_seq_cst);
+					m_retired.push_back(retired_t{ old_ptr, m_epoch.load(std::memory_order_relaxed) });
+					reclaim_while_locked();
+				}
+				void reclaim_while_locked() {
+					if (m_retired.empty()) {
+						return;
+					}
+					for (int i = 0; 2 > i; i += 1) {
+						if (!try_advance_epoch_while_locked()) {
+							break;
+						}
+					}
+					const auto epoch = m_epoch.load(std::memory_order_relaxed);
+					auto first_unreclaimable = std::partition(m_retired.begin(), m_retired.end(), [epoch](const retired_t& retired) {
+						return (epoch < retired.m_epoch + 2);
+					});
+					for (auto it = first_unreclaimable; m_retired.end() != it; it++) {
+						delete it->m_ptr;
+					}
+					m_retired.erase(first_unreclaimable, m_retired.end());
+				}
+				bool try_advance_epoch_while_locked() {
+					const auto epoch = m_epoch.load(std::memory_order_relaxed);
+					for (auto& slot : m_reader_slots) {
+						for (size_t i = 1; 3 > i; i += 1) {
+							if (0 != slot.m_counts[(epoch + i) % 3].load(std::memory_order_seq_cst)) {
+								return false;
+							}
+						}
+					}
+					m_epoch.store(epoch + 1, std::memory_order_seq_cst);
+					return true;
+				}
+
+				struct reader_slot_t {
+					reader_count_type m_counts[3] = { {0}, {0}, {0} };
+					/* Padding to keep each slot on its own cache line. */
+					char m_padding[mse::impl::sc_cache_line_size - 3 * sizeof(reader_count_type)];
+				};
+				struct retired_t {
+					const _Ty* m_ptr;
+					uint64_t m_epoch;
+				};
+
+				reader_slot_t m_reader_slots[sc_reader_slot_count];
+				std::atomic<const _Ty*> m_current;
+				std::atomic<uint64_t> m_epoch{ 0 };
+				std::mutex m_writer_mutex;
+				std::vector<retired_t> m_retired;
+			};
+		}
+	}
+
+	namespace us {
+		namespace impl {
+			/* The (non-scope) read pointer holds a shared_ptr to the state. The scope read pointer just borrows the
+			state from the access requester. */
+			template<typename _Ty, typename _TStatePointer>
+			class TAsyncSharedV2RCUConstPointerBase : public mse::us::impl::AsyncSharedStrongPointerNeverNullAsyncNotPassableTagBase {
+			public:
+				typedef mse::impl::ns_rcu::TRCUState<_Ty> state_t;
+
+				TAsyncSharedV2RCUConstPointerBase(const TAsyncSharedV2RCUConstPointerBase& src) : m_state_ptr(src.m_state_ptr), m_ptr(src.m_ptr), m_reader_count_ptr(src.m_reader_count_ptr) {
+					/* The snapshot is already protected by the source's registration, so registering another reader with
+					the same counter suffices. */
+					if (m_reader_count_ptr) {
+						m_reader_count_ptr->fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+				TAsyncSharedV2RCUConstPointerBase(TAsyncSharedV2RCUConstPointerBase&& src) : m_state_ptr(std::move(src.m_state_ptr)), m_ptr(src.m_ptr), m_reader_count_ptr(src.m_reader_count_ptr) {
+					src.m_ptr = nullptr;
+					src.m_reader_count_ptr = nullptr;
+				}
+				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2RCUConstPointerBase() {
+					if (m_reader_count_ptr) {
+						state_t::exit_read(m_reader_count_ptr);
+					}
+				}
+
+				operator bool() const {
+					return (nullptr != m_reader_count_ptr);
+				}
+				const _Ty& operator*() const {
+					return (*checked_ptr());
+				}
+				const _Ty* operator->() const {
+					return checked_ptr();
+				}
+				void async_not_passable_tag() const {}
+
+			private:
+				TAsyncSharedV2RCUConstPointerBase(const _TStatePointer& state_ptr) : m_state_ptr(state_ptr) {
+					m_ptr = m_state_ptr->enter_read(m_reader_count_ptr);
+				}
+				TAsyncSharedV2RCUConstPointerBase& operator=(const TAsyncSharedV2RCUConstPointerBase& _Right_cref) = delete;
+				TAsyncSharedV2RCUConstPointerBase& operator=(TAsyncSharedV2RCUConstPointerBase&& _Right) = delete;
+
+				const _Ty* checked_ptr() const {
+					if (!m_reader_count_ptr) { MSE_THROW(asyncshared_use_of_invalid_pointer_error("attempt to use invalid pointer - mse::TAsyncSharedV2RCUConstPointer")); }
+					return m_ptr;
+				}
+
+				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+				_TStatePointer m_state_ptr;
+				const _Ty* m_ptr = nullptr;
+				typename state_t::reader_count_type* m_reader_count_ptr = nullptr;
+
+				friend class TXScopeAsyncSharedV2RCUConstPointer<_Ty>;
+				friend class TAsyncSharedV2RCUConstPointer<_Ty>;
+			};
+		}
+	}
+
+	template<typename _Ty>
+	class TXScopeAsyncSharedV2RCUConstPointer : public mse::us::impl::TAsyncSharedV2RCUConstPointerBase<_Ty, mse::impl::ns_rcu::TRCUState<_Ty>*>, public mse::us::impl::XScopeTagBase {
+	public:
+		typedef mse::us::impl::TAsyncSharedV2RCUConstPointerBase<_Ty, mse::impl::ns_rcu::TRCUState<_Ty>*> base_class;
+
+		TXScopeAsyncSharedV2RCUConstPointer(const TXScopeAsyncSharedV2RCUConstPointer& src) = default;
+		TXScopeAsyncSharedV2RCUConstPointer(TXScopeAsyncSharedV2RCUConstPointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSharedV2RCUConstPointer() {}
+
+		void async_not_passable_tag() const {}
+	private:
+		TXScopeAsyncSharedV2RCUConstPointer(typename base_class::state_t* state_ptr) : base_class(state_ptr) {}
+
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		friend class TAsyncSharedV2RCUAccessRequester<_Ty>;
+	};
+
+	template<typename _Ty>
+	class TAsyncSharedV2RCUConstPointer : public mse::us::impl::TAsyncSharedV2RCUConstPointerBase<_Ty, std::shared_ptr<mse::impl::ns_rcu::TRCUState<_Ty> > > {
+	public:
+		typedef mse::us::impl::TAsyncSharedV2RCUConstPointerBase<_Ty, std::shared_ptr<mse::impl::ns_rcu::TRCUState<_Ty> > > base_class;
+
+		TAsyncSharedV2RCUConstPointer(const TAsyncSharedV2RCUConstPointer& src) = default;
+		TAsyncSharedV2RCUConstPointer(TAsyncSharedV2RCUConstPointer&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2RCUConstPointer() {}
+
+		void async_not_passable_tag() const {}
+	private:
+		TAsyncSharedV2RCUConstPointer(const std::shared_ptr<typename base_class::state_t>& state_shptr) : base_class(state_shptr) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class TAsyncSharedV2RCUAccessRequester<_Ty>;
+	};
+
+	template<typename _Ty>
+	class TAsyncSharedV2RCUAccessRequester {
+	public:
+		typedef TAsyncSharedV2RCUConstPointer<_Ty> readlock_ptr_t;
+
+		TAsyncSharedV2RCUAccessRequester(const TAsyncSharedV2RCUAccessRequester& src_cref) = default;
+
+		~TAsyncSharedV2RCUAccessRequester() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			valid_if_Ty_is_marked_as_shareable();
+			valid_if_Ty_is_not_an_xscope_type();
+		}
+
+		/* Obtaining a read pointer never blocks (and never waits on writers). The read pointer references the snapshot
+		that was current at the time it was obtained. */
+		TAsyncSharedV2RCUConstPointer<_Ty> readlock_ptr() const {
+			return TAsyncSharedV2RCUConstPointer<_Ty>(m_state_shptr);
+		}
+		/* The scope read pointer borrows the (shared) state from the access requester rather than copying the
+		shared_ptr to it, so obtaining one doesn't modify any shared reference count. */
+		TXScopeAsyncSharedV2RCUConstPointer<_Ty> xscope_readlock_ptr() const & {
+			return TXScopeAsyncSharedV2RCUConstPointer<_Ty>(m_state_shptr.get());
+		}
+		void xscope_readlock_ptr() const && = delete;
+
+		/* Calls the given function with a (modifiable) copy of the current snapshot, then publishes the copy as the
+		new current snapshot. Writers are serialized, so concurrent updates are not lost. */
+		template<typename _TFunction>
+		void update(const _TFunction& func) {
+			m_state_shptr->update(func);
+		}
+		/* Publishes a newly constructed object as the new current snapshot. */
+		template <class... Args>
+		void replace(Args&&... args) {
+			m_state_shptr->replace(std::make_unique<_Ty>(std::forward<Args>(args)...));
+		}
+		/* Superseded snapshots are reclaimed (when possible) during updates. This function can be used to reclaim
+		them without doing an update. */
+		void reclaim() {
+			m_state_shptr->reclaim();
+		}
+
+		template <class... Args>
+		static TAsyncSharedV2RCUAccessRequester make(Args&&... args) {
+			return TAsyncSharedV2RCUAccessRequester(std::make_shared<state_t>(std::unique_ptr<const _Ty>(std::make_unique<_Ty>(std::forward<Args>(args)...))));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		typedef mse::impl::ns_rcu::TRCUState<_Ty> state_t;
+
+		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value, void>::type>
+		void valid_if_Ty_is_marked_as_shareable() const {}
+
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		TAsyncSharedV2RCUAccessRequester(std::shared_ptr<state_t>&& state_shptr) : m_state_shptr(std::move(state_shptr)) {}
+		TAsyncSharedV2RCUAccessRequester& operator=(const TAsyncSharedV2RCUAccessRequester& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<state_t> m_state_shptr;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2RCUAccessRequester<X> make_asyncsharedv2rcu(Args&&... args) {
+		return TAsyncSharedV2RCUAccessRequester<X>::make(std::forward<Args>(args)...);
+	}
+
+
+	/* For situations where the shared object is atomic, you don't need locks or access requesters. */
+	template<typename _Ty>
+	class TAsyncSharedV2AtomicFixedPointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
+	public:
+		TAsyncSharedV2AtomicFixedPointer(const TAsyncSharedV2AtomicFixedPointer& src_cref) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2AtomicFixedPointer() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			//valid_if_Ty_is_marked_as_shareable();
+			mse::impl::T_valid_if_is_marked_as_shareable_msemsearray<_Ty>();
+			valid_if_Ty_is_not_an_xscope_type();
+		}
+
+		operator bool() const {
+			return m_shptr.operator bool();
+		}
+		auto& operator*() const {
+			return (*m_shptr);
+		}
+		auto operator->() const {
+			return std::addressof(*m_shptr);
+		}
+
+		/* This operator is just for compatibility with existing/legacy code. */
+		explicit operator std::shared_ptr<std::atomic<_Ty> >() const { return m_shptr; }
+
+		template <class... Args>
+		static TAsyncSharedV2AtomicFixedPointer make(Args&&... args) {
+			return TAsyncSharedV2AtomicFixedPointer(std::make_shared<std::atomic<_Ty> >(std::forward<Args>(args)...));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		/* If _Ty is not "marked" as safe to share among threads (via the presence of the "async_shareable_tag()" member
+		function), then the following member function will not instantiate, causing an (intended) compile error. User-defined
+		objects can be marked safe to share by wrapping them with rsv::TUserDeclaredAsyncShareableObj<>. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && mse::impl::is_marked_as_shareable_and_passable_msemsearray<_Ty2>::value, void>::type>
+		void valid_if_Ty_is_marked_as_shareable() const {}
+
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		TAsyncSharedV2AtomicFixedPointer(std::shared_ptr<std::atomic<_Ty> > shptr) : m_shptr(shptr) {}
+		TAsyncSharedV2AtomicFixedPointer<_Ty>& operator=(const TAsyncSharedV2AtomicFixedPointer<_Ty>& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<std::atomic<_Ty> > m_shptr;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2AtomicFixedPointer<X> make_asyncsharedv2atomic(Args&&... args) {
+		return TAsyncSharedV2AtomicFixedPointer<X>::make(std::forward<Args>(args)...);
+	}
+
+#ifdef MSESCOPE_H_
+	template<typename _Ty> using TXScopeAsyncSharedV2AtomicFixedStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2AtomicFixedPointer<_Ty> >;
+#endif // MSESCOPE_H_
+
+
+	/* seqlock<> holds a (trivially copyable) value that can be read concurrently without locking. Readers copy the value
+	and retry if it was modified during the copy (as indicated by a change in a "sequence" counter), while writers are
+	serialized (via the sequence counter) and never wait on readers. It's intended for (small) values that are too large
+	to be (lock-free) atomic. Readers can be "starved" by a continuous stream of writes, so it's best suited to values
+	that are read much more often than they are modified. (Only the default constructor requires _Ty to be default
+	constructible.) */
+	template<typename _Ty>
+	class seqlock {
+	public:
+		static_assert(std::is_trivially_copyable<_Ty>::value, "seqlock<> requires a trivially copyable type");
+		typedef _Ty value_type;
+
+		seqlock() : seqlock(_Ty()) {}
+		seqlock(const _Ty& value) {
+			write_words(value);
+		}
+		seqlock(const seqlock&) = delete;
+		seqlock& operator=(const seqlock&) = delete;
+
+		_Ty load() const {
+			int spin_count = 0;
+			while (true) {
+				const auto sequence1 = m_sequence.load(std::memory_order_acquire);
+				if (0 == (sequence1 & 1)) {
+					_Ty retval = read_words();
+					/* The acquire fence ensures that if any of the (relaxed) loads of the value observed a store from a
+					concurrent write, then the subsequent load of the sequence counter will observe the change made by
+					that write. */
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (m_sequence.load(std::memory_order_relaxed) == sequence1) {
+						return retval;
+					}
+				}
+				mse::impl::ns_access_mutex::spin_pause(spin_count);
+			}
+		}
+		operator _Ty() const {
+			return load();
+		}
+		void store(const _Ty& value) {
+			const auto sequence = begin_write();
+			write_words(value);
+			end_write(sequence);
+		}
+		seqlock& operator=(const _Ty& value) {
+			store(value);
+			return (*this);
+		}
+		/* Calls the given function with a (modifiable) copy of the value, then stores the modified copy. Concurrent
+		writes are excluded for the duration. */
+		template<typename _TFunction>
+		void update(const _TFunction& func) {
+			const auto sequence = begin_write();
+			/* If the function throws, the write is abandoned (leaving the value unmodified). */
+			struct abandon_guard_t {
+				~abandon_guard_t() {
+					if (m_sequence_ptr) {
+						m_sequence_ptr->store(m_sequence, std::memory_order_release);
+					}
+				}
+				std::atomic<uint64_t>* m_sequence_ptr;
+				uint64_t m_sequence;
+			} abandon_guard{ std::addressof(m_sequence), sequence };
+			_Ty value = read_words();
+			func(value);
+			abandon_guard.m_sequence_ptr = nullptr;
+			write_words(value);
+			end_write(sequence);
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		typedef uint64_t word_type;
+		static const size_t sc_word_count = (sizeof(_Ty) + sizeof(word_type) - 1) / sizeof(word_type);
+
+		/* Obtains exclusive write access by making the sequence counter odd. Returns the (even) prior value. */
+		uint64_t begin_write() {
+			int spin_count = 0;
+			while (true) {
+				auto sequence = m_sequence.load(std::memory_order_relaxed);
+				if ((0 == (sequence & 1)) && m_sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+					/* Ensures that any reader that observes any of the subsequent stores to the value will also observe
+					the (odd) sequence counter. */
+					std::atomic_thread_fence(std::memory_order_release);
+					return sequence;
+				}
+				mse::impl::ns_access_mutex::spin_pause(spin_count);
+			}
+		}
+		void end_write(uint64_t sequence) {
+			m_sequence.store(sequence + 2, std::memory_order_release);
+		}
+
+		/* The value is stored as an array of atomic words (accessed with relaxed memory ordering) so that reads that
+		overlap a write are not data races. */
+		_Ty read_words() const {
+			word_type words[sc_word_count];
+			for (size_t i = 0; sc_word_count > i; i += 1) {
+				words[i] = m_words[i].load(std::memory_order_relaxed);
+			}
+			/* The value is copied out via (uninitialized) aligned storage, so _Ty need not be default constructible. */
+			typename std::aligned_storage<sizeof(_Ty), alignof(_Ty)>::type storage;
+			std::memcpy(std::addressof(storage), words, sizeof(_Ty));
+			return *reinterpret_cast<const _Ty*>(std::addressof(storage));
+		}
+		void write_words(const _Ty& value) {
+			word_type words[sc_word_count] = {};
+			std::memcpy(words, std::addressof(value), sizeof(_Ty));
+			for (size_t i = 0; sc_word_count > i; i += 1) {
+				m_words[i].store(words[i], std::memory_order_relaxed);
+			}
+		}
+
+		std::atomic<uint64_t> m_sequence{ 0 };
+		std::atomic<word_type> m_words[sc_word_count];
+	};
+
+	/* For situations where the shared object is small and trivially copyable, but not (lock-free) atomic, you can use a
+	seqlock<> instead of locks or access requesters. */
+	template<typename _Ty>
+	class TAsyncSharedV2SeqLockFixedPointer : public mse::us::impl::AsyncSharedStrongPointerNeverNullTagBase {
+	public:
+		TAsyncSharedV2SeqLockFixedPointer(const TAsyncSharedV2SeqLockFixedPointer& src_cref) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSharedV2SeqLockFixedPointer() {
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			mse::impl::T_valid_if_is_marked_as_shareable_msemsearray<_Ty>();
+			valid_if_Ty_is_not_an_xscope_type();
+		}
+
+		operator bool() const {
+			return m_shptr.operator bool();
+		}
+		auto& operator*() const {
+			return (*m_shptr);
+		}
+		auto operator->() const {
+			return std::addressof(*m_shptr);
+		}
+
+		template <class... Args>
+		static TAsyncSharedV2SeqLockFixedPointer make(Args&&... args) {
+			return TAsyncSharedV2SeqLockFixedPointer(std::make_shared<seqlock<_Ty> >(_Ty(std::forward<Args>(args)...)));
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		TAsyncSharedV2SeqLockFixedPointer(std::shared_ptr<seqlock<_Ty> > shptr) : m_shptr(shptr) {}
+		TAsyncSharedV2SeqLockFixedPointer<_Ty>& operator=(const TAsyncSharedV2SeqLockFixedPointer<_Ty>& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<seqlock<_Ty> > m_shptr;
+	};
+
+	template <class X, class... Args>
+	TAsyncSharedV2SeqLockFixedPointer<X> make_asyncsharedv2seqlock(Args&&... args) {
+		return TAsyncSharedV2SeqLockFixedPointer<X>::make(std::forward<Args>(args)...);
+	}
+
+#ifdef MSESCOPE_H_
+	template<typename _Ty> using TXScopeAsyncSharedV2SeqLockFixedStore = TXScopeStrongNotNullConstPointerStore<TAsyncSharedV2SeqLockFixedPointer<_Ty> >;
+#endif // MSESCOPE_H_
+
+
+#if defined(MSEPOINTERBASICS_H)
+	template<class _TTargetType, class _Ty>
+	us::TStrongFixedPointer<_TTargetType, typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::writelock_ptr_t> make_pointer_to_member(_TTargetType& target, const typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::writelock_ptr_t &lease_pointer) {
+		return us::TStrongFixedPointer<_TTargetType, typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::writelock_ptr_t>::make(target, lease_pointer);
+	}
+	template<class _TTargetType, class _Ty>
+	us::TStrongFixedConstPointer<_TTargetType, typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::readlock_ptr_t> make_const_pointer_to_member(const _TTargetType& target, const typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::readlock_ptr_t &lease_pointer) {
+		return us::TStrongFixedConstPointer<_TTargetType, typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::readlock_ptr_t>::make(target, lease_pointer);
+	}
+	template<class _TTargetType, class _Ty>
+	us::TStrongFixedConstPointer<_TTargetType, typename TAsyncSharedV2ReadOnlyAccessRequester<_Ty>::readlock_ptr_t> make_const_pointer_to_member(const _TTargetType& target, const typename TAsyncSharedV2ReadOnlyAccessRequester<_Ty>::readlock_ptr_t &lease_pointer) {
+		return us::TStrongFixedConstPointer<_TTargetType, typename TAsyncSharedV2ReadOnlyAccessRequester<_Ty>::readlock_ptr_t>::make(target, lease_pointer);
+	}
+	template<class _TTargetType, class _Ty>
+	us::TStrongFixedConstPointer<_TTargetType, TAsyncSharedV2ImmutableFixedPointer<_Ty>> make_const_pointer_to_member(const _TTargetType& target, const TAsyncSharedV2ImmutableFixedPointer<_Ty> &lease_pointer) {
+		return us::TStrongFixedConstPointer<_TTargetType, TAsyncSharedV2ImmutableFixedPointer<_Ty>>::make(target, lease_pointer);
+	}
+
+	template<class _Ty, class _TMemberObjectPointer>
+	static auto make_pointer_to_member_v2(const TAsyncSharedV2ReadWritePointer<_Ty> &lease_pointer, const _TMemberObjectPointer& member_object_ptr) {
+		typedef typename std::remove_reference<decltype((*lease_pointer).*member_object_ptr)>::type _TTarget;
+		mse::impl::make_pointer_to_member_v2_checks_msepointerbasics(lease_pointer, member_object_ptr);
+		return us::TStrongFixedPointer<_TTarget, TAsyncSharedV2ReadWritePointer<_Ty> >::make((*lease_pointer).*member_object_ptr, lease_pointer);
+	}
+	template<class _Ty, class _TMemberObjectPointer>
+	static auto make_const_pointer_to_member_v2(const TAsyncSharedV2ReadWriteConstPointer<_Ty> &lease_pointer, const _TMemberObjectPointer& member_object_ptr) {
+		typedef typename std::remove_reference<decltype((*lease_pointer).*member_object_ptr)>::type _TTarget;
+		mse::impl::make_pointer_to_member_v2_checks_msepointerbasics(lease_pointer, member_object_ptr);
+		return us::TStrongFixedConstPointer<_TTarget, TAsyncSharedV2ReadWriteConstPointer<_Ty> >::make((*lease_pointer).*member_object_ptr, lease_pointer);
+	}
+	template<class _Ty, class _TMemberObjectPointer>
+	static auto make_const_pointer_to_member_v2(const TAsyncSharedV2ReadOnlyConstPointer<_Ty> &lease_pointer, const _TMemberObjectPointer& member_object_ptr) {
+		typedef typename std::remove_reference<decltype((*lease_pointer).*member_object_ptr)>::type _TTarget;
+		mse::impl::make_pointer_to_member_v2_checks_msepointerbasics(lease_pointer, member_object_ptr);
+		return us::TStrongFixedConstPointer<_TTarget, TAsyncSharedV2ReadOnlyConstPointer<_Ty> >::make((*lease_pointer).*member_object_ptr, lease_pointer);
+	}
+	template<class _Ty, class _TMemberObjectPointer>
+	static auto make_const_pointer_to_member_v2(const TAsyncSharedV2ImmutableFixedPointer<_Ty> &lease_pointer, const _TMemberObjectPointer& member_object_ptr) {
+		typedef typename std::remove_reference<decltype((*lease_pointer).*member_object_ptr)>::type _TTarget;
+		mse::impl::make_pointer_to_member_v2_checks_msepointerbasics(lease_pointer, member_object_ptr);
+		return us::TStrongFixedConstPointer<_TTarget, TAsyncSharedV2ImmutableFixedPointer<_Ty> >::make((*lease_pointer).*member_object_ptr, lease_pointer);
+	}
+#endif // defined(MSEPOINTERBASICS_H)
+
+	/* equal_ra_sections can be passed to a section splitter's constructor (instead of a list of section sizes) to split
+	the container into the given number of (roughly) equal sized sections. The section boundaries are adjusted to
+	coincide with cache line boundaries, so that threads writing to adjacent sections don't contend for the same cache
+	lines (i.e. "false sharing"). When the element size doesn't divide the cache line size, only every
+	(lcm(element size, cache line size) / element size)th element starts on a cache line boundary, so section sizes
+	are (generally) multiples of that number of elements. (If no element starts on a cache line boundary, the section
+	boundaries are not adjusted.) Note that this can result in some sections being empty if the container is small. */
+	class equal_ra_sections {
+	public:
+		explicit equal_ra_sections(size_t section_count) : m_section_count((1 <= section_count) ? section_count : 1) {}
+		size_t section_count() const { return m_section_count; }
+	private:
+		size_t m_section_count = 1;
+	};
+
+	namespace impl {
+		namespace ns_ra_section_split {
+			inline size_t greatest_common_divisor(size_t a, size_t b) {
+				while (0 != b) {
+					const size_t remainder = a % b;
+					a = b;
+					b = remainder;
+				}
+				return a;
+			}
+			inline std::vector<size_t> equal_section_sizes(size_t size, size_t section_count, size_t element_size, std::uintptr_t first_element_address) {
+				/* Section boundaries are placed at elements that start on a cache line boundary (assuming contiguous storage),
+				so that no element straddles the boundary between two sections. Such elements occur every
+				lcm(element_size, sc_cache_line_size) / element_size elements, starting with the first one. */
+				const size_t period = sc_cache_line_size / greatest_common_divisor(element_size, sc_cache_line_size);
+				size_t first_aligned_index = size;
+				for (size_t i = 0; (period > i) && (size > i); i += 1) {
+					if (0 == (first_element_address + i * element_size) % sc_cache_line_size) {
+						first_aligned_index = i;
+						break;
+					}
+				}
+				std::vector<size_t> retval;
+				retval.reserve(section_count);
+				size_t prev_boundary = 0;
+				for (size_t i = 1; section_count > i; i += 1) {
+					size_t boundary = (size / section_count) * i + (size % section_count) * i / section_count;
+					if (size > first_aligned_index) {
+						/* The boundary is moved to the nearest line aligned element (or the start of the container). */
+						if (first_aligned_index > boundary) {
+							boundary = (first_aligned_index - boundary > boundary) ? 0 : first_aligned_index;
+						}
+						else {
+							boundary = first_aligned_index + (boundary - first_aligned_index + period / 2) / period * period;
+						}
+					}
+					boundary = (std::min)((std::max)(boundary, prev_boundary), size);
+					retval.push_back(boundary - prev_boundary);
+					prev_boundary = boundary;
+				}
+				retval.push_back(size - prev_boundary);
+				return retval;
+			}
+			template<typename _TContainer>
+			std::vector<size_t> equal_section_sizes(const _TContainer& container, const equal_ra_sections& sections) {
+				typedef typename std::remove_reference<decltype(container[0])>::type element_t;
+				const size_t size = mse::msev_as_a_size_t(container.size());
+				const std::uintptr_t first_element_address = (1 <= size) ? reinterpret_cast<std::uintptr_t>(std::addressof(container[0])) : 0;
+				return equal_section_sizes(size, sections.section_count(), sizeof(element_t), first_element_address);
+			}
+		}
+	}
+
+	template <typename _TExclusiveWritelockPtr> class TXScopeAsyncRASectionSplitterXWP;
+	template <typename _TExclusiveWritelockPtr> class TAsyncRASectionSplitterXWP;
+	template <typename _TRAIterator> class TXScopeAsyncSplitterRASectionReadWriteAccessRequester;
+	template <typename _TRAIterator> class TAsyncSplitterRASectionReadWriteAccessRequester;
+
+	template <typename _TRAIterator>
+	class TXScopeAsyncSplitterRandomAccessSection : public TXScopeRandomAccessSection<_TRAIterator>
+		, public MSE_FIRST_OR_PLACEHOLDER_IF_A_BASE_OF_SECOND(mse::us::impl::AsyncNotPassableTagBase, TXScopeRandomAccessSection<_TRAIterator>, TXScopeAsyncSplitterRandomAccessSection<_TRAIterator>)
+	{
+	public:
+		typedef TXScopeRandomAccessSection<_TRAIterator> base_class;
+		MSE_INHERITED_RANDOM_ACCESS_MEMBER_TYPE_DECLARATIONS(base_class);
+
+		TXScopeAsyncSplitterRandomAccessSection(TXScopeAsyncSplitterRandomAccessSection&& src) = default;
+
+		/* We will mark this type as safely "async shareable" if the elements it contains are also "async shareable"
+		and _TRAIterator is marked as "strong". This is technically unsafe as those criteria may not be sufficient
+		to ensure safe "async shareability". */
+		template<class value_type2 = value_type, class = typename std::enable_if<(std::is_same<value_type2, value_type>::value)
+			&& (mse::impl::is_marked_as_shareable_and_passable_msemsearray<value_type2>::value)
+			&& (mse::impl::is_strong_container_reference_holding_iterator<_TRAIterator>::value)
+			, void>::type>
+		void xscope_async_shareable_and_passable_tag() const {}
+
+	private:
+		TXScopeAsyncSplitterRandomAccessSection(const TXScopeAsyncSplitterRandomAccessSection& src) = default;
+		template <typename _TRAIterator1>
+		TXScopeAsyncSplitterRandomAccessSection(const TXScopeAsyncSplitterRandomAccessSection<_TRAIterator1>& src) : base_class(src) {}
+
+		TXScopeAsyncSplitterRandomAccessSection(const _TRAIterator& start_iter, size_type count) : base_class(start_iter, count) {}
+		//MSE_USING(TXScopeAsyncSplitterRandomAccessSection, base_class);
+
+		TXScopeAsyncSplitterRandomAccessSection& operator=(const TXScopeAsyncSplitterRandomAccessSection& _Right_cref) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		template <typename _TExclusiveWritelockPtr>
+		friend class TXScopeAsyncRASectionSplitterXWP;
+		template <typename _TRAIterator2>
+		friend class TXScopeAsyncSplitterRASectionReadWriteAccessRequester;
+		template<class _Ty, class _TAccessMutex/* = non_thread_safe_recursive_shared_timed_mutex*/>
+		friend class mse::us::impl::TAccessControlledObjBase;
+	};
+
+	template <typename _TRAIterator>
+	class TAsyncSplitterRandomAccessSection : public TRandomAccessSection<_TRAIterator>
+		, public MSE_FIRST_OR_PLACEHOLDER_IF_A_BASE_OF_SECOND(mse::us::impl::AsyncNotPassableTagBase, TRandomAccessSection<_TRAIterator>, TAsyncSplitterRandomAccessSection<_TRAIterator>)
+	{
+	public:
+		typedef TRandomAccessSection<_TRAIterator> base_class;
+		MSE_INHERITED_RANDOM_ACCESS_MEMBER_TYPE_DECLARATIONS(base_class);
+
+		TAsyncSplitterRandomAccessSection(TAsyncSplitterRandomAccessSection&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSplitterRandomAccessSection() {
+			mse::impl::T_valid_if_not_an_xscope_type<_TRAIterator>();
+		}
+
+		/* We will mark this type as safely "async shareable" if the elements it contains are also "async shareable"
+		and _TRAIterator is marked as "strong". This is technically unsafe as those criteria may not be sufficient
+		to ensure safe "async shareability". */
+		template<class value_type2 = value_type, class = typename std::enable_if<(std::is_same<value_type2, value_type>::value)
+			&& (mse::impl::is_marked_as_shareable_and_passable_msemsearray<value_type2>::value)
+			&& (mse::impl::is_strong_container_reference_holding_iterator<_TRAIterator>::value)
+			, void>::type>
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		TAsyncSplitterRandomAccessSection(const TAsyncSplitterRandomAccessSection& src) = default;
+		template <typename _TRAIterator1>
+		TAsyncSplitterRandomAccessSection(const TAsyncSplitterRandomAccessSection<_TRAIterator1>& src) : base_class(src) {}
+
+		TAsyncSplitterRandomAccessSection(const _TRAIterator& start_iter, size_type count) : base_class(start_iter, count) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		template <typename _TExclusiveWritelockPtr>
+		friend class TAsyncRASectionSplitterXWP;
+		template <typename _TRAIterator2>
+		friend class TAsyncSplitterRASectionReadWriteAccessRequester;
+	};
+
+	template <typename _TAccessLease>
+	class TXScopeAsyncSplitterRASectionReadWriteAccessRequester : public mse::us::impl::XScopeTagBase {
+	public:
+		typedef decltype(std::declval<_TAccessLease>()->size()) size_type;
+
+		TXScopeAsyncSplitterRASectionReadWriteAccessRequester(const TXScopeAsyncSplitterRASectionReadWriteAccessRequester& src) = default;
+		TXScopeAsyncSplitterRASectionReadWriteAccessRequester(TXScopeAsyncSplitterRASectionReadWriteAccessRequester&& src) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSplitterRASectionReadWriteAccessRequester() {
+			mse::impl::is_valid_if_exclusive_pointer<_TAccessLease>::no_op();
+		}
+
+		typedef decltype(mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(std::declval<mse::TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease> >().writelock_ptr()), std::declval<size_type>())) xscope_rw_ra_section_t;
+		xscope_rw_ra_section_t xscope_writelock_ra_section() {
+			return mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(m_splitter_ra_section_access_requester.writelock_ptr()), m_count);
+		}
+		mse::xscope_optional<xscope_rw_ra_section_t> xscope_try_writelock_ra_section() {
+			auto maybe_wl_ptr = m_splitter_ra_section_access_requester.try_writelock_ptr();
+			if (!(maybe_wl_ptr.has_value())) {
+				return{};
+			}
+			auto& wl_ptr = maybe_wl_ptr.value();
+			return mse::xscope_optional<xscope_rw_ra_section_t>(mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(wl_ptr), m_count));
+		}
+		template<class _Rep, class _Period>
+		mse::xscope_optional<xscope_rw_ra_section_t> xscope_try_writelock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			auto abs_time = std::chrono::system_clock::now() + _Rel_time;
+			return try_writelock_ra_section_until(abs_time);
+		}
+		template<class _Clock, class _Duration>
+		mse::xscope_optional<xscope_rw_ra_section_t> xscope_try_writelock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			auto maybe_wl_ptr = m_splitter_ra_section_access_requester.try_writelock_ptr_until(_Abs_time);
+			if (!(maybe_wl_ptr.has_value())) {
+				return{};
+			}
+			auto& wl_ptr = maybe_wl_ptr.value();
+			return mse::xscope_optional<xscope_rw_ra_section_t>(mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(wl_ptr), m_count));
+		}
+
+		typedef decltype(mse::make_xscope_random_access_const_section(mse::make_xscope_random_access_const_iterator(std::declval<mse::TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease> >().readlock_ptr()), std::declval<size_type>())) xscope_rwc_ra_section_t;
+		xscope_rwc_ra_section_t xscope_readlock_ra_section() {
+			return mse::make_xscope_random_access_const_section(mse::make_xscope_random_access_const_iterator(m_splitter_ra_section_access_requester.readlock_ptr()), m_count);
+		}
+		mse::xscope_optional<xscope_rwc_ra_section_t> xscope_try_readlock_ra_section() {
+			auto maybe_rl_ptr = m_splitter_ra_section_access_requester.try_readlock_ptr();
+			if (!(maybe_rl_ptr.has_value())) {
+				return{};
+			}
+			auto& rl_ptr = maybe_rl_ptr.value();
+			return mse::xscope_optional<xscope_rwc_ra_section_t>(mse::make_xscope_random_access_const_section(mse::make_xscope_random_access_const_iterator(rl_ptr), m_count));
+		}
+		template<class _Rep, class _Period>
+		mse::xscope_optional<xscope_rwc_ra_section_t> xscope_try_readlock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			auto abs_time = std::chrono::system_clock::now() + _Rel_time;
+			return try_readlock_ra_section_until(abs_time);
+		}
+		template<class _Clock, class _Duration>
+		mse::xscope_optional<xscope_rwc_ra_section_t> xscope_try_readlock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			auto maybe_rl_ptr = m_splitter_ra_section_access_requester.try_readlock_ptr_until(_Abs_time);
+			if (!(maybe_rl_ptr.has_value())) {
+				return{};
+			}
+			auto& rl_ptr = maybe_rl_ptr.value();
+			return mse::xscope_optional<xscope_rwc_ra_section_t>(mse::make_xscope_random_access_const_section(mse::make_xscope_random_access_const_iterator(rl_ptr), m_count));
+		}
+
+		/* Note that an exclusive_writelock_ra_section cannot coexist with any other lock_ra_sections (targeting the same object), including ones in
+		the same thread. TXScopehus, using exclusive_writelock_ra_sections without sufficient care introduces the potential for exceptions (in a way
+		that sticking to (regular) writelock_ra_sections doesn't). */
+		auto xscope_exclusive_writelock_ra_section() {
+			return mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(m_splitter_ra_section_access_requester.exclusive_pointer()), m_count);
+		}
+
+		/* Prefer the "xscope_" prefixed versions to acknowledge that scope sections are returned. */
+		auto writelock_ra_section() {
+			return xscope_writelock_ra_section();
+		}
+		auto try_writelock_ra_section() {
+			return xscope_try_writelock_ra_section();
+		}
+		template<class _Rep, class _Period>
+		auto try_writelock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return xscope_try_writelock_ra_section_for(_Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		auto try_writelock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			return xscope_try_writelock_ra_section_until(_Abs_time);
+		}
+		auto readlock_ra_section() {
+			return xscope_readlock_ra_section();
+		}
+		auto try_readlock_ra_section() {
+			return xscope_try_readlock_ra_section();
+		}
+		template<class _Rep, class _Period>
+		auto try_readlock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			return xscope_try_readlock_ra_section_for(_Rel_time);
+		}
+		template<class _Clock, class _Duration>
+		auto try_readlock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			return xscope_try_readlock_ra_section_until(_Abs_time);
+		}
+		auto exclusive_writelock_ra_section() {
+			return xscope_exclusive_writelock_ra_section();
+		}
+
+		void xscope_async_shareable_and_passable_tag() const {}
+
+	private:
+		TXScopeAsyncSplitterRASectionReadWriteAccessRequester(_TAccessLease&& exclusive_write_pointer)
+			: m_count(exclusive_write_pointer->size()), m_splitter_ra_section_access_requester(make_xscope_asyncsharedv2xwpreadwrite(std::forward<_TAccessLease>(exclusive_write_pointer))) {}
+
+		TXScopeAsyncSplitterRASectionReadWriteAccessRequester& operator=(const TXScopeAsyncSplitterRASectionReadWriteAccessRequester& _Right_cref) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		const size_type m_count = 0;
+		mse::TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease> m_splitter_ra_section_access_requester;
+
+		template <typename _TExclusiveWritelockPtr>
+		friend class TXScopeAsyncRASectionSplitterXWP;
+	};
+
+	template <typename _TRAIterator>
+	class TAsyncSplitterRASectionReadWriteAccessRequester {
+	public:
+		typedef mse::TAsyncSplitterRandomAccessSection<_TRAIterator> splitter_ra_section_t;
+		typedef decltype(std::declval<splitter_ra_section_t>().size()) size_type;
+
+		TAsyncSplitterRASectionReadWriteAccessRequester(const TAsyncSplitterRASectionReadWriteAccessRequester& src_cref) = default;
+
+		typedef TRandomAccessSection<TRAIterator<decltype(std::declval<mse::TAsyncSharedV2ReadWriteAccessRequester<splitter_ra_section_t> >().writelock_ptr())> > rw_ra_section_t;
+		rw_ra_section_t writelock_ra_section() {
+			return rw_ra_section_t(TRAIterator<decltype(m_splitter_ra_section_access_requester.writelock_ptr())>(m_splitter_ra_section_access_requester.writelock_ptr()), m_count);
+		}
+		mse::mstd::optional<rw_ra_section_t> try_writelock_ra_section() {
+			auto maybe_wl_ptr = m_splitter_ra_section_access_requester.try_writelock_ptr();
+			if (!(maybe_wl_ptr.has_value())) {
+				return{};
+			}
+			auto& wl_ptr = maybe_wl_ptr.value();
+			return mse::mstd::optional<rw_ra_section_t>(rw_ra_section_t(TRAIterator<decltype(wl_ptr)>(wl_ptr), wl_ptr->size()));
+		}
+		template<class _Rep, class _Period>
+		mse::mstd::optional<rw_ra_section_t> try_writelock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			auto abs_time = std::chrono::system_clock::now() + _Rel_time;
+			return try_writelock_ra_section_until(abs_time);
+		}
+		template<class _Clock, class _Duration>
+		mse::mstd::optional<rw_ra_section_t> try_writelock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			auto maybe_wl_ptr = m_splitter_ra_section_access_requester.try_writelock_ptr_until(_Abs_time);
+			if (!(maybe_wl_ptr.has_value())) {
+				return{};
+			}
+			auto& wl_ptr = maybe_wl_ptr.value();
+			return mse::mstd::optional<rw_ra_section_t>(rw_ra_section_t(TRAIterator<decltype(wl_ptr)>(wl_ptr), wl_ptr->size()));
+		}
+
+		typedef TRandomAccessSection<TRAIterator<TAsyncSharedV2ReadWriteConstPointer<splitter_ra_section_t> > > rwc_ra_section_t;
+		rwc_ra_section_t readlock_ra_section() {
+			return rwc_ra_section_t(TRAIterator<decltype(m_splitter_ra_section_access_requester.writelock_ptr())>(m_splitter_ra_section_access_requester.readlock_ptr()), m_count);
+		}
+		mse::mstd::optional<rwc_ra_section_t> try_readlock_ra_section() {
+			auto maybe_rl_ptr = m_splitter_ra_section_access_requester.try_readlock_ptr();
+			if (!(maybe_rl_ptr.has_value())) {
+				return{};
+			}
+			auto& rl_ptr = maybe_rl_ptr.value();
+			return mse::mstd::optional<rwc_ra_section_t>(rwc_ra_section_t(TRAIterator<decltype(rl_ptr)>(rl_ptr), rl_ptr->size()));
+		}
+		template<class _Rep, class _Period>
+		mse::mstd::optional<rwc_ra_section_t> try_readlock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+			auto abs_time = std::chrono::system_clock::now() + _Rel_time;
+			return try_readlock_ra_section_until(abs_time);
+		}
+		template<class _Clock, class _Duration>
+		mse::mstd::optional<rwc_ra_section_t> try_readlock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+			auto maybe_rl_ptr = m_splitter_ra_section_access_requester.try_readlock_ptr_until(_Abs_time);
+			if (!(maybe_rl_ptr.has_value())) {
+				return{};
+			}
+			auto& rl_ptr = maybe_rl_ptr.value();
+			return mse::mstd::optional<rwc_ra_section_t>(rwc_ra_section_t(TRAIterator<decltype(rl_ptr)>(rl_ptr), rl_ptr->size()));
+		}
+
+		/* Note that an exclusive_writelock_ra_section cannot coexist with any other lock_ra_sections (targeting the same object), including ones in
+		the same thread. Thus, using exclusive_writelock_ra_sections without sufficient care introduces the potential for exceptions (in a way
+		that sticking to (regular) writelock_ra_sections doesn't). */
+		typedef TRandomAccessSection<TRAIterator<TAsyncSharedV2ExclusiveReadWritePointer<splitter_ra_section_t> > > xrw_ra_section_t;
+		xrw_ra_section_t exclusive_writelock_ra_section() {
+			return xrw_ra_section_t(TRAIterator<decltype(m_splitter_ra_section_access_requester.writelock_ptr())>(m_splitter_ra_section_access_requester.exclusive_pointer()), m_count);
+		}
+
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+
+		TAsyncSplitterRASectionReadWriteAccessRequester(const _TRAIterator& start_iter, size_type count) : m_count(count)
+			, m_splitter_ra_section_access_requester(make_asyncsharedv2readwrite<splitter_ra_section_t>(splitter_ra_section_t(start_iter, count))) {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		const size_type m_count = 0;
+		mse::TAsyncSharedV2ReadWriteAccessRequester<splitter_ra_section_t> m_splitter_ra_section_access_requester;
+
+		template <typename _TExclusiveWritelockPtr>
+		friend class TAsyncRASectionSplitterXWP;
+	};
+
+	template <typename _TExclusiveWritelockPtr>
+	class TXScopeAsyncRASectionSplitterXWP : public mse::us::impl::XScopeTagBase {
+	public:
+		typedef _TExclusiveWritelockPtr exclusive_writelock_ptr_t;
+		typedef typename std::remove_reference<decltype(*(std::declval<exclusive_writelock_ptr_t>()))>::type _TContainer;
+		typedef typename std::remove_reference<decltype(std::declval<_TContainer>()[0])>::type element_t;
+		typedef mse::TRAIterator<mse::us::impl::TPointerForLegacy<_TContainer> > ra_iterator_t;
+		typedef decltype(mse::us::impl::make_strong_iterator(std::declval<ra_iterator_t>(), std::declval<std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > >())) strong_ra_iterator_t;
+		typedef mse::TXScopeAsyncSplitterRandomAccessSection<strong_ra_iterator_t> xscope_splitter_ra_section_t;
+		typedef decltype(std::declval<xscope_splitter_ra_section_t>().size()) size_type;
+		typedef mse::TXScopeAccessControlledObj<xscope_splitter_ra_section_t> xscope_aco_splitter_ra_section_t;
+		typedef decltype(std::declval<xscope_aco_splitter_ra_section_t>().exclusive_pointer()) aco_exclusive_pointer_t;
+		typedef mse::TXScopeAsyncSplitterRASectionReadWriteAccessRequester<aco_exclusive_pointer_t> xscope_ras_ar_t;
+
+		template<typename _TList>
+		TXScopeAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, const _TList& section_sizes)
+			: m_access_lease_obj_shptr(std::make_shared<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> >(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr))) {
+			/* The access requesters hold pointers to the (access controlled) sections, so the storage for the sections must
+			be reserved in advance, so that they are never relocated. */
+			size_t section_count = 0;
+			for (const auto& section_size : section_sizes) {
+				(void)section_size;
+				section_count += 1;
+			}
+			m_splitter_aco_ra_sections.reserve(section_count + 1);
+			m_ra_section_ars.reserve(section_count + 1);
+
+			size_t cummulative_size = 0;
+			//auto section_begin_it = m_access_lease_obj_shptr->cref()->begin();
+			auto section_begin_it = ra_iterator_t(std::addressof(*(m_access_lease_obj_shptr->cref())));
+
+			for (const auto& section_size : section_sizes) {
+				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TXScopeAsyncRASectionSplitterXWP() - TXScopeAsyncRASectionSplitterXWP")); }
+				auto section_size_szt = mse::msev_as_a_size_t(section_size);
+
+				strong_ra_iterator_t it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
+				add_section(it1, section_size_szt);
+
+				cummulative_size += section_size_szt;
+				section_begin_it += section_size_szt;
+			}
+			if (m_access_lease_obj_shptr->cref()->size() > cummulative_size) {
+				auto section_size = m_access_lease_obj_shptr->cref()->size() - cummulative_size;
+				auto section_size_szt = mse::msev_as_a_size_t(section_size);
+				auto it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
+				add_section(it1, section_size_szt);
+			}
+		}
+		TXScopeAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, size_t split_index)
+			: TXScopeAsyncRASectionSplitterXWP(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr), std::array<size_t, 1>{ {split_index}}) {}
+		TXScopeAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, const equal_ra_sections& sections)
+			: TXScopeAsyncRASectionSplitterXWP(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr), mse::impl::ns_ra_section_split::equal_section_sizes(*exclusive_writelock_ptr, sections)) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncRASectionSplitterXWP() {
+			mse::impl::is_valid_if_exclusive_pointer<exclusive_writelock_ptr_t>::no_op();
+		}
+
+		xscope_ras_ar_t xscope_ra_section_access_requester(size_t index) const {
+			return m_ra_section_ars.at(index);
+		}
+		xscope_ras_ar_t xscope_first_ra_section_access_requester() const {
+			return m_ra_section_ars.at(0);
+		}
+		xscope_ras_ar_t xscope_second_ra_section_access_requester() const {
+			return m_ra_section_ars.at(1);
+		}
+		xscope_ras_ar_t ra_section_access_requester(size_t index) const {
+			return m_ra_section_ars.at(index);
+		}
+		xscope_ras_ar_t first_ra_section_access_requester() const {
+			return m_ra_section_ars.at(0);
+		}
+		xscope_ras_ar_t second_ra_section_access_requester() const {
+			return m_ra_section_ars.at(1);
+		}
+		/* The number of sections (including any section added for the elements beyond the specified section sizes). */
+		size_t ra_section_count() const {
+			return m_ra_section_ars.size();
+		}
+	private:
+		TXScopeAsyncRASectionSplitterXWP(const TXScopeAsyncRASectionSplitterXWP& src) = delete;
+		TXScopeAsyncRASectionSplitterXWP(TXScopeAsyncRASectionSplitterXWP&& src) = delete;
+		TXScopeAsyncRASectionSplitterXWP & operator=(const TXScopeAsyncRASectionSplitterXWP& _Right_cref) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		void add_section(const strong_ra_iterator_t& section_begin_it, size_t section_size) {
+			m_splitter_aco_ra_sections.push_back(xscope_aco_splitter_ra_section_t(section_begin_it, section_size));
+			m_ra_section_ars.push_back(mse::TXScopeAsyncSplitterRASectionReadWriteAccessRequester<aco_exclusive_pointer_t>(m_splitter_aco_ra_sections.back().exclusive_pointer()));
+		}
+
+		std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > m_access_lease_obj_shptr;
+		std::vector<xscope_aco_splitter_ra_section_t> m_splitter_aco_ra_sections;
+		std::vector<xscope_ras_ar_t> m_ra_section_ars;
+	};
+
+#ifdef MSE_HAS_CXX17
+	/* deduction guide */
+	template <typename _TExclusiveWritelockPtr>
+	TXScopeAsyncRASectionSplitterXWP(_TExclusiveWritelockPtr)->TXScopeAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>;
+#endif /* MSE_HAS_CXX17 */
+
+	template <typename _TExclusiveWritelockPtr>
+	class TAsyncRASectionSplitterXWP {
+	public:
+		typedef _TExclusiveWritelockPtr exclusive_writelock_ptr_t;
+		typedef typename std::remove_reference<decltype(*(std::declval<exclusive_writelock_ptr_t>()))>::type _TContainer;
+		typedef typename std::remove_reference<decltype(std::declval<_TContainer>()[0])>::type element_t;
+		typedef mse::TRAIterator<mse::us::impl::TPointerForLegacy<_TContainer> > ra_iterator_t;
+		typedef decltype(mse::us::impl::make_strong_iterator(std::declval<ra_iterator_t>(), std::declval<std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > >())) strong_ra_iterator_t;
+		typedef TAsyncSplitterRASectionReadWriteAccessRequester<strong_ra_iterator_t> ras_ar_t;
+
+		template<typename _TList>
+		TAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, const _TList& section_sizes)
+			: m_access_lease_obj_shptr(std::make_shared<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> >(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr))) {
+			size_t cummulative_size = 0;
+			//auto section_begin_it = m_access_lease_obj_shptr->cref()->begin();
+			auto section_begin_it = ra_iterator_t(std::addressof(*(m_access_lease_obj_shptr->cref())));
+			for (const auto& section_size : section_sizes) {
+				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TAsyncRASectionSplitterXWP() - TAsyncRASectionSplitterXWP")); }
+				auto section_size_szt = mse::msev_as_a_size_t(section_size);
+
+				strong_ra_iterator_t it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
+				ras_ar_t ras_ar1 = mse::TAsyncSplitterRASectionReadWriteAccessRequester<strong_ra_iterator_t>(it1, section_size_szt);
+				m_ra_sections.push_back(ras_ar1);
+
+				cummulative_size += section_size_szt;
+				section_begin_it += section_size_szt;
+			}
+			if (m_access_lease_obj_shptr->cref()->size() > cummulative_size) {
+				auto section_size = m_access_lease_obj_shptr->cref()->size() - cummulative_size;
+				auto it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
+				auto ras_ar1 = mse::TAsyncSplitterRASectionReadWriteAccessRequester<strong_ra_iterator_t>(it1, section_size);
+				m_ra_sections.push_back(ras_ar1);
+			}
+		}
+		TAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, size_t split_index)
+			: TAsyncRASectionSplitterXWP(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr), std::array<size_t, 1>{ {split_index}}) {}
+		TAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, const equal_ra_sections& sections)
+			: TAsyncRASectionSplitterXWP(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr), mse::impl::ns_ra_section_split::equal_section_sizes(*exclusive_writelock_ptr, sections)) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncRASectionSplitterXWP() {
+			mse::impl::T_valid_if_not_an_xscope_type<exclusive_writelock_ptr_t>();
+			mse::impl::is_valid_if_exclusive_pointer<exclusive_writelock_ptr_t>::no_op();
+		}
+
+		ras_ar_t ra_section_access_requester(size_t index) const {
+			return m_ra_sections.at(index);
+		}
+		ras_ar_t first_ra_section_access_requester() const {
+			return m_ra_sections.at(0);
+		}
+		ras_ar_t second_ra_section_access_requester() const {
+			return m_ra_sections.at(1);
+		}
+		/* The number of sections (including any section added for the elements beyond the specified section sizes). */
+		size_t ra_section_count() const {
+			return m_ra_sections.size();
+		}
+	private:
+		TAsyncRASectionSplitterXWP(const TAsyncRASectionSplitterXWP& src) = delete;
+		TAsyncRASectionSplitterXWP(TAsyncRASectionSplitterXWP&& src) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > m_access_lease_obj_shptr;
+		std::vector<ras_ar_t> m_ra_sections;
+	};
+
+#ifdef MSE_HAS_CXX17
+	/* deduction guide */
+	template <typename _TExclusiveWritelockPtr>
+	TAsyncRASectionSplitterXWP(_TExclusiveWritelockPtr)->TAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>;
+#endif /* MSE_HAS_CXX17 */
+
+	template <typename _TAccessRequester>
+	class TXScopeAsyncRASectionSplitter : public TXScopeAsyncRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer())> {
+	public:
+		typedef TXScopeAsyncRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer())> base_class;
+
+		template<typename _TList>
+		TXScopeAsyncRASectionSplitter(_TAccessRequester& ar, const _TList& section_sizes) : base_class(ar.exclusive_pointer(), section_sizes) {}
+
+		TXScopeAsyncRASectionSplitter(_TAccessRequester& ar, size_t split_index) : base_class(ar.exclusive_pointer(), split_index) {}
+		TXScopeAsyncRASectionSplitter(_TAccessRequester& ar, const equal_ra_sections& sections) : base_class(ar.exclusive_pointer(), sections) {}
+
+	private:
+		TXScopeAsyncRASectionSplitter & operator=(const TXScopeAsyncRASectionSplitter& _Right_cref) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+	};
+
+#ifdef MSE_HAS_CXX17
+	/* deduction guide */
+	template<typename _TAccessRequester, typename _TList>
+	TXScopeAsyncRASectionSplitter(_TAccessRequester, _TList)->TXScopeAsyncRASectionSplitter<_TAccessRequester>;
+	template<typename _TAccessRequester>
+	TXScopeAsyncRASectionSplitter(_TAccessRequester, size_t)->TXScopeAsyncRASectionSplitter<_TAccessRequester>;
+#endif /* MSE_HAS_CXX17 */
+
+	template <typename _TAccessRequester>
+	class TAsyncRASectionSplitter : public TAsyncRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer())> {
+	public:
+		typedef TAsyncRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer())> base_class;
+
+		template<typename _TList>
+		TAsyncRASectionSplitter(_TAccessRequester& ar, const _TList& section_sizes) : base_class(ar.exclusive_pointer(), section_sizes) {}
+
+		TAsyncRASectionSplitter(_TAccessRequester& ar, size_t split_index) : base_class(ar.exclusive_pointer(), split_index) {}
+		TAsyncRASectionSplitter(_TAccessRequester& ar, const equal_ra_sections& sections) : base_class(ar.exclusive_pointer(), sections) {}
+
+	private:
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+	};
+
+#ifdef MSE_HAS_CXX17
+	/* deduction guide */
+	template<typename _TAccessRequester, typename _TList>
+	TAsyncRASectionSplitter(_TAccessRequester, _TList)->TAsyncRASectionSplitter<_TAccessRequester>;
+	template<typename _TAccessRequester>
+	TAsyncRASectionSplitter(_TAccessRequester, size_t)->TAsyncRASectionSplitter<_TAccessRequester>;
+#endif /* MSE_HAS_CXX17 */
+
+	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex>
+	class TXScopeAsyncACORASectionSplitter : public TXScopeAsyncRASectionSplitterXWP<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> {
+	public:
+		typedef TXScopeAsyncRASectionSplitterXWP<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> base_class;
+		typedef mse::TXScopeFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> > xsac_obj_xscpptr_t;
+		typedef mse::TXScopeFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> > ac_obj_xscpptr_t;
+
+		TXScopeAsyncACORASectionSplitter(const xsac_obj_xscpptr_t& xsptr, size_t split_index) : base_class(xsptr->exclusive_pointer(), split_index) {}
+		template<typename _TList>
+		TXScopeAsyncACORASectionSplitter(const xsac_obj_xscpptr_t& xsptr, const _TList& section_sizes) : base_class(xsptr->exclusive_pointer(), section_sizes) {}
+
+		TXScopeAsyncACORASectionSplitter(const ac_obj_xscpptr_t& xsptr, size_t split_index) : base_class(xsptr->exclusive_pointer(), split_index) {}
+		template<typename _TList>
+		TXScopeAsyncACORASectionSplitter(const ac_obj_xscpptr_t& xsptr, const _TList& section_sizes) : base_class(xsptr->exclusive_pointer(), section_sizes) {}
+		TXScopeAsyncACORASectionSplitter(const xsac_obj_xscpptr_t& xsptr, const equal_ra_sections& sections) : base_class(xsptr->exclusive_pointer(), sections) {}
+		TXScopeAsyncACORASectionSplitter(const ac_obj_xscpptr_t& xsptr, const equal_ra_sections& sections) : base_class(xsptr->exclusive_pointer(), sections) {}
+
+	private:
+		TXScopeAsyncACORASectionSplitter & operator=(const TXScopeAsyncACORASectionSplitter& _Right_cref) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+	};
+
+#ifdef MSE_HAS_CXX17
+	/* deduction guide */
+	template <typename _Ty, class _TAccessMutex>
+	TXScopeAsyncACORASectionSplitter(mse::TXScopeFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >, size_t)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
+	template<typename _Ty, class _TAccessMutex, typename _TList>
+	TXScopeAsyncACORASectionSplitter(mse::TXScopeFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >, _TList)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
+	template <typename _Ty, class _TAccessMutex>
+	TXScopeAsyncACORASectionSplitter(mse::TXScopeFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> >, size_t)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
+	template<typename _Ty, class _TAccessMutex, typename _TList>
+	TXScopeAsyncACORASectionSplitter(mse::TXScopeFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> >, _TList)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
+#if !defined(MSE_SCOPEPOINTER_DISABLED)
+	template <typename _Ty, class _TAccessMutex>
+	TXScopeAsyncACORASectionSplitter(mse::TXScopeObjFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >, size_t)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
+	template<typename _Ty, class _TAccessMutex, typename _TList>
+	TXScopeAsyncACORASectionSplitter(mse::TXScopeObjFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >, _TList)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
+	template <typename _Ty, class _TAccessMutex>
+	TXScopeAsyncACORASectionSplitter(mse::TXScopeObjFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> >, size_t)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
+	template<typename _Ty, class _TAccessMutex, typename _TList>
+	TXScopeAsyncACORASectionSplitter(mse::TXScopeObjFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> >, _TList)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+#endif /* MSE_HAS_CXX17 */
+
+
+	namespace mstd {
+		/* thread is currently publicly derived from std::thread for reasons of implementation convenience. Expect that
+		in the future it will not be. */
+		class thread : public std::thread {
+		public:
+			typedef std::thread base_class;
+
+			thread() _NOEXCEPT {}
+
+			template<class _Fn, class... _Args, class = typename std::enable_if<!std::is_same<typename std::decay<_Fn>::type, thread>::value>::type>
+			explicit thread(_Fn&& _Fx, _Args&&... _Ax) : base_class(std::forward<_Fn>(_Fx), std::forward<_Args>(_Ax)...) {
+				s_valid_if_passable(_Ax...); // ensure that the function arguments are of a safely passable type
+				s_valid_if_passable(_Fx);
+			}
+
+			thread(thread&& _Other) _NOEXCEPT : base_class(mse::us::impl::as_ref<base_class>(std::forward<decltype(_Other)>(_Other))) {}
+
+			thread& operator=(thread&& _Other) _NOEXCEPT {
+				base_class::operator=(std::forward<decltype(_Other)>(_Other));
+				return *this;
+			}
 
+			thread(const thread&) = delete;
+			thread& operator=(const thread&) = delete;
 
-#if defined(MSEPOINTERBASICS_H)
-	template<class _TTargetType, class _Ty>
-	us::TStrongFixedPointer<_TTargetType, typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::writelock_ptr_t> make_pointer_to_member(_TTargetType& target, const typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::writelock_ptr_t &lease_pointer) {
-		return us::TStrongFixedPointer<_TTargetType, typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::writelock_ptr_t>::make(target, lease_pointer);
-	}
-	template<class _TTargetType, class _Ty>
-	us::TStrongFixedConstPointer<_TTargetType, typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::readlock_ptr_t> make_const_pointer_to_member(const _TTargetType& target, const typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::readlock_ptr_t &lease_pointer) {
-		return us::TStrongFixedConstPointer<_TTargetType, typename TAsyncSharedV2ReadWriteAccessRequester<_Ty>::readlock_ptr_t>::make(target, lease_pointer);
-	}
-	template<class _TTargetType, class _Ty>
-	us::TStrongFixedConstPointer<_TTargetType, typename TAsyncSharedV2ReadOnlyAccessRequester<_Ty>::readlock_ptr_t> make_const_pointer_to_member(const _TTargetType& target, const typename TAsyncSharedV2ReadOnlyAccessRequester<_Ty>::readlock_ptr_t &lease_pointer) {
-		return us::TStrongFixedConstPointer<_TTargetType, typename TAsyncSharedV2ReadOnlyAccessRequester<_Ty>::readlock_ptr_t>::make(target, lease_pointer);
-	}
-	template<class _TTargetType, class _Ty>
-	us::TStrongFixedConstPointer<_TTargetType, TAsyncSharedV2ImmutableFixedPointer<_Ty>> make_const_pointer_to_member(const _TTargetType& target, const TAsyncSharedV2ImmutableFixedPointer<_Ty> &lease_pointer) {
-		return us::TStrongFixedConstPointer<_TTargetType, TAsyncSharedV2ImmutableFixedPointer<_Ty>>::make(target, lease_pointer);
-	}
+			template<class _Ty, class... _Args>
+			static void s_valid_if_passable(const _Ty& arg1, _Args&&... _Ax) {
+				mse::impl::async_passable(arg1);
+				s_valid_if_passable(_Ax...);
+			}
+			static void s_valid_if_passable() {}
+		};
 
-	template<class _Ty, class _TMemberObjectPointer>
-	static auto make_pointer_to_member_v2(const TAsyncSharedV2ReadWritePointer<_Ty> &lease_pointer, const _TMemberObjectPointer& member_object_ptr) {
-		typedef typename std::remove_reference<decltype((*lease_pointer).*member_object_ptr)>::type _TTarget;
-		mse::impl::make_pointer_to_member_v2_checks_msepointerbasics(lease_pointer, member_object_ptr);
-		return us::TStrongFixedPointer<_TTarget, TAsyncSharedV2ReadWritePointer<_Ty> >::make((*lease_pointer).*member_object_ptr, lease_pointer);
-	}
-	template<class _Ty, class _TMemberObjectPointer>
-	static auto make_const_pointer_to_member_v2(const TAsyncSharedV2ReadWriteConstPointer<_Ty> &lease_pointer, const _TMemberObjectPointer& member_object_ptr) {
-		typedef typename std::remove_reference<decltype((*lease_pointer).*member_object_ptr)>::type _TTarget;
-		mse::impl::make_pointer_to_member_v2_checks_msepointerbasics(lease_pointer, member_object_ptr);
-		return us::TStrongFixedConstPointer<_TTarget, TAsyncSharedV2ReadWriteConstPointer<_Ty> >::make((*lease_pointer).*member_object_ptr, lease_pointer);
-	}
-	template<class _Ty, class _TMemberObjectPointer>
-	static auto make_const_pointer_to_member_v2(const TAsyncSharedV2ReadOnlyConstPointer<_Ty> &lease_pointer, const _TMemberObjectPointer& member_object_ptr) {
-		typedef typename std::remove_reference<decltype((*lease_pointer).*member_object_ptr)>::type _TTarget;
-		mse::impl::make_pointer_to_member_v2_checks_msepointerbasics(lease_pointer, member_object_ptr);
-		return us::TStrongFixedConstPointer<_TTarget, TAsyncSharedV2ReadOnlyConstPointer<_Ty> >::make((*lease_pointer).*member_object_ptr, lease_pointer);
-	}
-	template<class _Ty, class _TMemberObjectPointer>
-	static auto make_const_pointer_to_member_v2(const TAsyncSharedV2ImmutableFixedPointer<_Ty> &lease_pointer, const _TMemberObjectPointer& member_object_ptr) {
-		typedef typename std::remove_reference<decltype((*lease_pointer).*member_object_ptr)>::type _TTarget;
-		mse::impl::make_pointer_to_member_v2_checks_msepointerbasics(lease_pointer, member_object_ptr);
-		return us::TStrongFixedConstPointer<_TTarget, TAsyncSharedV2ImmutableFixedPointer<_Ty> >::make((*lease_pointer).*member_object_ptr, lease_pointer);
-	}
-#endif // defined(MSEPOINTERBASICS_H)
+		template<class _Ty> using future = std::future<_Ty>;
 
-	template <typename _TExclusiveWritelockPtr> class TXScopeAsyncRASectionSplitterXWP;
-	template <typename _TExclusiveWritelockPtr> class TAsyncRASectionSplitterXWP;
-	template <typename _TRAIterator> class TXScopeAsyncSplitterRASectionReadWriteAccessRequester;
-	template <typename _TRAIterator> class TAsyncSplitterRASectionReadWriteAccessRequester;
+		template<class _Fty, class... _ArgTypes>
+		inline auto async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) {
+			// ensure that the function arguments are of a safely passable type
+			thread::s_valid_if_passable(_Args...);
+			// ensure that the function return value is of a safely passable type
+			mse::impl::T_valid_if_is_marked_as_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
+			thread::s_valid_if_passable(_Fnarg);
+			return (std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+		}
 
-	template <typename _TRAIterator>
-	class TXScopeAsyncSplitterRandomAccessSection : public TXScopeRandomAccessSection<_TRAIterator>
-		, public MSE_FIRST_OR_PLACEHOLDER_IF_A_BASE_OF_SECOND(mse::us::impl::AsyncNotPassableTagBase, TXScopeRandomAccessSection<_TRAIterator>, TXScopeAsyncSplitterRandomAccessSection<_TRAIterator>)
-	{
+		template<class _Fty, class... _ArgTypes>
+		inline auto async(_Fty&& _Fnarg, _ArgTypes&&... _Args) {
+			// ensure that the function arguments are of a safely passable type
+			thread::s_valid_if_passable(_Args...);
+			// ensure that the function return value is of a safely passable type
+			mse::impl::T_valid_if_is_marked_as_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
+			return (std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+		}
+	}
+
+	/* xscope_thread is currently publicly derived from std::thread for reasons of implementation convenience. Expect that
+	in the future it will not be. */
+	class xscope_thread : public std::thread, public mse::us::impl::XScopeTagBase {
 	public:
-		typedef TXScopeRandomAccessSection<_TRAIterator> base_class;
-		MSE_INHERITED_RANDOM_ACCESS_MEMBER_TYPE_DECLARATIONS(base_class);
+		typedef std::thread base_class;
 
-		TXScopeAsyncSplitterRandomAccessSection(TXScopeAsyncSplitterRandomAccessSection&& src) = default;
+		xscope_thread() _NOEXCEPT {}
 
-		/* We will mark this type as safely "async shareable" if the elements it contains are also "async shareable"
-		and _TRAIterator is marked as "strong". This is technically unsafe as those criteria may not be sufficient
-		to ensure safe "async shareability". */
-		template<class value_type2 = value_type, class = typename std::enable_if<(std::is_same<value_type2, value_type>::value)
-			&& (mse::impl::is_marked_as_shareable_and_passable_msemsearray<value_type2>::value)
-			&& (mse::impl::is_strong_container_reference_holding_iterator<_TRAIterator>::value)
-			, void>::type>
-		void xscope_async_shareable_and_passable_tag() const {}
+		template<class _Fn, class... _Args, class = typename std::enable_if<!std::is_same<typename std::decay<_Fn>::type, xscope_thread>::value>::type>
+		explicit xscope_thread(_Fn&& _Fx, _Args&&... _Ax) : base_class(std::forward<_Fn>(_Fx), std::forward<_Args>(_Ax)...) {
+			s_valid_if_xscope_passable(_Ax...); // ensure that the function arguments are of a safely passable type
+			s_valid_if_xscope_passable(_Fx);
+		}
+
+		xscope_thread& operator=(xscope_thread&& _Other) = delete;
+
+		xscope_thread(const xscope_thread&) = delete;
+		xscope_thread& operator=(const xscope_thread&) = delete;
+
+		~xscope_thread() {
+			if ((*this).joinable()) {
+				(*this).join();
+			}
+		}
+
+		template<class _Ty, class... _Args>
+		static void s_valid_if_xscope_passable(const _Ty& arg1, _Args&&... _Ax) {
+			mse::impl::xscope_async_passable(arg1);
+			s_valid_if_xscope_passable(_Ax...);
+		}
+		static void s_valid_if_xscope_passable() {}
 
 	private:
-		TXScopeAsyncSplitterRandomAccessSection(const TXScopeAsyncSplitterRandomAccessSection& src) = default;
-		template <typename _TRAIterator1>
-		TXScopeAsyncSplitterRandomAccessSection(const TXScopeAsyncSplitterRandomAccessSection<_TRAIterator1>& src) : base_class(src) {}
+		xscope_thread(xscope_thread&& _Other) _NOEXCEPT : base_class(mse::us::impl::as_ref<base_class>(std::forward<decltype(_Other)>(_Other))) {}
 
-		TXScopeAsyncSplitterRandomAccessSection(const _TRAIterator& start_iter, size_type count) : base_class(start_iter, count) {}
-		//MSE_USING(TXScopeAsyncSplitterRandomAccessSection, base_class);
+		void detach() { base_class::detach(); }
 
-		TXScopeAsyncSplitterRandomAccessSection& operator=(const TXScopeAsyncSplitterRandomAccessSection& _Right_cref) = delete;
 		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
-
-		template <typename _TExclusiveWritelockPtr>
-		friend class TXScopeAsyncRASectionSplitterXWP;
-		template <typename _TRAIterator2>
-		friend class TXScopeAsyncSplitterRASectionReadWriteAccessRequester;
-		template<class _Ty, class _TAccessMutex/* = non_thread_safe_recursive_shared_timed_mutex*/>
-		friend class mse::us::impl::TAccessControlledObjBase;
+		friend class xscope_thread_carrier;
 	};
 
-	template <typename _TRAIterator>
-	class TAsyncSplitterRandomAccessSection : public TRandomAccessSection<_TRAIterator>
-		, public MSE_FIRST_OR_PLACEHOLDER_IF_A_BASE_OF_SECOND(mse::us::impl::AsyncNotPassableTagBase, TRandomAccessSection<_TRAIterator>, TAsyncSplitterRandomAccessSection<_TRAIterator>)
-	{
+	class xscope_thread_carrier : public mse::us::impl::XScopeTagBase {
 	public:
-		typedef TRandomAccessSection<_TRAIterator> base_class;
-		MSE_INHERITED_RANDOM_ACCESS_MEMBER_TYPE_DECLARATIONS(base_class);
+		typedef size_t handle_t;
 
-		TAsyncSplitterRandomAccessSection(TAsyncSplitterRandomAccessSection&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSplitterRandomAccessSection() {
-			mse::impl::T_valid_if_not_an_xscope_type<_TRAIterator>();
+		template<class _Fn, class... _Args, class = typename std::enable_if<!std::is_same<typename std::decay<_Fn>::type, xscope_thread>::value>::type>
+		handle_t new_thread(_Fn&& _Fx, _Args&&... _Ax) {
+			m_xscope_thread_map.emplace(m_next_available_handle, xscope_thread(std::forward<_Fn>(_Fx), std::forward<_Args>(_Ax)...));
+			auto retval = m_next_available_handle;
+			m_next_available_handle += 1;
+			return retval;
 		}
 
-		/* We will mark this type as safely "async shareable" if the elements it contains are also "async shareable"
-		and _TRAIterator is marked as "strong". This is technically unsafe as those criteria may not be sufficient
-		to ensure safe "async shareability". */
-		template<class value_type2 = value_type, class = typename std::enable_if<(std::is_same<value_type2, value_type>::value)
-			&& (mse::impl::is_marked_as_shareable_and_passable_msemsearray<value_type2>::value)
-			&& (mse::impl::is_strong_container_reference_holding_iterator<_TRAIterator>::value)
-			, void>::type>
-		void async_shareable_and_passable_tag() const {}
+		auto xscope_ptr(const handle_t& handle) -> mse::xscope_optional<mse::TXScopeFixedPointer<xscope_thread> > {
+			auto it = m_xscope_thread_map.find(handle);
+			if (m_xscope_thread_map.end() == it) {
+				return {};
+			}
+			else {
+				return mse::TXScopeFixedPointer<xscope_thread>(mse::us::unsafe_make_xscope_pointer_to((*it).second));
+			}
+		}
+		auto xscope_ptr(const handle_t& handle) const -> mse::xscope_optional<mse::TXScopeFixedConstPointer<xscope_thread> > {
+			auto cit = m_xscope_thread_map.find(handle);
+			if (m_xscope_thread_map.cend() == cit) {
+				return {};
+			}
+			else {
+				return mse::TXScopeFixedConstPointer<xscope_thread>(mse::us::unsafe_make_xscope_const_pointer_to((*cit).second));
+			}
+		}
+		auto xscope_ptr_at(const handle_t& handle) {
+			return mse::us::unsafe_make_xscope_pointer_to(m_xscope_thread_map.at(handle));
+		}
+		auto xscope_ptr_at(const handle_t& handle) const {
+			return mse::us::unsafe_make_xscope_const_pointer_to(m_xscope_thread_map.at(handle));
+		}
 
 	private:
-		TAsyncSplitterRandomAccessSection(const TAsyncSplitterRandomAccessSection& src) = default;
-		template <typename _TRAIterator1>
-		TAsyncSplitterRandomAccessSection(const TAsyncSplitterRandomAccessSection<_TRAIterator1>& src) : base_class(src) {}
-
-		TAsyncSplitterRandomAccessSection(const _TRAIterator& start_iter, size_type count) : base_class(start_iter, count) {}
+		class movable_xscope_thread : public xscope_thread {
+		public:
+			movable_xscope_thread(xscope_thread&& _Other) _NOEXCEPT : xscope_thread(std::forward<decltype(_Other)>(_Other)) {}
+			movable_xscope_thread(movable_xscope_thread&& _Other) _NOEXCEPT = default;
+		};
 
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
 
-		template <typename _TExclusiveWritelockPtr>
-		friend class TAsyncRASectionSplitterXWP;
-		template <typename _TRAIterator2>
-		friend class TAsyncSplitterRASectionReadWriteAccessRequester;
+		handle_t m_next_available_handle = 0;
+		std::map<handle_t, movable_xscope_thread> m_xscope_thread_map;
 	};
 
-	template <typename _TAccessLease>
-	class TXScopeAsyncSplitterRASectionReadWriteAccessRequester : public mse::us::impl::XScopeTagBase {
+	namespace impl {
+		namespace ns_xscope_future {
+			/* Records whether (the shared state of) a future is ready, and holds the continuations to be run once it is.
+			Continuations registered before the future is ready are run by the thread that completes it. Continuations
+			registered after are run immediately, in the registering thread. */
+			class completion_state {
+			public:
+				void add_continuation(std::packaged_task<void()>&& continuation) {
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						if (!m_is_complete) {
+							m_continuations.push_back(std::move(continuation));
+							return;
+						}
+					}
+					continuation();
+				}
+				void set_complete() {
+					std::vector<std::packaged_task<void()> > continuations;
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_is_complete = true;
+						continuations.swap(m_continuations);
+					}
+					for (auto& continuation : continuations) {
+						continuation();
+					}
+				}
+			private:
+				std::mutex m_mutex;
+				bool m_is_complete = false;
+				std::vector<std::packaged_task<void()> > m_continuations;
+			};
+			typedef std::shared_ptr<completion_state> completion_state_shptr_t;
+
+			/* Returns a future, and its completion state, that becomes ready once all of the given completion states are
+			complete. */
+			inline std::pair<std::future<void>, completion_state_shptr_t> make_when_all_future(const std::vector<completion_state_shptr_t>& completion_state_shptrs) {
+				struct shared_t {
+					std::atomic<size_t> m_remaining_count{ 0 };
+					std::promise<void> m_promise;
+					completion_state_shptr_t m_completion_state_shptr = std::make_shared<completion_state>();
+				};
+				auto shared_shptr = std::make_shared<shared_t>();
+				/* The extra count is released after all the continuations have been registered (or immediately if there are
+				none). */
+				shared_shptr->m_remaining_count = completion_state_shptrs.size() + 1;
+				auto retval = std::make_pair(shared_shptr->m_promise.get_future(), shared_shptr->m_completion_state_shptr);
+				auto on_complete = [shared_shptr]() {
+					if (1 == shared_shptr->m_remaining_count.fetch_sub(1)) {
+						shared_shptr->m_promise.set_value();
+						shared_shptr->m_completion_state_shptr->set_complete();
+					}
+				};
+				for (const auto& completion_state_shptr : completion_state_shptrs) {
+					completion_state_shptr->add_continuation(std::packaged_task<void()>(on_complete));
+				}
+				on_complete();
+				return retval;
+			}
+
+			/* Returns a future, and its completion state, that becomes ready, with the key corresponding to the first of the
+			given completion states to complete, once any of them is complete. */
+			template<typename _TKey>
+			std::pair<std::future<_TKey>, completion_state_shptr_t> make_when_any_future(const std::vector<completion_state_shptr_t>& completion_state_shptrs, const std::vector<_TKey>& keys) {
+				struct shared_t {
+					std::atomic<bool> m_is_set{ false };
+					std::promise<_TKey> m_promise;
+					completion_state_shptr_t m_completion_state_shptr = std::make_shared<completion_state>();
+				};
+				auto shared_shptr = std::make_shared<shared_t>();
+				auto retval = std::make_pair(shared_shptr->m_promise.get_future(), shared_shptr->m_completion_state_shptr);
+				for (size_t i = 0; completion_state_shptrs.size() > i; i += 1) {
+					completion_state_shptrs.at(i)->add_continuation(std::packaged_task<void()>([shared_shptr, key = keys.at(i)]() {
+						if (!shared_shptr->m_is_set.exchange(true)) {
+							shared_shptr->m_promise.set_value(key);
+							shared_shptr->m_completion_state_shptr->set_complete();
+						}
+					}));
+				}
+				return retval;
+			}
+
+			/* Calls the function with the value of the (ready) future (or rethrows its exception). */
+			template<typename _TFunction, typename _Ty>
+			auto invoke_with_result_of(_TFunction& function, std::future<_Ty>& future) {
+				return function(future.get());
+			}
+			template<typename _TFunction>
+			auto invoke_with_result_of(_TFunction& function, std::future<void>& future) {
+				future.get();
+				return function();
+			}
+		}
+
+		namespace ns_thread_pool {
+			class task_base {
+			public:
+				virtual ~task_base() {}
+				virtual void run() = 0;
+			};
+			template<typename _TResult>
+			class task : public task_base {
+			public:
+				/* If a "retired" promise is given, it's satisfied when the task is destroyed, after the task has released
+				its callable and completion state. */
+				task(std::packaged_task<_TResult()>&& packaged_task, mse::impl::ns_xscope_future::completion_state_shptr_t completion_state_shptr = nullptr
+					, std::unique_ptr<std::promise<void> > retired_promise_uqptr = nullptr)
+					: m_packaged_task(std::move(packaged_task)), m_completion_state_shptr(std::move(completion_state_shptr))
+					, m_retired_promise_uqptr(std::move(retired_promise_uqptr)) {}
+				task(task&& src) = default;
+				~task() {
+					if (m_retired_promise_uqptr) {
+						m_packaged_task = std::packaged_task<_TResult()>();
+						m_completion_state_shptr = nullptr;
+						m_retired_promise_uqptr->set_value();
+					}
+				}
+				void run() override {
+					/* Any exception thrown by the function is stored in the (shared state of the) associated future. */
+					m_packaged_task();
+					if (m_completion_state_shptr) {
+						/* The result has been stored, so any continuations waiting on it can now be run. */
+						m_completion_state_shptr->set_complete();
+					}
+				}
+			private:
+				std::packaged_task<_TResult()> m_packaged_task;
+				mse::impl::ns_xscope_future::completion_state_shptr_t m_completion_state_shptr;
+				std::unique_ptr<std::promise<void> > m_retired_promise_uqptr;
+			};
+
+			/* Holds (decayed copies of) a function and its arguments, and invokes the function with the arguments (as
+			rvalues), as std::async() does. */
+			template<typename _TFunction, typename... _TArgs>
+			class bound_call {
+			public:
+				typedef decltype(std::declval<_TFunction&>()(std::declval<_TArgs>()...)) result_type;
+
+				bound_call(_TFunction&& function, std::tuple<_TArgs...>&& args) : m_function(std::move(function)), m_args(std::move(args)) {}
+				result_type operator()() {
+					return invoke_helper1(std::index_sequence_for<_TArgs...>());
+				}
+			private:
+				template<size_t... _Is>
+				result_type invoke_helper1(std::index_sequence<_Is...>) {
+					return m_function(std::move(std::get<_Is>(m_args))...);
+				}
+
+				_TFunction m_function;
+				std::tuple<_TArgs...> m_args;
+			};
+			/* Invokes the callable it holds (once), destroying the callable before returning, so that it is destroyed before
+			the result is stored in the associated future (i.e. while any thread waiting on the future is still waiting). */
+			template<typename _TCallable>
+			class destroying_call {
+			public:
+				typedef typename _TCallable::result_type result_type;
+
+				explicit destroying_call(_TCallable&& callable) : m_callable_uqptr(std::make_unique<_TCallable>(std::move(callable))) {}
+				result_type operator()() {
+					struct destroy_guard_t {
+						~destroy_guard_t() { m_callable_uqptr_ref.reset(); }
+						std::unique_ptr<_TCallable>& m_callable_uqptr_ref;
+					} destroy_guard{ m_callable_uqptr };
+					return (*m_callable_uqptr)();
+				}
+			private:
+				std::unique_ptr<_TCallable> m_callable_uqptr;
+			};
+			template<typename _Fty, typename... _ArgTypes>
+			using bound_call_t = bound_call<typename std::decay<_Fty>::type, typename std::decay<_ArgTypes>::type...>;
+			template<typename _Fty, typename... _ArgTypes>
+			bound_call_t<_Fty, _ArgTypes...> make_bound_call(_Fty&& _Fnarg, _ArgTypes&&... _Args) {
+				return bound_call_t<_Fty, _ArgTypes...>(typename std::decay<_Fty>::type(std::forward<_Fty>(_Fnarg))
+					, std::tuple<typename std::decay<_ArgTypes>::type...>(std::forward<_ArgTypes>(_Args)...));
+			}
+		}
+	}
+
+	template<class _Ty> class xscope_future;
+	template<class _Fty, class... _ArgTypes> auto xscope_async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
+	template<class _Fty, class... _ArgTypes> auto xscope_async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
+	template<class _Ty> class xscope_future_carrier;
+	class xscope_thread_pool;
+	template<class... _Tys> xscope_future<void> when_all(const xscope_future<_Tys>&... futures);
+	template<class _Ty0, class... _Tys> xscope_future<size_t> when_any(const xscope_future<_Ty0>& future0, const xscope_future<_Tys>&... futures);
+
+	template<class _Ty>
+	class xscope_future : public std::future<_Ty>, public mse::us::impl::XScopeTagBase {
 	public:
-		typedef decltype(std::declval<_TAccessLease>()->size()) size_type;
+		typedef std::future<_Ty> base_class;
 
-		TXScopeAsyncSplitterRASectionReadWriteAccessRequester(const TXScopeAsyncSplitterRASectionReadWriteAccessRequester& src) = default;
-		TXScopeAsyncSplitterRASectionReadWriteAccessRequester(TXScopeAsyncSplitterRASectionReadWriteAccessRequester&& src) = default;
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncSplitterRASectionReadWriteAccessRequester() {
-			mse::impl::is_valid_if_exclusive_pointer<_TAccessLease>::no_op();
-		}
+		xscope_future() _NOEXCEPT {}
 
-		typedef decltype(mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(std::declval<mse::TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease> >().writelock_ptr()), std::declval<size_type>())) xscope_rw_ra_section_t;
-		xscope_rw_ra_section_t xscope_writelock_ra_section() {
-			return mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(m_splitter_ra_section_access_requester.writelock_ptr()), m_count);
-		}
-		mse::xscope_optional<xscope_rw_ra_section_t> xscope_try_writelock_ra_section() {
-			auto maybe_wl_ptr = m_splitter_ra_section_access_requester.try_writelock_ptr();
-			if (!(maybe_wl_ptr.has_value())) {
-				return{};
-			}
-			auto& wl_ptr = maybe_wl_ptr.value();
-			return mse::xscope_optional<xscope_rw_ra_section_t>(mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(wl_ptr), m_count));
-		}
-		template<class _Rep, class _Period>
-		mse::xscope_optional<xscope_rw_ra_section_t> xscope_try_writelock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
-			auto abs_time = std::chrono::system_clock::now() + _Rel_time;
-			return try_writelock_ra_section_until(abs_time);
-		}
-		template<class _Clock, class _Duration>
-		mse::xscope_optional<xscope_rw_ra_section_t> xscope_try_writelock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
-			auto maybe_wl_ptr = m_splitter_ra_section_access_requester.try_writelock_ptr_until(_Abs_time);
-			if (!(maybe_wl_ptr.has_value())) {
-				return{};
-			}
-			auto& wl_ptr = maybe_wl_ptr.value();
-			return mse::xscope_optional<xscope_rw_ra_section_t>(mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(wl_ptr), m_count));
-		}
+		xscope_future& operator=(xscope_future&& _Right) _NOEXCEPT = delete;
 
-		typedef decltype(mse::make_xscope_random_access_const_section(mse::make_xscope_random_access_const_iterator(std::declval<mse::TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease> >().readlock_ptr()), std::declval<size_type>())) xscope_rwc_ra_section_t;
-		xscope_rwc_ra_section_t xscope_readlock_ra_section() {
-			return mse::make_xscope_random_access_const_section(mse::make_xscope_random_access_const_iterator(m_splitter_ra_section_access_requester.readlock_ptr()), m_count);
-		}
-		mse::xscope_optional<xscope_rwc_ra_section_t> xscope_try_readlock_ra_section() {
-			auto maybe_rl_ptr = m_splitter_ra_section_access_requester.try_readlock_ptr();
-			if (!(maybe_rl_ptr.has_value())) {
-				return{};
+		~xscope_future() _NOEXCEPT {
+			if (valid()) {
+				wait();
 			}
-			auto& rl_ptr = maybe_rl_ptr.value();
-			return mse::xscope_optional<xscope_rwc_ra_section_t>(mse::make_xscope_random_access_const_section(mse::make_xscope_random_access_const_iterator(rl_ptr), m_count));
-		}
-		template<class _Rep, class _Period>
-		mse::xscope_optional<xscope_rwc_ra_section_t> xscope_try_readlock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
-			auto abs_time = std::chrono::system_clock::now() + _Rel_time;
-			return try_readlock_ra_section_until(abs_time);
-		}
-		template<class _Clock, class _Duration>
-		mse::xscope_optional<xscope_rwc_ra_section_t> xscope_try_readlock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
-			auto maybe_rl_ptr = m_splitter_ra_section_access_requester.try_readlock_ptr_until(_Abs_time);
-			if (!(maybe_rl_ptr.has_value())) {
-				return{};
+			if (m_producer_future.valid()) {
+				/* Waits until the producer has finished with the function and its arguments (and any continuations). */
+				m_producer_future.wait();
 			}
-			auto& rl_ptr = maybe_rl_ptr.value();
-			return mse::xscope_optional<xscope_rwc_ra_section_t>(mse::make_xscope_random_access_const_section(mse::make_xscope_random_access_const_iterator(rl_ptr), m_count));
 		}
 
-		/* Note that an exclusive_writelock_ra_section cannot coexist with any other lock_ra_sections (targeting the same object), including ones in
-		the same thread. TXScopehus, using exclusive_writelock_ra_sections without sufficient care introduces the potential for exceptions (in a way
-		that sticking to (regular) writelock_ra_sections doesn't). */
-		auto xscope_exclusive_writelock_ra_section() {
-			return mse::make_xscope_random_access_section(mse::make_xscope_random_access_iterator(m_splitter_ra_section_access_requester.exclusive_pointer()), m_count);
+		_Ty get() {
+			return base_class::get();
 		}
 
-		/* Prefer the "xscope_" prefixed versions to acknowledge that scope sections are returned. */
-		auto writelock_ra_section() {
-			return xscope_writelock_ra_section();
-		}
-		auto try_writelock_ra_section() {
-			return xscope_try_writelock_ra_section();
+		//shared_xscope_future<_Ty> share() _NOEXCEPT {}
+
+		xscope_future(const xscope_future&) = delete;
+		xscope_future& operator=(const xscope_future&) = delete;
+	
+		bool valid() const _NOEXCEPT {
+			return base_class::valid();
 		}
-		template<class _Rep, class _Period>
-		auto try_writelock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
-			return xscope_try_writelock_ra_section_for(_Rel_time);
+
+		void wait() const {
+			base_class::wait();
 		}
-		template<class _Clock, class _Duration>
-		auto try_writelock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
-			return xscope_try_writelock_ra_section_until(_Abs_time);
+
+		template<class _Rep, class _Per>
+		std::future_status wait_for( const std::chrono::duration<_Rep, _Per>& _Rel_time) const {
+			return base_class::wait_for(_Rel_time);
 		}
-		auto readlock_ra_section() {
-			return xscope_readlock_ra_section();
+
+		template<class _Clock, class _Dur>
+		std::future_status wait_until(const std::chrono::time_point<_Clock, _Dur>& _Abs_time) const {
+			return base_class::wait_until(_Abs_time);
 		}
-		auto try_readlock_ra_section() {
-			return xscope_try_readlock_ra_section();
+
+		/* Returns a future for the return value of the given function, which is called with the value of this future once
+		it is ready, without a thread having to wait for it. The function is called by the thread that completes this
+		future (or by the calling thread if this future is already ready), so it should be brief. If this future holds an
+		exception, the function is not called and the exception is propagated to the returned future. This future is
+		consumed (i.e. becomes invalid). */
+		template<class _Fty>
+		auto then(_Fty&& _Fnarg) {
+			typedef decltype(mse::impl::ns_xscope_future::invoke_with_result_of(std::declval<typename std::decay<_Fty>::type&>(), std::declval<base_class&>())) result_t;
+			return then_helper1<result_t>(std::forward<_Fty>(_Fnarg));
 		}
-		template<class _Rep, class _Period>
-		auto try_readlock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
-			return xscope_try_readlock_ra_section_for(_Rel_time);
+
+	private:
+		xscope_future(xscope_future&& _Other) _NOEXCEPT : base_class(std::forward<decltype(_Other)>(_Other))
+			, m_completion_state_shptr(std::move(_Other.m_completion_state_shptr)), m_producer_future(std::move(_Other.m_producer_future)) {}
+		xscope_future(base_class&& _Other) _NOEXCEPT : base_class(std::forward<decltype(_Other)>(_Other)) {}
+		xscope_future(base_class&& _Other, mse::impl::ns_xscope_future::completion_state_shptr_t completion_state_shptr, std::future<void>&& producer_future = std::future<void>()) _NOEXCEPT
+			: base_class(std::forward<decltype(_Other)>(_Other)), m_completion_state_shptr(std::move(completion_state_shptr)), m_producer_future(std::move(producer_future)) {}
+
+		/* Executes the callable in a new thread (as std::async(std::launch::async, ...) does), completing the future's
+		completion state once the return value has been stored. */
+		template<class _TCallable>
+		static xscope_future s_async_with_completion_state(_TCallable&& callable) {
+			auto completion_state_shptr = std::make_shared<mse::impl::ns_xscope_future::completion_state>();
+			std::packaged_task<_Ty()> packaged_task(std::forward<_TCallable>(callable));
+			auto result_future = packaged_task.get_future();
+			auto producer_future = std::async(std::launch::async, [task = mse::impl::ns_thread_pool::task<_Ty>(std::move(packaged_task), completion_state_shptr)]() mutable { task.run(); });
+			return xscope_future(std::move(result_future), std::move(completion_state_shptr), std::move(producer_future));
+		}
+
+		template<class _TResult, class _Fty>
+		xscope_future<_TResult> then_helper1(_Fty&& _Fnarg) {
+			// ensure that the function is of a safely passable type
+			xscope_thread::s_valid_if_xscope_passable(_Fnarg);
+			// ensure that the function return value is of a safely passable type
+			mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<_TResult>();
+			if (!valid()) {
+				MSE_THROW(std::logic_error("invalid (or already consumed) future - xscope_future::then()"));
+			}
+			auto continuation = [function = typename std::decay<_Fty>::type(std::forward<_Fty>(_Fnarg)), predecessor_future = base_class(std::move(*this))]() mutable -> _TResult {
+				return mse::impl::ns_xscope_future::invoke_with_result_of(function, predecessor_future);
+			};
+			if (!m_completion_state_shptr) {
+				/* This future's (deferred) function won't notify of its completion, so the continuation is deferred as well. */
+				return xscope_future<_TResult>(std::async(std::launch::deferred, std::move(continuation)));
+			}
+			auto completion_state_shptr = std::make_shared<mse::impl::ns_xscope_future::completion_state>();
+			std::packaged_task<_TResult()> packaged_task(std::move(continuation));
+			xscope_future<_TResult> retval(packaged_task.get_future(), completion_state_shptr, std::move(m_producer_future));
+			auto predecessor_completion_state_shptr = std::move(m_completion_state_shptr);
+			predecessor_completion_state_shptr->add_continuation(std::packaged_task<void()>(
+				[task = mse::impl::ns_thread_pool::task<_TResult>(std::move(packaged_task), completion_state_shptr)]() mutable { task.run(); }));
+			return retval;
 		}
-		template<class _Clock, class _Duration>
-		auto try_readlock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
-			return xscope_try_readlock_ra_section_until(_Abs_time);
+
+		const mse::impl::ns_xscope_future::completion_state_shptr_t& checked_completion_state_shptr() const {
+			if (!m_completion_state_shptr) {
+				MSE_THROW(std::invalid_argument("the future is invalid, or deferred (and so does not notify of its completion) - xscope_future"));
+			}
+			return m_completion_state_shptr;
 		}
-		auto exclusive_writelock_ra_section() {
-			return xscope_exclusive_writelock_ra_section();
+
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		/* Notifies continuations when the value is ready. (Null if the future is invalid or deferred.) */
+		mse::impl::ns_xscope_future::completion_state_shptr_t m_completion_state_shptr;
+		/* If the value is produced by a thread launched by xscope_async(), the std::async() future of that thread. If it's
+		produced by an xscope_thread_pool, a future that becomes ready once the pool's task (including any continuations
+		it runs) has been retired. Either way, the destructor waits for it. */
+		std::future<void> m_producer_future;
+
+		template<class _Fty, class... _ArgTypes>
+		friend auto xscope_async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
+		template<class _Fty, class... _ArgTypes>
+		friend auto xscope_async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
+		template<class... _Tys> friend xscope_future<void> when_all(const xscope_future<_Tys>&... futures);
+		template<class _Ty0, class... _Tys> friend xscope_future<size_t> when_any(const xscope_future<_Ty0>& future0, const xscope_future<_Tys>&... futures);
+
+		template<class _Ty2> friend class xscope_future;
+		template<class _Ty2> friend class xscope_future_carrier;
+		friend class xscope_thread_pool;
+	};
+
+	/* Unless the launch policy is (only) std::launch::deferred, the function is executed in a new thread, and the
+	returned future supports continuations (i.e. then(), when_all() and when_any()). */
+	template<class _Fty, class... _ArgTypes>
+	auto xscope_async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())> {
+		// ensure that the function arguments are of a safely passable type
+		xscope_thread::s_valid_if_xscope_passable(_Args...);
+		xscope_thread::s_valid_if_xscope_passable(_Fnarg);
+		// ensure that the function return value is of a safely passable type
+		mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
+		typedef decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get()) future_element_t;
+		if (std::launch::async != (_Policy & std::launch::async)) {
+			return xscope_future<future_element_t>(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
 		}
+		return xscope_future<future_element_t>::s_async_with_completion_state(mse::impl::ns_thread_pool::make_bound_call(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+	}
 
-		void xscope_async_shareable_and_passable_tag() const {}
+	template<class _Fty, class... _ArgTypes>
+	auto xscope_async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())> {
+		// ensure that the function arguments are of a safely passable type
+		xscope_thread::s_valid_if_xscope_passable(_Args...);
+		// ensure that the function return value is of a safely passable type
+		mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
+		typedef decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get()) future_element_t;
+		return xscope_future<future_element_t>::s_async_with_completion_state(mse::impl::ns_thread_pool::make_bound_call(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+	}
 
-	private:
-		TXScopeAsyncSplitterRASectionReadWriteAccessRequester(_TAccessLease&& exclusive_write_pointer)
-			: m_count(exclusive_write_pointer->size()), m_splitter_ra_section_access_requester(make_xscope_asyncsharedv2xwpreadwrite(std::forward<_TAccessLease>(exclusive_write_pointer))) {}
+	/* when_all() returns an xscope_future that becomes ready once all of the given xscope_futures are ready, without a
+	thread having to wait for them. The given futures are not consumed; their values (or exceptions) are obtained from
+	them as usual. */
+	template<class... _Tys>
+	xscope_future<void> when_all(const xscope_future<_Tys>&... futures) {
+		const std::vector<mse::impl::ns_xscope_future::completion_state_shptr_t> completion_state_shptrs{ futures.checked_completion_state_shptr()... };
+		auto future_and_completion_state = mse::impl::ns_xscope_future::make_when_all_future(completion_state_shptrs);
+		return xscope_future<void>(std::move(future_and_completion_state.first), std::move(future_and_completion_state.second));
+	}
 
-		TXScopeAsyncSplitterRASectionReadWriteAccessRequester& operator=(const TXScopeAsyncSplitterRASectionReadWriteAccessRequester& _Right_cref) = delete;
-		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+	/* when_any() returns an xscope_future for the (zero-based) index of the first of the given xscope_futures to become
+	ready. The given futures are not consumed. */
+	template<class _Ty0, class... _Tys>
+	xscope_future<size_t> when_any(const xscope_future<_Ty0>& future0, const xscope_future<_Tys>&... futures) {
+		const std::vector<mse::impl::ns_xscope_future::completion_state_shptr_t> completion_state_shptrs{ future0.checked_completion_state_shptr(), futures.checked_completion_state_shptr()... };
+		std::vector<size_t> indices;
+		indices.reserve(completion_state_shptrs.size());
+		for (size_t i = 0; completion_state_shptrs.size() > i; i += 1) {
+			indices.push_back(i);
+		}
+		auto future_and_completion_state = mse::impl::ns_xscope_future::make_when_any_future(completion_state_shptrs, indices);
+		return xscope_future<size_t>(std::move(future_and_completion_state.first), std::move(future_and_completion_state.second));
+	}
 
-		const size_type m_count = 0;
-		mse::TXScopeAsyncSharedV2XWPReadWriteAccessRequester<_TAccessLease> m_splitter_ra_section_access_requester;
+	namespace impl {
+		namespace ns_thread_pool {
+			/* A thread that, if still joinable, is joined when destroyed. */
+			class joining_thread : public std::thread {
+			public:
+				template<typename _TFunction>
+				explicit joining_thread(_TFunction&& func) : std::thread(std::forward<_TFunction>(func)) {}
+				joining_thread(joining_thread&& src) = default;
+				~joining_thread() {
+					if (joinable()) {
+						join();
+					}
+				}
+			};
 
-		template <typename _TExclusiveWritelockPtr>
-		friend class TXScopeAsyncRASectionSplitterXWP;
-	};
+			/* When destroyed, sets the (pool) state's "shutting down" flag and wakes its threads, which exit once there are no
+			more queued tasks. (Being declared after the threads, it's destroyed before them, including when a thread fails
+			to start in the constructor.) */
+			template<typename _TState>
+			class shutdown_signaller {
+			public:
+				explicit shutdown_signaller(_TState& state) : m_state_ref(state) {}
+				~shutdown_signaller() {
+					{
+						std::lock_guard<std::mutex> lock(m_state_ref.m_mutex);
+						m_state_ref.m_is_shutting_down = true;
+					}
+					m_state_ref.m_task_available_cv.notify_all();
+				}
+			private:
+				_TState& m_state_ref;
+			};
 
-	template <typename _TRAIterator>
-	class TAsyncSplitterRASectionReadWriteAccessRequester {
-	public:
-		typedef mse::TAsyncSplitterRandomAccessSection<_TRAIterator> splitter_ra_section_t;
-		typedef decltype(std::declval<splitter_ra_section_t>().size()) size_type;
+			/* A fixed set of threads that execute queued tasks in the order they were submitted. On destruction, the
+			remaining queued tasks are executed before the threads are joined. */
+			class thread_pool_core {
+			public:
+				explicit thread_pool_core(size_t thread_count) {
+					thread_count = (1 <= thread_count) ? thread_count : 1;
+					m_threads.reserve(thread_count);
+					for (size_t i = 0; thread_count > i; i += 1) {
+						m_threads.emplace_back([this]() { worker_loop(); });
+					}
+				}
+				thread_pool_core(const thread_pool_core&) = delete;
+				thread_pool_core& operator=(const thread_pool_core&) = delete;
+
+				/* If a completion state is given, it is completed once the callable's return value has been stored. If a
+				"retired" promise is given, it is satisfied once the task has been completely disposed of. */
+				template<typename _TCallable>
+				auto submit(_TCallable&& callable, mse::impl::ns_xscope_future::completion_state_shptr_t completion_state_shptr = nullptr
+					, std::unique_ptr<std::promise<void> > retired_promise_uqptr = nullptr) {
+					typedef typename std::decay<_TCallable>::type::result_type result_type;
+					std::packaged_task<result_type()> packaged_task(std::forward<_TCallable>(callable));
+					auto retval = packaged_task.get_future();
+					std::unique_ptr<task_base> task_uqptr(new task<result_type>(std::move(packaged_task), std::move(completion_state_shptr), std::move(retired_promise_uqptr)));
+					{
+						std::lock_guard<std::mutex> lock(m_state.m_mutex);
+						m_state.m_tasks.push_back(std::move(task_uqptr));
+					}
+					m_state.m_task_available_cv.notify_one();
+					return retval;
+				}
 
-		TAsyncSplitterRASectionReadWriteAccessRequester(const TAsyncSplitterRASectionReadWriteAccessRequester& src_cref) = default;
+				size_t thread_count() const { return m_threads.size(); }
 
-		typedef TRandomAccessSection<TRAIterator<decltype(std::declval<mse::TAsyncSharedV2ReadWriteAccessRequester<splitter_ra_section_t> >().writelock_ptr())> > rw_ra_section_t;
-		rw_ra_section_t writelock_ra_section() {
-			return rw_ra_section_t(TRAIterator<decltype(m_splitter_ra_section_access_requester.writelock_ptr())>(m_splitter_ra_section_access_requester.writelock_ptr()), m_count);
-		}
-		mse::mstd::optional<rw_ra_section_t> try_writelock_ra_section() {
-			auto maybe_wl_ptr = m_splitter_ra_section_access_requester.try_writelock_ptr();
-			if (!(maybe_wl_ptr.has_value())) {
-				return{};
-			}
-			auto& wl_ptr = maybe_wl_ptr.value();
-			return mse::mstd::optional<rw_ra_section_t>(rw_ra_section_t(TRAIterator<decltype(wl_ptr)>(wl_ptr), wl_ptr->size()));
-		}
-		template<class _Rep, class _Period>
-		mse::mstd::optional<rw_ra_section_t> try_writelock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
-			auto abs_time = std::chrono::system_clock::now() + _Rel_time;
-			return try_writelock_ra_section_until(abs_time);
-		}
-		template<class _Clock, class _Duration>
-		mse::mstd::optional<rw_ra_section_t> try_writelock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
-			auto maybe_wl_ptr = m_splitter_ra_section_access_requester.try_writelock_ptr_until(_Abs_time);
-			if (!(maybe_wl_ptr.has_value())) {
-				return{};
-			}
-			auto& wl_ptr = maybe_wl_ptr.value();
-			return mse::mstd::optional<rw_ra_section_t>(rw_ra_section_t(TRAIterator<decltype(wl_ptr)>(wl_ptr), wl_ptr->size()));
-		}
+			private:
+				void worker_loop() {
+					while (true) {
+						std::unique_ptr<task_base> task_uqptr;
+						{
+							std::unique_lock<std::mutex> lock(m_state.m_mutex);
+							m_state.m_task_available_cv.wait(lock, [this]() { return m_state.m_is_shutting_down || (!m_state.m_tasks.empty()); });
+							if (m_state.m_tasks.empty()) {
+								return;
+							}
+							task_uqptr = std::move(m_state.m_tasks.front());
+							m_state.m_tasks.pop_front();
+						}
+						task_uqptr->run();
+					}
+				}
 
-		typedef TRandomAccessSection<TRAIterator<TAsyncSharedV2ReadWriteConstPointer<splitter_ra_section_t> > > rwc_ra_section_t;
-		rwc_ra_section_t readlock_ra_section() {
-			return rwc_ra_section_t(TRAIterator<decltype(m_splitter_ra_section_access_requester.writelock_ptr())>(m_splitter_ra_section_access_requester.readlock_ptr()), m_count);
-		}
-		mse::mstd::optional<rwc_ra_section_t> try_readlock_ra_section() {
-			auto maybe_rl_ptr = m_splitter_ra_section_access_requester.try_readlock_ptr();
-			if (!(maybe_rl_ptr.has_value())) {
-				return{};
-			}
-			auto& rl_ptr = maybe_rl_ptr.value();
-			return mse::mstd::optional<rwc_ra_section_t>(rwc_ra_section_t(TRAIterator<decltype(rl_ptr)>(rl_ptr), rl_ptr->size()));
-		}
-		template<class _Rep, class _Period>
-		mse::mstd::optional<rwc_ra_section_t> try_readlock_ra_section_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
-			auto abs_time = std::chrono::system_clock::now() + _Rel_time;
-			return try_readlock_ra_section_until(abs_time);
-		}
-		template<class _Clock, class _Duration>
-		mse::mstd::optional<rwc_ra_section_t> try_readlock_ra_section_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
-			auto maybe_rl_ptr = m_splitter_ra_section_access_requester.try_readlock_ptr_until(_Abs_time);
-			if (!(maybe_rl_ptr.has_value())) {
-				return{};
-			}
-			auto& rl_ptr = maybe_rl_ptr.value();
-			return mse::mstd::optional<rwc_ra_section_t>(rwc_ra_section_t(TRAIterator<decltype(rl_ptr)>(rl_ptr), rl_ptr->size()));
-		}
+				struct state_t {
+					std::mutex m_mutex;
+					std::condition_variable m_task_available_cv;
+					std::deque<std::unique_ptr<task_base> > m_tasks;
+					bool m_is_shutting_down = false;
+				};
+
+				state_t m_state;
+				std::vector<joining_thread> m_threads;
+				/* Signals the threads to exit once the task queue is empty. */
+				shutdown_signaller<state_t> m_shutdown_signaller{ m_state };
+			};
 
-		/* Note that an exclusive_writelock_ra_section cannot coexist with any other lock_ra_sections (targeting the same object), including ones in
-		the same thread. Thus, using exclusive_writelock_ra_sections without sufficient care introduces the potential for exceptions (in a way
-		that sticking to (regular) writelock_ra_sections doesn't). */
-		typedef TRandomAccessSection<TRAIterator<TAsyncSharedV2ExclusiveReadWritePointer<splitter_ra_section_t> > > xrw_ra_section_t;
-		xrw_ra_section_t exclusive_writelock_ra_section() {
-			return xrw_ra_section_t(TRAIterator<decltype(m_splitter_ra_section_access_requester.writelock_ptr())>(m_splitter_ra_section_access_requester.exclusive_pointer()), m_count);
+			inline size_t default_thread_count() {
+				const size_t hardware_thread_count = std::thread::hardware_concurrency();
+				return (1 <= hardware_thread_count) ? hardware_thread_count : 1;
+			}
 		}
+	}
 
-		void async_shareable_and_passable_tag() const {}
-
-	private:
+	/* thread_pool executes (asynchronously) submitted functions using a fixed set of threads, avoiding the cost of
+	creating a thread for each task (as mstd::async() generally does). Like mstd::async(), async() ensures that the
+	function's arguments and return value are of a safely passable type, and returns a future for the return value. The destructor waits for all of the submitted tasks to complete. Note that a task that blocks waiting on
+	another task submitted to the same pool can deadlock if all of the pool's threads are so occupied. */
+	class thread_pool {
+	public:
+		explicit thread_pool(size_t thread_count = mse::impl::ns_thread_pool::default_thread_count()) : m_core(thread_count) {}
 
-		TAsyncSplitterRASectionReadWriteAccessRequester(const _TRAIterator& start_iter, size_type count) : m_count(count)
-			, m_splitter_ra_section_access_requester(make_asyncsharedv2readwrite<splitter_ra_section_t>(splitter_ra_section_t(start_iter, count))) {}
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
 
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+		template<class _Fty, class... _ArgTypes>
+		auto async(_Fty&& _Fnarg, _ArgTypes&&... _Args) {
+			// ensure that the function arguments are of a safely passable type
+			mstd::thread::s_valid_if_passable(_Args...);
+			// ensure that the function return value is of a safely passable type
+			mse::impl::T_valid_if_is_marked_as_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
+			return m_core.submit(mse::impl::ns_thread_pool::make_bound_call(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+		}
 
-		const size_type m_count = 0;
-		mse::TAsyncSharedV2ReadWriteAccessRequester<splitter_ra_section_t> m_splitter_ra_section_access_requester;
+		size_t thread_count() const { return m_core.thread_count(); }
 
-		template <typename _TExclusiveWritelockPtr>
-		friend class TAsyncRASectionSplitterXWP;
+	private:
+		mse::impl::ns_thread_pool::thread_pool_core m_core;
 	};
 
-	template <typename _TExclusiveWritelockPtr>
-	class TXScopeAsyncRASectionSplitterXWP : public mse::us::impl::XScopeTagBase {
+	/* xscope_thread_pool is the scope version of thread_pool. Like (the free function) xscope_async(), its xscope_async()
+	member function ensures that the function's arguments and return value are of a type that is safely passable to a
+	scope thread, and returns an xscope_future. (As with xscope_async(), rather than using the returned xscope_future
+	directly, you would more often submit the function via an xscope_future_carrier.) */
+	class xscope_thread_pool : public mse::us::impl::XScopeTagBase {
 	public:
-		typedef _TExclusiveWritelockPtr exclusive_writelock_ptr_t;
-		typedef typename std::remove_reference<decltype(*(std::declval<exclusive_writelock_ptr_t>()))>::type _TContainer;
-		typedef typename std::remove_reference<decltype(std::declval<_TContainer>()[0])>::type element_t;
-		typedef mse::TRAIterator<mse::us::impl::TPointerForLegacy<_TContainer> > ra_iterator_t;
-		typedef decltype(mse::us::impl::make_strong_iterator(std::declval<ra_iterator_t>(), std::declval<std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > >())) strong_ra_iterator_t;
-		typedef mse::TXScopeAsyncSplitterRandomAccessSection<strong_ra_iterator_t> xscope_splitter_ra_section_t;
-		typedef decltype(std::declval<xscope_splitter_ra_section_t>().size()) size_type;
-		typedef mse::TXScopeAccessControlledObj<xscope_splitter_ra_section_t> xscope_aco_splitter_ra_section_t;
-		typedef decltype(std::declval<xscope_aco_splitter_ra_section_t>().exclusive_pointer()) aco_exclusive_pointer_t;
-		typedef mse::TXScopeAsyncSplitterRASectionReadWriteAccessRequester<aco_exclusive_pointer_t> xscope_ras_ar_t;
-
-		template<typename _TList>
-		TXScopeAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, const _TList& section_sizes)
-			: m_access_lease_obj_shptr(std::make_shared<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> >(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr))) {
-			size_t cummulative_size = 0;
-			size_t count = 0;
-			//auto section_begin_it = m_access_lease_obj_shptr->cref()->begin();
-			auto section_begin_it = ra_iterator_t(std::addressof(*(m_access_lease_obj_shptr->cref())));
+		explicit xscope_thread_pool(size_t thread_count = mse::impl::ns_thread_pool::default_thread_count()) : m_core(thread_count) {}
 
-			for (const auto& section_size : section_sizes) {
-				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TXScopeAsyncRASectionSplitterXWP() - TXScopeAsyncRASectionSplitterXWP")); }
-				auto section_size_szt = mse::msev_as_a_size_t(section_size);
+		template<class _Fty, class... _ArgTypes>
+		auto xscope_async(_Fty&& _Fnarg, _ArgTypes&&... _Args) {
+			// ensure that the function arguments are of a safely passable type
+			xscope_thread::s_valid_if_xscope_passable(_Args...);
+			// ensure that the function return value is of a safely passable type
+			mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
+			typedef typename mse::impl::ns_thread_pool::bound_call_t<_Fty, _ArgTypes...>::result_type future_element_t;
+			auto completion_state_shptr = std::make_shared<mse::impl::ns_xscope_future::completion_state>();
+			/* The (copies of the) function and its arguments are destroyed before the result is published, and the returned
+			future's destructor waits until the pool thread has retired the task, so none of them are disposed of in the
+			pool thread after the caller's scope may have ended. */
+			auto retired_promise_uqptr = std::make_unique<std::promise<void> >();
+			auto retired_future = retired_promise_uqptr->get_future();
+			auto result_future = m_core.submit(mse::impl::ns_thread_pool::destroying_call<mse::impl::ns_thread_pool::bound_call_t<_Fty, _ArgTypes...> >(
+				mse::impl::ns_thread_pool::make_bound_call(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...)), completion_state_shptr, std::move(retired_promise_uqptr));
+			return xscope_future<future_element_t>(std::move(result_future), std::move(completion_state_shptr), std::move(retired_future));
+		}
 
-				strong_ra_iterator_t it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
-				auto res1 = m_splitter_aco_ra_section_map.emplace(count, xscope_aco_splitter_ra_section_t(it1, section_size_szt));
-				m_ra_section_ar_map.emplace(count, mse::TXScopeAsyncSplitterRASectionReadWriteAccessRequester<aco_exclusive_pointer_t>(res1.first->second.exclusive_pointer()));
+		size_t thread_count() const { return m_core.thread_count(); }
 
-				cummulative_size += section_size_szt;
-				section_begin_it += section_size_szt;
-				count += 1;
-			}
-			if (m_access_lease_obj_shptr->cref()->size() > cummulative_size) {
-				auto section_size = m_access_lease_obj_shptr->cref()->size() - cummulative_size;
-				auto section_size_szt = mse::msev_as_a_size_t(section_size);
-				auto it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
-				auto res1 = m_splitter_aco_ra_section_map.emplace(count, xscope_aco_splitter_ra_section_t(it1, section_size_szt));
-				m_ra_section_ar_map.emplace(count, mse::TXScopeAsyncSplitterRASectionReadWriteAccessRequester<aco_exclusive_pointer_t>(res1.first->second.exclusive_pointer()));
-			}
-		}
-		TXScopeAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, size_t split_index)
-			: TXScopeAsyncRASectionSplitterXWP(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr), std::array<size_t, 1>{ {split_index}}) {}
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncRASectionSplitterXWP() {
-			mse::impl::is_valid_if_exclusive_pointer<exclusive_writelock_ptr_t>::no_op();
-		}
+		void xscope_tag() const {}
 
-		xscope_ras_ar_t xscope_ra_section_access_requester(size_t index) const {
-			return m_ra_section_ar_map.at(index);
-		}
-		xscope_ras_ar_t xscope_first_ra_section_access_requester() const {
-			return m_ra_section_ar_map.at(0);
-		}
-		xscope_ras_ar_t xscope_second_ra_section_access_requester() const {
-			return m_ra_section_ar_map.at(1);
-		}
-		xscope_ras_ar_t ra_section_access_requester(size_t index) const {
-			return m_ra_section_ar_map.at(index);
-		}
-		xscope_ras_ar_t first_ra_section_access_requester() const {
-			return m_ra_section_ar_map.at(0);
-		}
-		xscope_ras_ar_t second_ra_section_access_requester() const {
-			return m_ra_section_ar_map.at(1);
-		}
 	private:
-		TXScopeAsyncRASectionSplitterXWP(const TXScopeAsyncRASectionSplitterXWP& src) = delete;
-		TXScopeAsyncRASectionSplitterXWP(TXScopeAsyncRASectionSplitterXWP&& src) = delete;
-		TXScopeAsyncRASectionSplitterXWP & operator=(const TXScopeAsyncRASectionSplitterXWP& _Right_cref) = delete;
+		xscope_thread_pool(const xscope_thread_pool&) = delete;
+		xscope_thread_pool& operator=(const xscope_thread_pool&) = delete;
+
 		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
 
-		std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > m_access_lease_obj_shptr;
-		std::unordered_map<size_t, xscope_aco_splitter_ra_section_t> m_splitter_aco_ra_section_map;
-		std::unordered_map<size_t, xscope_ras_ar_t> m_ra_section_ar_map;
+		mse::impl::ns_thread_pool::thread_pool_core m_core;
 	};
 
-#ifdef MSE_HAS_CXX17
-	/* deduction guide */
-	template <typename _TExclusiveWritelockPtr>
-	TXScopeAsyncRASectionSplitterXWP(_TExclusiveWritelockPtr)->TXScopeAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>;
-#endif /* MSE_HAS_CXX17 */
+	namespace impl {
+		namespace ns_parallel {
+			/* A set of threads, each with its own task queue. Threads whose queue is empty "steal" tasks from the (opposite
+			end of the) other threads' queues, so that a batch of tasks is (dynamically) balanced among the threads. Threads
+			that submit a batch of tasks participate in executing them while they wait for the batch to complete. */
+			class work_stealing_pool {
+			public:
+				typedef mse::impl::ns_thread_pool::task_base task_base;
+
+				class batch_t {
+				public:
+					explicit batch_t(size_t task_count) : m_remaining_task_count(task_count) {}
+					void note_task_completed() {
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_remaining_task_count -= 1;
+						if (0 == m_remaining_task_count) {
+							m_completed_cv.notify_all();
+						}
+					}
+					void wait() {
+						std::unique_lock<std::mutex> lock(m_mutex);
+						m_completed_cv.wait(lock, [this]() { return (0 == m_remaining_task_count); });
+					}
+				private:
+					std::mutex m_mutex;
+					std::condition_variable m_completed_cv;
+					size_t m_remaining_task_count = 0;
+				};
+
+				explicit work_stealing_pool(size_t worker_count) : m_queues(worker_count + 1) {
+					m_threads.reserve(worker_count);
+					for (size_t i = 0; worker_count > i; i += 1) {
+						m_threads.emplace_back([this, i]() { worker_loop(i); });
+					}
+				}
+				work_stealing_pool(const work_stealing_pool&) = delete;
+				work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+				/* Executes the given tasks and returns once they have all completed. */
+				void execute(const std::vector<task_base*>& task_ptrs) {
+					batch_t batch(task_ptrs.size());
+					/* The tasks are distributed among the queues in contiguous blocks. The last queue is not serviced by
+					a (dedicated) worker thread, but by the threads submitting tasks. */
+					const size_t queue_count = m_queues.size();
+					m_state.m_queued_task_count.fetch_add(task_ptrs.size());
+					for (size_t qi = 0; queue_count > qi; qi += 1) {
+						const size_t begin_index = task_ptrs.size() * qi / queue_count;
+						const size_t end_index = task_ptrs.size() * (qi + 1) / queue_count;
+						if (begin_index < end_index) {
+							auto& queue = m_queues[qi];
+							std::lock_guard<std::mutex> lock(queue.m_mutex);
+							for (size_t i = begin_index; end_index > i; i += 1) {
+								queue.m_tasks.push_back(queued_task_t{ task_ptrs[i], &batch });
+							}
+						}
+					}
+					{
+						std::lock_guard<std::mutex> lock(m_state.m_mutex);
+					}
+					m_state.m_task_available_cv.notify_all();
 
-	template <typename _TExclusiveWritelockPtr>
-	class TAsyncRASectionSplitterXWP {
-	public:
-		typedef _TExclusiveWritelockPtr exclusive_writelock_ptr_t;
-		typedef typename std::remove_reference<decltype(*(std::declval<exclusive_writelock_ptr_t>()))>::type _TContainer;
-		typedef typename std::remove_reference<decltype(std::declval<_TContainer>()[0])>::type element_t;
-		typedef mse::TRAIterator<mse::us::impl::TPointerForLegacy<_TContainer> > ra_iterator_t;
-		typedef decltype(mse::us::impl::make_strong_iterator(std::declval<ra_iterator_t>(), std::declval<std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > >())) strong_ra_iterator_t;
-		typedef TAsyncSplitterRASectionReadWriteAccessRequester<strong_ra_iterator_t> ras_ar_t;
+					while (run_one_task(queue_count - 1)) {}
+					batch.wait();
+				}
 
-		template<typename _TList>
-		TAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, const _TList& section_sizes)
-			: m_access_lease_obj_shptr(std::make_shared<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> >(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr))) {
-			size_t cummulative_size = 0;
-			//auto section_begin_it = m_access_lease_obj_shptr->cref()->begin();
-			auto section_begin_it = ra_iterator_t(std::addressof(*(m_access_lease_obj_shptr->cref())));
-			for (const auto& section_size : section_sizes) {
-				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TAsyncRASectionSplitterXWP() - TAsyncRASectionSplitterXWP")); }
-				auto section_size_szt = mse::msev_as_a_size_t(section_size);
+				size_t worker_count() const { return m_threads.size(); }
 
-				strong_ra_iterator_t it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
-				ras_ar_t ras_ar1 = mse::TAsyncSplitterRASectionReadWriteAccessRequester<strong_ra_iterator_t>(it1, section_size_szt);
-				m_ra_sections.push_back(ras_ar1);
+			private:
+				struct queued_task_t {
+					task_base* m_task_ptr;
+					batch_t* m_batch_ptr;
+				};
+				struct queue_t {
+					std::mutex m_mutex;
+					std::deque<queued_task_t> m_tasks;
+				};
+
+				/* Executes a task from the front of the given queue or, if it's empty, from the back of another queue.
+				Returns false if there were no tasks to execute. */
+				bool run_one_task(size_t own_queue_index) {
+					const size_t queue_count = m_queues.size();
+					for (size_t k = 0; queue_count > k; k += 1) {
+						auto& queue = m_queues[(own_queue_index + k) % queue_count];
+						queued_task_t queued_task{ nullptr, nullptr };
+						{
+							std::lock_guard<std::mutex> lock(queue.m_mutex);
+							if (queue.m_tasks.empty()) {
+								continue;
+							}
+							if (0 == k) {
+								queued_task = queue.m_tasks.front();
+								queue.m_tasks.pop_front();
+							}
+							else {
+								queued_task = queue.m_tasks.back();
+								queue.m_tasks.pop_back();
+							}
+						}
+						m_state.m_queued_task_count.fetch_sub(1);
+						queued_task.m_task_ptr->run();
+						queued_task.m_batch_ptr->note_task_completed();
+						return true;
+					}
+					return false;
+				}
 
-				cummulative_size += section_size_szt;
-				section_begin_it += section_size_szt;
+				void worker_loop(size_t queue_index) {
+					while (true) {
+						if (run_one_task(queue_index)) {
+							continue;
+						}
+						std::unique_lock<std::mutex> lock(m_state.m_mutex);
+						if (0 != m_state.m_queued_task_count.load()) {
+							/* The (counted) tasks haven't been added to the queues yet. */
+							lock.unlock();
+							std::this_thread::yield();
+							continue;
+						}
+						if (m_state.m_is_shutting_down) {
+							return;
+						}
+						m_state.m_task_available_cv.wait(lock);
+					}
+				}
+
+				struct state_t {
+					std::mutex m_mutex;
+					std::condition_variable m_task_available_cv;
+					/* Incremented before tasks are added to the queues, and decremented when they're removed. */
+					std::atomic<size_t> m_queued_task_count{ 0 };
+					bool m_is_shutting_down = false;
+				};
+
+				state_t m_state;
+				std::vector<queue_t> m_queues;
+				std::vector<mse::impl::ns_thread_pool::joining_thread> m_threads;
+				/* Signals the threads to exit once the queues are empty. */
+				mse::impl::ns_thread_pool::shutdown_signaller<state_t> m_shutdown_signaller{ m_state };
+			};
+
+			/* The pool used by xscope_parallel_for() and xscope_parallel_reduce(). (As the calling thread participates,
+			one fewer worker thread than the number of hardware threads is needed.) The pool is intentionally never
+			destroyed, so it remains usable during the destruction of static objects. */
+			inline work_stealing_pool& default_work_stealing_pool() {
+				static work_stealing_pool* s_pool_ptr = new work_stealing_pool(mse::impl::ns_thread_pool::default_thread_count() - 1);
+				return *s_pool_ptr;
 			}
-			if (m_access_lease_obj_shptr->cref()->size() > cummulative_size) {
-				auto section_size = m_access_lease_obj_shptr->cref()->size() - cummulative_size;
-				auto it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
-				auto ras_ar1 = mse::TAsyncSplitterRASectionReadWriteAccessRequester<strong_ra_iterator_t>(it1, section_size);
-				m_ra_sections.push_back(ras_ar1);
+
+			/* Executes the given function with (a copy of) the access requester of each of the splitter's sections and
+			returns the (ready) futures of the results. */
+			template<typename _TExclusiveWritelockPtr, typename _TSectionFunction>
+			auto execute_for_each_ra_section(const TXScopeAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>& splitter, const _TSectionFunction& section_function) {
+				typedef typename TXScopeAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>::xscope_ras_ar_t xscope_ras_ar_t;
+				typedef decltype(section_function(std::declval<xscope_ras_ar_t&>())) result_type;
+				const size_t section_count = splitter.ra_section_count();
+				std::vector<std::future<result_type> > futures;
+				std::vector<std::unique_ptr<mse::impl::ns_thread_pool::task_base> > tasks;
+				std::vector<mse::impl::ns_thread_pool::task_base*> task_ptrs;
+				futures.reserve(section_count);
+				tasks.reserve(section_count);
+				task_ptrs.reserve(section_count);
+				for (size_t i = 0; section_count > i; i += 1) {
+					auto ar = splitter.xscope_ra_section_access_requester(i);
+					std::packaged_task<result_type()> packaged_task([ar, &section_function]() mutable { return section_function(ar); });
+					futures.push_back(packaged_task.get_future());
+					tasks.emplace_back(new mse::impl::ns_thread_pool::task<result_type>(std::move(packaged_task)));
+					task_ptrs.push_back(tasks.back().get());
+				}
+				default_work_stealing_pool().execute(task_ptrs);
+				return futures;
 			}
-		}
-		TAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, size_t split_index)
-			: TAsyncRASectionSplitterXWP(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr), std::array<size_t, 1>{ {split_index}}) {}
-		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncRASectionSplitterXWP() {
-			mse::impl::T_valid_if_not_an_xscope_type<exclusive_writelock_ptr_t>();
-			mse::impl::is_valid_if_exclusive_pointer<exclusive_writelock_ptr_t>::no_op();
-		}
 
-		ras_ar_t ra_section_access_requester(size_t index) const {
-			return m_ra_sections.at(index);
+			template<typename _TAccessSource>
+			auto exclusive_pointer_of_helper1(std::true_type, _TAccessSource& access_requester) {
+				return access_requester.exclusive_pointer();
+			}
+			template<typename _TAccessSource>
+			auto exclusive_pointer_of_helper1(std::false_type, _TAccessSource& aco_pointer) {
+				return aco_pointer->exclusive_pointer();
+			}
+			template<typename _TAccessSource, typename = void>
+			struct has_exclusive_pointer_method : std::false_type {};
+			template<typename _TAccessSource>
+			struct has_exclusive_pointer_method<_TAccessSource, mse::impl::void_t<decltype(std::declval<_TAccessSource&>().exclusive_pointer())> > : std::true_type {};
+			/* Obtains an exclusive pointer from either an access requester or a pointer to an access controlled object. */
+			template<typename _TAccessSource>
+			auto exclusive_pointer_of(_TAccessSource& access_source) {
+				return exclusive_pointer_of_helper1(typename has_exclusive_pointer_method<_TAccessSource>::type(), access_source);
+			}
+
+			/* The section sizes for splitting a container of the given size into sections of (at most) the given size. (The
+			splitter adds a section for any remaining elements.) */
+			inline std::vector<size_t> grain_section_sizes(size_t size, size_t grain) {
+				grain = (1 <= grain) ? grain : 1;
+				return std::vector<size_t>(size / grain, grain);
+			}
 		}
-		ras_ar_t first_ra_section_access_requester() const {
-			return m_ra_sections.at(0);
+	}
+
+	/* xscope_parallel_for() calls the given function with (a writelock random access section of) each section of the given
+	splitter, distributing the calls among the threads of a (shared) work-stealing pool, and returns once all the calls have
+	completed. The calling thread participates in the execution. So unlike using a scope thread for each section, a slow
+	section does not prevent the other threads from processing the remaining sections. As with xscope_async(), the function
+	must be of a type that is safely passable to a scope thread. If any of the calls throws an exception, (the first such)
+	exception is rethrown once all the calls have completed. */
+	template<typename _TExclusiveWritelockPtr, typename _TFunction>
+	void xscope_parallel_for(const TXScopeAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>& splitter, const _TFunction& func) {
+		typedef typename TXScopeAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>::xscope_ras_ar_t xscope_ras_ar_t;
+		// ensure that the function is of a safely passable type
+		xscope_thread::s_valid_if_xscope_passable(func);
+		auto futures = mse::impl::ns_parallel::execute_for_each_ra_section(splitter, [&func](xscope_ras_ar_t& ar) { func(ar.xscope_writelock_ra_section()); });
+		for (auto& future : futures) {
+			future.get();
 		}
-		ras_ar_t second_ra_section_access_requester() const {
-			return m_ra_sections.at(1);
+	}
+	/* This overload splits the container (targeted by the given access requester or scope pointer to an access controlled
+	object) into sections of "grain" elements (except possibly the last one) and calls the given function with each
+	section. */
+	template<typename _TAccessSource, typename _TFunction>
+	void xscope_parallel_for(_TAccessSource&& access_source, size_t grain, const _TFunction& func) {
+		auto xwp = mse::impl::ns_parallel::exclusive_pointer_of(access_source);
+		const auto section_sizes = mse::impl::ns_parallel::grain_section_sizes(mse::msev_as_a_size_t((*xwp).size()), grain);
+		const TXScopeAsyncRASectionSplitterXWP<decltype(xwp)> splitter(std::move(xwp), section_sizes);
+		xscope_parallel_for(splitter, func);
+	}
+
+	/* xscope_parallel_reduce() calls the given "map" function with (a readlock random access section of) each section of
+	the given splitter, as xscope_parallel_for() does, then combines the results, in section order, using the given
+	"combine" function, starting with the given initial value. The (conversion to _TResult of the) return value of the
+	map function must be of a type that is safely passable to a scope thread. The combine function is called only by
+	the calling thread. */
+	template<typename _TExclusiveWritelockPtr, typename _TResult, typename _TMapFunction, typename _TCombineFunction>
+	_TResult xscope_parallel_reduce(const TXScopeAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>& splitter, const _TResult& init
+		, const _TMapFunction& map_func, const _TCombineFunction& combine_func) {
+		typedef typename TXScopeAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>::xscope_ras_ar_t xscope_ras_ar_t;
+		// ensure that the function is of a safely passable type
+		xscope_thread::s_valid_if_xscope_passable(map_func);
+		// ensure that the function return value is of a safely passable type
+		mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<_TResult>();
+		auto futures = mse::impl::ns_parallel::execute_for_each_ra_section(splitter, [&map_func](xscope_ras_ar_t& ar) { return _TResult(map_func(ar.xscope_readlock_ra_section())); });
+		_TResult retval = init;
+		for (auto& future : futures) {
+			retval = combine_func(retval, future.get());
 		}
-	private:
-		TAsyncRASectionSplitterXWP(const TAsyncRASectionSplitterXWP& src) = delete;
-		TAsyncRASectionSplitterXWP(TAsyncRASectionSplitterXWP&& src) = delete;
+		return retval;
+	}
+	template<typename _TAccessSource, typename _TResult, typename _TMapFunction, typename _TCombineFunction>
+	_TResult xscope_parallel_reduce(_TAccessSource&& access_source, size_t grain, const _TResult& init
+		, const _TMapFunction& map_func, const _TCombineFunction& combine_func) {
+		auto xwp = mse::impl::ns_parallel::exclusive_pointer_of(access_source);
+		const auto section_sizes = mse::impl::ns_parallel::grain_section_sizes(mse::msev_as_a_size_t((*xwp).size()), grain);
+		const TXScopeAsyncRASectionSplitterXWP<decltype(xwp)> splitter(std::move(xwp), section_sizes);
+		return xscope_parallel_reduce(splitter, init, map_func, combine_func);
+	}
 
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+	namespace impl {
+		namespace ns_channel {
+			/* A bounded, lock-free, multi-producer/multi-consumer queue (based on Dmitry Vyukov's well known algorithm). Each
+			cell has a sequence number that indicates whether it's ready to be written (for a given "lap" through the buffer)
+			or read. Producers (and consumers) claim a cell by advancing the enqueue (or dequeue) position, then "publish" the
+			cell by updating its sequence number. (The sequence number is twice the position, plus one once the cell has been
+			written, so that a capacity of one isn't ambiguous.) Note that _Ty's move constructor should not throw. */
+			template<typename _Ty>
+			class mpmc_queue {
+			public:
+				typedef _Ty value_type;
 
-		std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > m_access_lease_obj_shptr;
-		std::vector<ras_ar_t> m_ra_sections;
-	};
+				explicit mpmc_queue(size_t capacity) : m_capacity(capacity), m_cells(new cell_t[capacity]) {
+					for (size_t i = 0; m_capacity > i; i += 1) {
+						m_cells[i].m_sequence.store(2 * i, std::memory_order_relaxed);
+					}
+				}
+				mpmc_queue(const mpmc_queue&) = delete;
+				mpmc_queue& operator=(const mpmc_queue&) = delete;
+				~mpmc_queue() {
+					mse::mstd::optional<_Ty> discarded;
+					while (try_pop(discarded)) {}
+				}
 
-#ifdef MSE_HAS_CXX17
-	/* deduction guide */
-	template <typename _TExclusiveWritelockPtr>
-	TAsyncRASectionSplitterXWP(_TExclusiveWritelockPtr)->TAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>;
-#endif /* MSE_HAS_CXX17 */
+				/* The value is only moved from if the push succeeds. */
+				bool try_push(_Ty&& value) {
+					size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+					while (true) {
+						cell_t& cell = m_cells[pos % m_capacity];
+						const size_t sequence = cell.m_sequence.load(std::memory_order_acquire);
+						const auto diff = std::intptr_t(sequence) - std::intptr_t(2 * pos);
+						if (0 == diff) {
+							if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+								::new (static_cast<void*>(std::addressof(cell.m_storage))) _Ty(std::move(value));
+								cell.m_sequence.store(2 * pos + 1, std::memory_order_release);
+								return true;
+							}
+						}
+						else if (0 > diff) {
+							/* full */
+							return false;
+						}
+						else {
+							pos = m_enqueue_pos.load(std::memory_order_relaxed);
+						}
+					}
+				}
+				bool try_pop(mse::mstd::optional<_Ty>& dest) {
+					size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+					while (true) {
+						cell_t& cell = m_cells[pos % m_capacity];
+						const size_t sequence = cell.m_sequence.load(std::memory_order_acquire);
+						const auto diff = std::intptr_t(sequence) - std::intptr_t(2 * pos + 1);
+						if (0 == diff) {
+							if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+								_Ty& value_ref = *reinterpret_cast<_Ty*>(std::addressof(cell.m_storage));
+								dest.emplace(std::move(value_ref));
+								value_ref.~_Ty();
+								cell.m_sequence.store(2 * (pos + m_capacity), std::memory_order_release);
+								return true;
+							}
+						}
+						else if (0 > diff) {
+							/* empty */
+							return false;
+						}
+						else {
+							pos = m_dequeue_pos.load(std::memory_order_relaxed);
+						}
+					}
+				}
 
-	template <typename _TAccessRequester>
-	class TXScopeAsyncRASectionSplitter : public TXScopeAsyncRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer())> {
-	public:
-		typedef TXScopeAsyncRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer())> base_class;
+				size_t capacity() const { return m_capacity; }
 
-		template<typename _TList>
-		TXScopeAsyncRASectionSplitter(_TAccessRequester& ar, const _TList& section_sizes) : base_class(ar.exclusive_pointer(), section_sizes) {}
+			private:
+				struct cell_t {
+					std::atomic<size_t> m_sequence{ 0 };
+					typename std::aligned_storage<sizeof(_Ty), alignof(_Ty)>::type m_storage;
+				};
+
+				const size_t m_capacity;
+				const std::unique_ptr<cell_t[]> m_cells;
+				/* The positions are separated by padding so that producers and consumers don't contend for the same
+				cache line. */
+				char m_padding1[mse::impl::sc_cache_line_size];
+				std::atomic<size_t> m_enqueue_pos{ 0 };
+				char m_padding2[mse::impl::sc_cache_line_size];
+				std::atomic<size_t> m_dequeue_pos{ 0 };
+				char m_padding3[mse::impl::sc_cache_line_size];
+			};
 
-		TXScopeAsyncRASectionSplitter(_TAccessRequester& ar, size_t split_index) : base_class(ar.exclusive_pointer(), split_index) {}
+			/* A bounded, lock-free, single-producer/single-consumer queue. The producer and consumer each keep a (possibly
+			stale) copy of the other's position, so that they only need to read the other's (cache line of) state when the
+			queue appears full (or empty). */
+			template<typename _Ty>
+			class spsc_queue {
+			public:
+				typedef _Ty value_type;
+
+				explicit spsc_queue(size_t capacity) : m_capacity(capacity), m_slots(new storage_t[capacity]) {}
+				spsc_queue(const spsc_queue&) = delete;
+				spsc_queue& operator=(const spsc_queue&) = delete;
+				~spsc_queue() {
+					mse::mstd::optional<_Ty> discarded;
+					while (try_pop(discarded)) {}
+				}
 
-	private:
-		TXScopeAsyncRASectionSplitter & operator=(const TXScopeAsyncRASectionSplitter& _Right_cref) = delete;
-		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
-	};
+				/* The value is only moved from if the push succeeds. */
+				bool try_push(_Ty&& value) {
+					const size_t tail = m_tail.load(std::memory_order_relaxed);
+					if (m_capacity <= tail - m_producer_cached_head) {
+						m_producer_cached_head = m_head.load(std::memory_order_acquire);
+						if (m_capacity <= tail - m_producer_cached_head) {
+							return false;
+						}
+					}
+					::new (static_cast<void*>(std::addressof(m_slots[tail % m_capacity]))) _Ty(std::move(value));
+					m_tail.store(tail + 1, std::memory_order_release);
+					return true;
+				}
+				bool try_pop(mse::mstd::optional<_Ty>& dest) {
+					const size_t head = m_head.load(std::memory_order_relaxed);
+					if (head == m_consumer_cached_tail) {
+						m_consumer_cached_tail = m_tail.load(std::memory_order_acquire);
+						if (head == m_consumer_cached_tail) {
+							return false;
+						}
+					}
+					_Ty& value_ref = *reinterpret_cast<_Ty*>(std::addressof(m_slots[head % m_capacity]));
+					dest.emplace(std::move(value_ref));
+					value_ref.~_Ty();
+					m_head.store(head + 1, std::memory_order_release);
+					return true;
+				}
 
-#ifdef MSE_HAS_CXX17
-	/* deduction guide */
-	template<typename _TAccessRequester, typename _TList>
-	TXScopeAsyncRASectionSplitter(_TAccessRequester, _TList)->TXScopeAsyncRASectionSplitter<_TAccessRequester>;
-	template<typename _TAccessRequester>
-	TXScopeAsyncRASectionSplitter(_TAccessRequester, size_t)->TXScopeAsyncRASectionSplitter<_TAccessRequester>;
-#endif /* MSE_HAS_CXX17 */
+				size_t capacity() const { return m_capacity; }
 
-	template <typename _TAccessRequester>
-	class TAsyncRASectionSplitter : public TAsyncRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer())> {
-	public:
-		typedef TAsyncRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer())> base_class;
+			private:
+				typedef typename std::aligned_storage<sizeof(_Ty), alignof(_Ty)>::type storage_t;
+
+				const size_t m_capacity;
+				const std::unique_ptr<storage_t[]> m_slots;
+				char m_padding1[mse::impl::sc_cache_line_size];
+				/* producer state */
+				std::atomic<size_t> m_tail{ 0 };
+				size_t m_producer_cached_head = 0;
+				char m_padding2[mse::impl::sc_cache_line_size];
+				/* consumer state */
+				std::atomic<size_t> m_head{ 0 };
+				size_t m_consumer_cached_tail = 0;
+				char m_padding3[mse::impl::sc_cache_line_size];
+			};
+
+			/* Threads blocked waiting for an operation to become possible. The waiting thread registers itself before its
+			final attempt, and the threads performing the complementary operation check (after a fence) for registered
+			waiters, so a notification can't be missed, while the mutex is only touched when a thread is (or may be)
+			waiting. */
+			class waiters_t {
+			public:
+				template<typename _TAttempt>
+				void wait(const _TAttempt& attempt) {
+					if (spin_attempt(attempt)) {
+						return;
+					}
+					std::unique_lock<std::mutex> lock(m_mutex);
+					register_waiter();
+					while (!attempt()) {
+						m_cv.wait(lock);
+					}
+					m_waiting_count.fetch_sub(1);
+				}
+				template<typename _TAttempt, class _Clock, class _Duration>
+				bool wait_until(const _TAttempt& attempt, const std::chrono::time_point<_Clock, _Duration>& abs_time) {
+					if (spin_attempt(attempt)) {
+						return true;
+					}
+					std::unique_lock<std::mutex> lock(m_mutex);
+					register_waiter();
+					bool retval = attempt();
+					while ((!retval) && (std::cv_status::timeout != m_cv.wait_until(lock, abs_time))) {
+						retval = attempt();
+					}
+					if (!retval) {
+						retval = attempt();
+					}
+					m_waiting_count.fetch_sub(1);
+					return retval;
+				}
+				void notify() {
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					if (0 != m_waiting_count.load(std::memory_order_relaxed)) {
+						{
+							std::lock_guard<std::mutex> lock(m_mutex);
+						}
+						m_cv.notify_all();
+					}
+				}
+
+			private:
+				/* Briefly busy-waits before resorting to the condition variable. */
+				template<typename _TAttempt>
+				static bool spin_attempt(const _TAttempt& attempt) {
+					int spin_count = 0;
+					while (64 > spin_count) {
+						if (attempt()) {
+							return true;
+						}
+						mse::impl::ns_access_mutex::spin_pause(spin_count);
+					}
+					return false;
+				}
+				void register_waiter() {
+					m_waiting_count.fetch_add(1);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+				}
 
-		template<typename _TList>
-		TAsyncRASectionSplitter(_TAccessRequester& ar, const _TList& section_sizes) : base_class(ar.exclusive_pointer(), section_sizes) {}
+				std::mutex m_mutex;
+				std::condition_variable m_cv;
+				std::atomic<size_t> m_waiting_count{ 0 };
+			};
 
-		TAsyncRASectionSplitter(_TAccessRequester& ar, size_t split_index) : base_class(ar.exclusive_pointer(), split_index) {}
+			template<typename _TQueue>
+			class channel_state {
+			public:
+				typedef typename _TQueue::value_type value_type;
 
-	private:
-		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
-	};
+				explicit channel_state(size_t capacity) : m_queue(capacity) {}
 
-#ifdef MSE_HAS_CXX17
-	/* deduction guide */
-	template<typename _TAccessRequester, typename _TList>
-	TAsyncRASectionSplitter(_TAccessRequester, _TList)->TAsyncRASectionSplitter<_TAccessRequester>;
-	template<typename _TAccessRequester>
-	TAsyncRASectionSplitter(_TAccessRequester, size_t)->TAsyncRASectionSplitter<_TAccessRequester>;
-#endif /* MSE_HAS_CXX17 */
+				bool try_send(value_type&& value) {
+					if (!m_queue.try_push(std::move(value))) {
+						return false;
+					}
+					m_receive_waiters.notify();
+					return true;
+				}
+				void send(value_type&& value) {
+					m_send_waiters.wait([this, &value]() { return m_queue.try_push(std::move(value)); });
+					m_receive_waiters.notify();
+				}
+				template<class _Clock, class _Duration>
+				bool try_send_until(value_type&& value, const std::chrono::time_point<_Clock, _Duration>& abs_time) {
+					if (!m_send_waiters.wait_until([this, &value]() { return m_queue.try_push(std::move(value)); }, abs_time)) {
+						return false;
+					}
+					m_receive_waiters.notify();
+					return true;
+				}
 
-	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex>
-	class TXScopeAsyncACORASectionSplitter : public TXScopeAsyncRASectionSplitterXWP<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> {
-	public:
-		typedef TXScopeAsyncRASectionSplitterXWP<decltype(std::declval<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >().exclusive_pointer())> base_class;
-		typedef mse::TXScopeFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> > xsac_obj_xscpptr_t;
-		typedef mse::TXScopeFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> > ac_obj_xscpptr_t;
+				mse::mstd::optional<value_type> try_receive() {
+					mse::mstd::optional<value_type> retval;
+					if (m_queue.try_pop(retval)) {
+						m_send_waiters.notify();
+					}
+					return retval;
+				}
+				value_type receive() {
+					mse::mstd::optional<value_type> retval;
+					m_receive_waiters.wait([this, &retval]() { return m_queue.try_pop(retval); });
+					m_send_waiters.notify();
+					return std::move(retval.value());
+				}
+				template<class _Clock, class _Duration>
+				mse::mstd::optional<value_type> try_receive_until(const std::chrono::time_point<_Clock, _Duration>& abs_time) {
+					mse::mstd::optional<value_type> retval;
+					if (m_receive_waiters.wait_until([this, &retval]() { return m_queue.try_pop(retval); }, abs_time)) {
+						m_send_waiters.notify();
+					}
+					return retval;
+				}
 
-		TXScopeAsyncACORASectionSplitter(const xsac_obj_xscpptr_t& xsptr, size_t split_index) : base_class(xsptr->exclusive_pointer(), split_index) {}
-		template<typename _TList>
-		TXScopeAsyncACORASectionSplitter(const xsac_obj_xscpptr_t& xsptr, const _TList& section_sizes) : base_class(xsptr->exclusive_pointer(), section_sizes) {}
+				size_t capacity() const { return m_queue.capacity(); }
 
-		TXScopeAsyncACORASectionSplitter(const ac_obj_xscpptr_t& xsptr, size_t split_index) : base_class(xsptr->exclusive_pointer(), split_index) {}
-		template<typename _TList>
-		TXScopeAsyncACORASectionSplitter(const ac_obj_xscpptr_t& xsptr, const _TList& section_sizes) : base_class(xsptr->exclusive_pointer(), section_sizes) {}
+			private:
+				_TQueue m_queue;
+				waiters_t m_send_waiters;
+				waiters_t m_receive_waiters;
+			};
 
-	private:
-		TXScopeAsyncACORASectionSplitter & operator=(const TXScopeAsyncACORASectionSplitter& _Right_cref) = delete;
-		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
-	};
+			template<typename _TQueue>
+			std::shared_ptr<channel_state<_TQueue> > make_channel_state(size_t capacity) {
+				if (1 > capacity) { MSE_THROW(std::invalid_argument("channel capacity must be at least one - make_channel_state()")); }
+				return std::make_shared<channel_state<_TQueue> >(capacity);
+			}
 
-#ifdef MSE_HAS_CXX17
-	/* deduction guide */
-	template <typename _Ty, class _TAccessMutex>
-	TXScopeAsyncACORASectionSplitter(mse::TXScopeFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >, size_t)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
-	template<typename _Ty, class _TAccessMutex, typename _TList>
-	TXScopeAsyncACORASectionSplitter(mse::TXScopeFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >, _TList)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
-	template <typename _Ty, class _TAccessMutex>
-	TXScopeAsyncACORASectionSplitter(mse::TXScopeFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> >, size_t)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
-	template<typename _Ty, class _TAccessMutex, typename _TList>
-	TXScopeAsyncACORASectionSplitter(mse::TXScopeFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> >, _TList)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
-#if !defined(MSE_SCOPEPOINTER_DISABLED)
-	template <typename _Ty, class _TAccessMutex>
-	TXScopeAsyncACORASectionSplitter(mse::TXScopeObjFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >, size_t)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
-	template<typename _Ty, class _TAccessMutex, typename _TList>
-	TXScopeAsyncACORASectionSplitter(mse::TXScopeObjFixedPointer<mse::TXScopeAccessControlledObj<_Ty, _TAccessMutex> >, _TList)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
-	template <typename _Ty, class _TAccessMutex>
-	TXScopeAsyncACORASectionSplitter(mse::TXScopeObjFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> >, size_t)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
-	template<typename _Ty, class _TAccessMutex, typename _TList>
-	TXScopeAsyncACORASectionSplitter(mse::TXScopeObjFixedPointer<mse::TAccessControlledObj<_Ty, _TAccessMutex> >, _TList)->TXScopeAsyncACORASectionSplitter<_Ty, _TAccessMutex>;
-#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
-#endif /* MSE_HAS_CXX17 */
+			template<typename _TQueue>
+			class channel_sender_base {
+			public:
+				typedef typename _TQueue::value_type value_type;
+				typedef channel_state<_TQueue> state_t;
 
+				/* Blocks until there is room in the channel. */
+				void send(const value_type& value) {
+					value_type copy(value);
+					state().send(std::move(copy));
+				}
+				void send(value_type&& value) {
+					state().send(std::move(value));
+				}
+				/* Returns false if the channel is full. (An rvalue argument is only moved from if the send succeeds.) */
+				bool try_send(const value_type& value) {
+					value_type copy(value);
+					return state().try_send(std::move(copy));
+				}
+				bool try_send(value_type&& value) {
+					return state().try_send(std::move(value));
+				}
+				template<class _Rep, class _Period>
+				bool try_send_for(const value_type& value, const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+					return try_send_until(value, std::chrono::steady_clock::now() + _Rel_time);
+				}
+				template<class _Rep, class _Period>
+				bool try_send_for(value_type&& value, const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+					return try_send_until(std::move(value), std::chrono::steady_clock::now() + _Rel_time);
+				}
+				template<class _Clock, class _Duration>
+				bool try_send_until(const value_type& value, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+					value_type copy(value);
+					return state().try_send_until(std::move(copy), _Abs_time);
+				}
+				template<class _Clock, class _Duration>
+				bool try_send_until(value_type&& value, const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+					return state().try_send_until(std::move(value), _Abs_time);
+				}
 
-	namespace mstd {
-		/* thread is currently publicly derived from std::thread for reasons of implementation convenience. Expect that
-		in the future it will not be. */
-		class thread : public std::thread {
-		public:
-			typedef std::thread base_class;
+				size_t capacity() const { return state().capacity(); }
 
-			thread() _NOEXCEPT {}
+			protected:
+				explicit channel_sender_base(const std::shared_ptr<channel_state<_TQueue> >& state_shptr) : m_state_shptr(state_shptr) {}
+				channel_sender_base(const channel_sender_base&) = default;
+				channel_sender_base(channel_sender_base&&) = default;
 
-			template<class _Fn, class... _Args, class = typename std::enable_if<!std::is_same<typename std::decay<_Fn>::type, thread>::value>::type>
-			explicit thread(_Fn&& _Fx, _Args&&... _Ax) : base_class(std::forward<_Fn>(_Fx), std::forward<_Args>(_Ax)...) {
-				s_valid_if_passable(_Ax...); // ensure that the function arguments are of a safely passable type
-				s_valid_if_passable(_Fx);
-			}
+			private:
+				channel_state<_TQueue>& state() const {
+					if (!m_state_shptr) { MSE_THROW(std::logic_error("attempt to use a moved-from channel sender - channel_sender_base")); }
+					return *m_state_shptr;
+				}
 
-			thread(thread&& _Other) _NOEXCEPT : base_class(mse::us::impl::as_ref<base_class>(std::forward<decltype(_Other)>(_Other))) {}
+				std::shared_ptr<channel_state<_TQueue> > m_state_shptr;
+			};
 
-			thread& operator=(thread&& _Other) _NOEXCEPT {
-				base_class::operator=(std::forward<decltype(_Other)>(_Other));
-				return *this;
-			}
+			template<typename _TQueue>
+			class channel_receiver_base {
+			public:
+				typedef typename _TQueue::value_type value_type;
+				typedef channel_state<_TQueue> state_t;
 
-			thread(const thread&) = delete;
-			thread& operator=(const thread&) = delete;
+				/* Blocks until there is a value in the channel. */
+				value_type receive() {
+					return state().receive();
+				}
+				/* Returns an empty optional if the channel is empty. */
+				mse::mstd::optional<value_type> try_receive() {
+					return state().try_receive();
+				}
+				template<class _Rep, class _Period>
+				mse::mstd::optional<value_type> try_receive_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {
+					return try_receive_until(std::chrono::steady_clock::now() + _Rel_time);
+				}
+				template<class _Clock, class _Duration>
+				mse::mstd::optional<value_type> try_receive_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {
+					return state().try_receive_until(_Abs_time);
+				}
 
-			template<class _Ty, class... _Args>
-			static void s_valid_if_passable(const _Ty& arg1, _Args&&... _Ax) {
-				mse::impl::async_passable(arg1);
-				s_valid_if_passable(_Ax...);
-			}
-			static void s_valid_if_passable() {}
-		};
+				size_t capacity() const { return state().capacity(); }
 
-		template<class _Ty> using future = std::future<_Ty>;
+			protected:
+				explicit channel_receiver_base(const std::shared_ptr<channel_state<_TQueue> >& state_shptr) : m_state_shptr(state_shptr) {}
+				channel_receiver_base(const channel_receiver_base&) = default;
+				channel_receiver_base(channel_receiver_base&&) = default;
 
-		template<class _Fty, class... _ArgTypes>
-		inline auto async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) {
-			// ensure that the function arguments are of a safely passable type
-			thread::s_valid_if_passable(_Args...);
-			// ensure that the function return value is of a safely passable type
-			mse::impl::T_valid_if_is_marked_as_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
-			thread::s_valid_if_passable(_Fnarg);
-			return (std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
-		}
+			private:
+				channel_state<_TQueue>& state() const {
+					if (!m_state_shptr) { MSE_THROW(std::logic_error("attempt to use a moved-from channel receiver - channel_receiver_base")); }
+					return *m_state_shptr;
+				}
 
-		template<class _Fty, class... _ArgTypes>
-		inline auto async(_Fty&& _Fnarg, _ArgTypes&&... _Args) {
-			// ensure that the function arguments are of a safely passable type
-			thread::s_valid_if_passable(_Args...);
-			// ensure that the function return value is of a safely passable type
-			mse::impl::T_valid_if_is_marked_as_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
-			return (std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+				std::shared_ptr<channel_state<_TQueue> > m_state_shptr;
+			};
 		}
 	}
 
-	/* xscope_thread is currently publicly derived from std::thread for reasons of implementation convenience. Expect that
-	in the future it will not be. */
-	class xscope_thread : public std::thread, public mse::us::impl::XScopeTagBase {
-	public:
-		typedef std::thread base_class;
-
-		xscope_thread() _NOEXCEPT {}
-
-		template<class _Fn, class... _Args, class = typename std::enable_if<!std::is_same<typename std::decay<_Fn>::type, xscope_thread>::value>::type>
-		explicit xscope_thread(_Fn&& _Fx, _Args&&... _Ax) : base_class(std::forward<_Fn>(_Fx), std::forward<_Args>(_Ax)...) {
-			s_valid_if_xscope_passable(_Ax...); // ensure that the function arguments are of a safely passable type
-			s_valid_if_xscope_passable(_Fx);
-		}
-
-		xscope_thread& operator=(xscope_thread&& _Other) = delete;
+	template<typename _Ty> class TAsyncChannelSender;
+	template<typename _Ty> class TAsyncChannelReceiver;
+	template<typename _Ty> class TAsyncSPSCChannelSender;
+	template<typename _Ty> class TAsyncSPSCChannelReceiver;
+	template<typename _Ty>
+	std::pair<TAsyncChannelSender<_Ty>, TAsyncChannelReceiver<_Ty> > make_async_channel(size_t capacity);
+	template<typename _Ty>
+	std::pair<TAsyncSPSCChannelSender<_Ty>, TAsyncSPSCChannelReceiver<_Ty> > make_async_spsc_channel(size_t capacity);
 
-		xscope_thread(const xscope_thread&) = delete;
-		xscope_thread& operator=(const xscope_thread&) = delete;
+	/* A channel is a bounded (lock-free) queue for passing values between threads. make_async_channel() returns a
+	(sender, receiver) pair of handles to a new channel. The handles can be copied, and passed to other threads, so
+	that any number of threads can send and receive. Only (values of) types that are safely passable to another thread
+	can be sent. */
+	template<typename _Ty>
+	class TAsyncChannelSender : public mse::impl::ns_channel::channel_sender_base<mse::impl::ns_channel::mpmc_queue<_Ty> > {
+	public:
+		typedef mse::impl::ns_channel::channel_sender_base<mse::impl::ns_channel::mpmc_queue<_Ty> > base_class;
 
-		~xscope_thread() {
-			if ((*this).joinable()) {
-				(*this).join();
-			}
+		TAsyncChannelSender(const TAsyncChannelSender&) = default;
+		TAsyncChannelSender(TAsyncChannelSender&&) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncChannelSender() {
+#ifndef MSE_ASYNCSHAREDPOINTER_DISABLED
+			mse::impl::T_valid_if_is_marked_as_passable_msemsearray<_Ty>();
+#endif /*!MSE_ASYNCSHAREDPOINTER_DISABLED*/
 		}
 
-		template<class _Ty, class... _Args>
-		static void s_valid_if_xscope_passable(const _Ty& arg1, _Args&&... _Ax) {
-			mse::impl::xscope_async_passable(arg1);
-			s_valid_if_xscope_passable(_Ax...);
-		}
-		static void s_valid_if_xscope_passable() {}
+		void async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
 
 	private:
-		xscope_thread(xscope_thread&& _Other) _NOEXCEPT : base_class(mse::us::impl::as_ref<base_class>(std::forward<decltype(_Other)>(_Other))) {}
+		explicit TAsyncChannelSender(const std::shared_ptr<typename base_class::state_t>& state_shptr) : base_class(state_shptr) {}
+		TAsyncChannelSender& operator=(const TAsyncChannelSender&) = delete;
 
-		void detach() { base_class::detach(); }
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
-		friend class xscope_thread_carrier;
+		friend std::pair<TAsyncChannelSender<_Ty>, TAsyncChannelReceiver<_Ty> > make_async_channel<_Ty>(size_t capacity);
 	};
 
-	class xscope_thread_carrier : public mse::us::impl::XScopeTagBase {
+	template<typename _Ty>
+	class TAsyncChannelReceiver : public mse::impl::ns_channel::channel_receiver_base<mse::impl::ns_channel::mpmc_queue<_Ty> > {
 	public:
-		typedef size_t handle_t;
+		typedef mse::impl::ns_channel::channel_receiver_base<mse::impl::ns_channel::mpmc_queue<_Ty> > base_class;
 
-		template<class _Fn, class... _Args, class = typename std::enable_if<!std::is_same<typename std::decay<_Fn>::type, xscope_thread>::value>::type>
-		handle_t new_thread(_Fn&& _Fx, _Args&&... _Ax) {
-			m_xscope_thread_map.emplace(m_next_available_handle, xscope_thread(std::forward<_Fn>(_Fx), std::forward<_Args>(_Ax)...));
-			auto retval = m_next_available_handle;
-			m_next_available_handle += 1;
-			return retval;
+		TAsyncChannelReceiver(const TAsyncChannelReceiver&) = default;
+		TAsyncChannelReceiver(TAsyncChannelReceiver&&) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncChannelReceiver() {
+#ifndef MSE_ASYNCSHAREDPOINTER_DISABLED
+			mse::impl::T_valid_if_is_marked_as_passable_msemsearray<_Ty>();
+#endif /*!MSE_ASYNCSHAREDPOINTER_DISABLED*/
 		}
 
-		auto xscope_ptr(const handle_t& handle) -> mse::xscope_optional<mse::TXScopeFixedPointer<xscope_thread> > {
-			auto it = m_xscope_thread_map.find(handle);
-			if (m_xscope_thread_map.end() == it) {
-				return {};
-			}
-			else {
-				return mse::TXScopeFixedPointer<xscope_thread>(mse::us::unsafe_make_xscope_pointer_to((*it).second));
-			}
-		}
-		auto xscope_ptr(const handle_t& handle) const -> mse::xscope_optional<mse::TXScopeFixedConstPointer<xscope_thread> > {
-			auto cit = m_xscope_thread_map.find(handle);
-			if (m_xscope_thread_map.cend() == cit) {
-				return {};
-			}
-			else {
-				return mse::TXScopeFixedConstPointer<xscope_thread>(mse::us::unsafe_make_xscope_const_pointer_to((*cit).second));
-			}
-		}
-		auto xscope_ptr_at(const handle_t& handle) {
-			return mse::us::unsafe_make_xscope_pointer_to(m_xscope_thread_map.at(handle));
-		}
-		auto xscope_ptr_at(const handle_t& handle) const {
-			return mse::us::unsafe_make_xscope_const_pointer_to(m_xscope_thread_map.at(handle));
-		}
+		void async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
 
 	private:
-		class movable_xscope_thread : public xscope_thread {
-		public:
-			movable_xscope_thread(xscope_thread&& _Other) _NOEXCEPT : xscope_thread(std::forward<decltype(_Other)>(_Other)) {}
-			movable_xscope_thread(movable_xscope_thread&& _Other) _NOEXCEPT = default;
-		};
+		explicit TAsyncChannelReceiver(const std::shared_ptr<typename base_class::state_t>& state_shptr) : base_class(state_shptr) {}
+		TAsyncChannelReceiver& operator=(const TAsyncChannelReceiver&) = delete;
 
-		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		handle_t m_next_available_handle = 0;
-		std::map<handle_t, movable_xscope_thread> m_xscope_thread_map;
+		friend std::pair<TAsyncChannelSender<_Ty>, TAsyncChannelReceiver<_Ty> > make_async_channel<_Ty>(size_t capacity);
 	};
 
-	template<class _Ty> class xscope_future;
-	template<class _Fty, class... _ArgTypes> auto xscope_async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
-	template<class _Fty, class... _ArgTypes> auto xscope_async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
-	template<class _Ty> class xscope_future_carrier;
-
-	template<class _Ty>
-	class xscope_future : public std::future<_Ty>, public mse::us::impl::XScopeTagBase {
-	public:
-		typedef std::future<_Ty> base_class;
-
-		xscope_future() _NOEXCEPT {}
-
-		xscope_future& operator=(xscope_future&& _Right) _NOEXCEPT = delete;
-
-		~xscope_future() _NOEXCEPT {
-			if (valid()) {
-				wait();
-			}
-		}
-
-		_Ty get() {
-			return base_class::get();
-		}
-
-		//shared_xscope_future<_Ty> share() _NOEXCEPT {}
+	template<typename _Ty>
+	std::pair<TAsyncChannelSender<_Ty>, TAsyncChannelReceiver<_Ty> > make_async_channel(size_t capacity) {
+		auto state_shptr = mse::impl::ns_channel::make_channel_state<mse::impl::ns_channel::mpmc_queue<_Ty> >(capacity);
+		return std::pair<TAsyncChannelSender<_Ty>, TAsyncChannelReceiver<_Ty> >(TAsyncChannelSender<_Ty>(state_shptr), TAsyncChannelReceiver<_Ty>(state_shptr));
+	}
 
-		xscope_future(const xscope_future&) = delete;
-		xscope_future& operator=(const xscope_future&) = delete;
-	
-		bool valid() const _NOEXCEPT {
-			return base_class::valid();
-		}
+	/* The single-producer/single-consumer version of the channel. It's (somewhat) more efficient, but its sender and
+	receiver can only be moved (not copied), so that only one thread at a time can send and only one can receive. */
+	template<typename _Ty>
+	class TAsyncSPSCChannelSender : public mse::impl::ns_channel::channel_sender_base<mse::impl::ns_channel::spsc_queue<_Ty> > {
+	public:
+		typedef mse::impl::ns_channel::channel_sender_base<mse::impl::ns_channel::spsc_queue<_Ty> > base_class;
 
-		void wait() const {
-			base_class::wait();
+		TAsyncSPSCChannelSender(TAsyncSPSCChannelSender&&) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSPSCChannelSender() {
+#ifndef MSE_ASYNCSHAREDPOINTER_DISABLED
+			mse::impl::T_valid_if_is_marked_as_passable_msemsearray<_Ty>();
+#endif /*!MSE_ASYNCSHAREDPOINTER_DISABLED*/
 		}
 
-		template<class _Rep, class _Per>
-		std::future_status wait_for( const std::chrono::duration<_Rep, _Per>& _Rel_time) const {
-			return base_class::wait_for(_Rel_time);
-		}
+		void async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
 
-		template<class _Clock, class _Dur>
-		std::future_status wait_until(const std::chrono::time_point<_Clock, _Dur>& _Abs_time) const {
-			return base_class::wait_until(_Abs_time);
+	private:
+		explicit TAsyncSPSCChannelSender(const std::shared_ptr<typename base_class::state_t>& state_shptr) : base_class(state_shptr) {}
+		TAsyncSPSCChannelSender(const TAsyncSPSCChannelSender&) = delete;
+		TAsyncSPSCChannelSender& operator=(const TAsyncSPSCChannelSender&) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend std::pair<TAsyncSPSCChannelSender<_Ty>, TAsyncSPSCChannelReceiver<_Ty> > make_async_spsc_channel<_Ty>(size_t capacity);
+	};
+
+	template<typename _Ty>
+	class TAsyncSPSCChannelReceiver : public mse::impl::ns_channel::channel_receiver_base<mse::impl::ns_channel::spsc_queue<_Ty> > {
+	public:
+		typedef mse::impl::ns_channel::channel_receiver_base<mse::impl::ns_channel::spsc_queue<_Ty> > base_class;
+
+		TAsyncSPSCChannelReceiver(TAsyncSPSCChannelReceiver&&) = default;
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAsyncSPSCChannelReceiver() {
+#ifndef MSE_ASYNCSHAREDPOINTER_DISABLED
+			mse::impl::T_valid_if_is_marked_as_passable_msemsearray<_Ty>();
+#endif /*!MSE_ASYNCSHAREDPOINTER_DISABLED*/
 		}
 
-	private:
-		xscope_future(xscope_future&& _Other) _NOEXCEPT : base_class(std::forward<decltype(_Other)>(_Other)) {}
-		xscope_future(base_class&& _Other) _NOEXCEPT : base_class(std::forward<decltype(_Other)>(_Other)) {}
+		void async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
 
-		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+	private:
+		explicit TAsyncSPSCChannelReceiver(const std::shared_ptr<typename base_class::state_t>& state_shptr) : base_class(state_shptr) {}
+		TAsyncSPSCChannelReceiver(const TAsyncSPSCChannelReceiver&) = delete;
+		TAsyncSPSCChannelReceiver& operator=(const TAsyncSPSCChannelReceiver&) = delete;
 
-		template<class _Fty, class... _ArgTypes>
-		friend auto xscope_async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
-		template<class _Fty, class... _ArgTypes>
-		friend auto xscope_async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
-		friend class xscope_future_carrier<_Ty>;
+		friend std::pair<TAsyncSPSCChannelSender<_Ty>, TAsyncSPSCChannelReceiver<_Ty> > make_async_spsc_channel<_Ty>(size_t capacity);
 	};
 
-	template<class _Fty, class... _ArgTypes>
-	auto xscope_async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())> {
-		// ensure that the function arguments are of a safely passable type
-		xscope_thread::s_valid_if_xscope_passable(_Args...);
-		xscope_thread::s_valid_if_xscope_passable(_Fnarg);
-		// ensure that the function return value is of a safely passable type
-		mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
-		typedef decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get()) future_element_t;
-		return xscope_future<future_element_t>(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
-	}
-
-	template<class _Fty, class... _ArgTypes>
-	auto xscope_async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())> {
-		// ensure that the function arguments are of a safely passable type
-		xscope_thread::s_valid_if_xscope_passable(_Args...);
-		// ensure that the function return value is of a safely passable type
-		mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<decltype(_Fnarg(std::forward<_ArgTypes>(_Args)...))>();
-		typedef decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get()) future_element_t;
-		return xscope_future<future_element_t>(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+	template<typename _Ty>
+	std::pair<TAsyncSPSCChannelSender<_Ty>, TAsyncSPSCChannelReceiver<_Ty> > make_async_spsc_channel(size_t capacity) {
+		auto state_shptr = mse::impl::ns_channel::make_channel_state<mse::impl::ns_channel::spsc_queue<_Ty> >(capacity);
+		return std::pair<TAsyncSPSCChannelSender<_Ty>, TAsyncSPSCChannelReceiver<_Ty> >(TAsyncSPSCChannelSender<_Ty>(state_shptr), TAsyncSPSCChannelReceiver<_Ty>(state_shptr));
 	}
 
 	template<class _Ty>
@@ -2905,6 +6014,44 @@ namespace mse {
 			m_next_available_handle += 1;
 			return retval;
 		}
+		/* Executes the function using the given thread pool (rather than a new thread). */
+		template<class _Fty, class... _ArgTypes>
+		handle_t new_future(xscope_thread_pool& pool, _Fty&& _Fnarg, _ArgTypes&&... _Args) {
+			m_xscope_future_map.emplace(m_next_available_handle, pool.xscope_async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...));
+			auto retval = m_next_available_handle;
+			m_next_available_handle += 1;
+			return retval;
+		}
+		/* Adds a future for the return value of the given function, which will be called with the value of the
+		specified future once it is ready (see xscope_future<>::then()). The specified future is consumed, and its
+		handle removed. The function's return value must be convertible to _Ty. */
+		template<class _Fty>
+		handle_t new_future_then(const handle_t& handle, _Fty&& _Fnarg) {
+			auto it = m_xscope_future_map.find(handle);
+			if (m_xscope_future_map.end() == it) {
+				MSE_THROW(std::out_of_range("invalid handle - xscope_future_carrier::new_future_then()"));
+			}
+			m_xscope_future_map.emplace(m_next_available_handle, (*it).second.template then_helper1<_Ty>(std::forward<_Fty>(_Fnarg)));
+			m_xscope_future_map.erase(it);
+			auto retval = m_next_available_handle;
+			m_next_available_handle += 1;
+			return retval;
+		}
+
+		/* Returns an xscope_future that becomes ready once all of the specified futures are ready (see when_all()). */
+		xscope_future<void> when_all(const std::vector<handle_t>& handles) const {
+			auto future_and_completion_state = mse::impl::ns_xscope_future::make_when_all_future(completion_state_shptrs(handles));
+			return xscope_future<void>(std::move(future_and_completion_state.first), std::move(future_and_completion_state.second));
+		}
+		/* Returns an xscope_future for the handle of the first of the specified futures to become ready (see
+		when_any()). */
+		xscope_future<handle_t> when_any(const std::vector<handle_t>& handles) const {
+			if (handles.empty()) {
+				MSE_THROW(std::invalid_argument("no futures specified - xscope_future_carrier::when_any()"));
+			}
+			auto future_and_completion_state = mse::impl::ns_xscope_future::make_when_any_future(completion_state_shptrs(handles), handles);
+			return xscope_future<handle_t>(std::move(future_and_completion_state.first), std::move(future_and_completion_state.second));
+		}
 
 		auto xscope_ptr(const handle_t& handle) {
 			auto it = m_xscope_future_map.find(handle);
@@ -2926,6 +6073,15 @@ namespace mse {
 		}
 
 	private:
+		std::vector<mse::impl::ns_xscope_future::completion_state_shptr_t> completion_state_shptrs(const std::vector<handle_t>& handles) const {
+			std::vector<mse::impl::ns_xscope_future::completion_state_shptr_t> retval;
+			retval.reserve(handles.size());
+			for (const auto& handle : handles) {
+				retval.push_back(m_xscope_future_map.at(handle).checked_completion_state_shptr());
+			}
+			return retval;
+		}
+
 		class movable_xscope_future : public xscope_future<_Ty> {
 		public:
 			movable_xscope_future(xscope_future<_Ty>&& _Other) _NOEXCEPT : xscope_future<_Ty>(std::forward<decltype(_Other)>(_Other)) {}
@@ -2940,6 +6096,545 @@ namespace mse {
 
 
 
+#ifdef MSE_HAS_COROUTINES
+	/* Coroutine tasks. As with the arguments of mstd::thread (or xscope_thread), the parameters of a coroutine returning
+	a TAsyncTask<> (or TXScopeAsyncTask<>) are required to be of a safely passable type, as is its return value. */
+
+	class coroutine_scheduler;
+
+	namespace impl {
+		namespace ns_coroutine {
+			/* A record of the locks held (via co_writelock_ptr() or co_readlock_ptr()) by the tasks of a scheduler. Because
+			the scheduler's tasks all run in the same thread, the (recursive) locks themselves don't exclude each other, so
+			a lock is only granted to a task if no other task holds a conflicting one. (Tasks are identified by the handle
+			of their outermost task.) */
+			class held_lock_registry {
+			public:
+				bool try_register(const void* target_address, void* root_address, bool is_writelock) {
+					for (const auto& record : m_records) {
+						if ((target_address == record.m_target_address) && (root_address != record.m_root_address)
+							&& (is_writelock || record.m_is_writelock)) {
+							return false;
+						}
+					}
+					m_records.push_back(record_t{ target_address, root_address, is_writelock });
+					return true;
+				}
+				void unregister(const void* target_address, void* root_address, bool is_writelock) {
+					for (auto it = m_records.begin(); m_records.end() != it; ++it) {
+						if ((target_address == (*it).m_target_address) && (root_address == (*it).m_root_address)
+							&& (is_writelock == (*it).m_is_writelock)) {
+							m_records.erase(it);
+							return;
+						}
+					}
+				}
+			private:
+				struct record_t {
+					const void* m_target_address;
+					void* m_root_address;
+					bool m_is_writelock;
+				};
+				std::vector<record_t> m_records;
+			};
+
+			/* The interface through which awaiters (re)schedule suspended coroutines. */
+			class scheduler_base {
+			public:
+				virtual ~scheduler_base() {}
+				virtual const std::shared_ptr<held_lock_registry>& held_lock_registry_shptr() const = 0;
+				/* Schedules the coroutine to be resumed. (root_handle is the handle of the outermost task of the chain of
+				tasks awaiting the coroutine.) */
+				virtual void schedule(std::coroutine_handle<> handle, std::coroutine_handle<> root_handle) = 0;
+				/* Schedules the coroutine to be resumed once the given function (called with the given context) returns
+				true. */
+				virtual void schedule_when(std::coroutine_handle<> handle, std::coroutine_handle<> root_handle, bool(*try_function)(void*), void* context) = 0;
+			};
+
+			class promise_base {
+			public:
+				scheduler_base* m_scheduler_ptr = nullptr;
+				std::coroutine_handle<> m_root_handle;
+				/* The coroutine awaiting this one, if any. */
+				std::coroutine_handle<> m_continuation;
+				std::exception_ptr m_exception_ptr;
+			};
+			inline scheduler_base& checked_scheduler(const promise_base& promise) {
+				if (!promise.m_scheduler_ptr) {
+					MSE_THROW(std::logic_error("the coroutine is not being run by a coroutine_scheduler"));
+				}
+				return *(promise.m_scheduler_ptr);
+			}
+
+			template<typename _Ty>
+			class promise_result_base : public promise_base {
+			public:
+				void return_value(_Ty value) {
+					m_maybe_result.emplace(std::move(value));
+				}
+				_Ty result() {
+					if (m_exception_ptr) {
+						std::rethrow_exception(m_exception_ptr);
+					}
+					return std::move(m_maybe_result.value());
+				}
+			private:
+				mse::mstd::optional<_Ty> m_maybe_result;
+			};
+			template<>
+			class promise_result_base<void> : public promise_base {
+			public:
+				void return_void() {}
+				void result() {
+					if (m_exception_ptr) {
+						std::rethrow_exception(m_exception_ptr);
+					}
+				}
+			};
+
+			/* When a task completes, execution transfers to the coroutine awaiting it (if any). */
+			class final_awaiter {
+			public:
+				bool await_ready() const noexcept { return false; }
+				template<typename _TPromise>
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<_TPromise> handle) const noexcept {
+					auto continuation = handle.promise().m_continuation;
+					if (continuation) {
+						return continuation;
+					}
+					return std::noop_coroutine();
+				}
+				void await_resume() const noexcept {}
+			};
+
+			class async_passability_policy {
+			public:
+				template<typename... _TArgs>
+				static void s_valid_if_passable(const _TArgs&... args) {
+					mstd::thread::s_valid_if_passable(args...);
+				}
+				template<typename _TResult>
+				static void s_valid_if_passable_result() {
+					mse::impl::T_valid_if_is_marked_as_passable_msemsearray<_TResult>();
+				}
+			};
+			class xscope_async_passability_policy {
+			public:
+				template<typename... _TArgs>
+				static void s_valid_if_passable(const _TArgs&... args) {
+					xscope_thread::s_valid_if_xscope_passable(args...);
+				}
+				template<typename _TResult>
+				static void s_valid_if_passable_result() {
+					mse::impl::T_valid_if_is_marked_as_xscope_passable_msemsearray<_TResult>();
+				}
+			};
+
+			template<typename _TTask, typename _Ty, typename _TPassabilityPolicy>
+			class task_promise : public promise_result_base<_Ty> {
+			public:
+				/* The coroutine's parameters are passed to the promise's constructor, where we ensure that they are of a
+				safely passable type. */
+				template<typename... _TArgs>
+				task_promise(const _TArgs&... args) {
+					_TPassabilityPolicy::s_valid_if_passable(args...);
+					// ensure that the return value is of a safely passable type
+					_TPassabilityPolicy::template s_valid_if_passable_result<_Ty>();
+				}
+
+				_TTask get_return_object() {
+					return _TTask(std::coroutine_handle<task_promise>::from_promise(*this));
+				}
+				/* Tasks don't start executing until they are awaited, or run by a scheduler. */
+				std::suspend_always initial_suspend() const noexcept { return {}; }
+				final_awaiter final_suspend() const noexcept { return {}; }
+				void unhandled_exception() {
+					this->m_exception_ptr = std::current_exception();
+				}
+			};
+
+			/* Owns the coroutine (frame) of a task. */
+			template<typename _Ty, typename _TPromise>
+			class task_base {
+			public:
+				typedef _TPromise promise_type;
+				typedef std::coroutine_handle<_TPromise> handle_t;
+
+				task_base(task_base&& src) noexcept : m_handle(std::exchange(src.m_handle, nullptr)) {}
+				~task_base() {
+					if (m_handle) {
+						m_handle.destroy();
+					}
+				}
+
+				bool done() const {
+					return m_handle && m_handle.done();
+				}
+
+				class awaiter {
+				public:
+					explicit awaiter(handle_t handle) : m_handle(handle) {}
+					bool await_ready() const noexcept { return m_handle.done(); }
+					/* The awaited task inherits the scheduler of the awaiting coroutine, and is resumed directly (without
+					going through the scheduler). */
+					template<typename _TAwaitingPromise>
+					std::coroutine_handle<> await_suspend(std::coroutine_handle<_TAwaitingPromise> awaiting_handle) noexcept {
+						auto& promise = m_handle.promise();
+						promise.m_continuation = awaiting_handle;
+						promise.m_scheduler_ptr = awaiting_handle.promise().m_scheduler_ptr;
+						promise.m_root_handle = awaiting_handle.promise().m_root_handle;
+						return m_handle;
+					}
+					_Ty await_resume() {
+						return m_handle.promise().result();
+					}
+				private:
+					handle_t m_handle;
+				};
+				/* A task can be awaited (only) once. */
+				awaiter operator co_await() const {
+					return awaiter(checked_unstarted_handle());
+				}
+
+			protected:
+				explicit task_base(handle_t handle) : m_handle(handle) {}
+
+			private:
+				task_base& operator=(const task_base&) = delete;
+
+				handle_t checked_unstarted_handle() const {
+					if ((!m_handle) || m_handle.promise().m_root_handle) {
+						MSE_THROW(std::logic_error("the task is invalid or already started - task"));
+					}
+					return m_handle;
+				}
+
+				handle_t m_handle;
+
+				friend class mse::coroutine_scheduler;
+			};
+		}
+	}
+
+	/* TAsyncTask<> is a (lazily started) coroutine task. A task is started either by being (co_)awaited from another
+	task, or by being run by a coroutine_scheduler. The coroutine's parameters and return value are checked (at
+	compile-time) for passability, as are mstd::thread's arguments. */
+	template<typename _Ty>
+	class TAsyncTask : public mse::impl::ns_coroutine::task_base<_Ty, mse::impl::ns_coroutine::task_promise<TAsyncTask<_Ty>, _Ty, mse::impl::ns_coroutine::async_passability_policy> > {
+	public:
+		typedef mse::impl::ns_coroutine::task_base<_Ty, mse::impl::ns_coroutine::task_promise<TAsyncTask<_Ty>, _Ty, mse::impl::ns_coroutine::async_passability_policy> > base_class;
+
+		TAsyncTask(TAsyncTask&& src) = default;
+
+	private:
+		explicit TAsyncTask(typename base_class::handle_t handle) : base_class(handle) {}
+
+		friend class mse::impl::ns_coroutine::task_promise<TAsyncTask<_Ty>, _Ty, mse::impl::ns_coroutine::async_passability_policy>;
+	};
+
+	/* TXScopeAsyncTask<> is the scope version of TAsyncTask<>. Its parameters and return value are checked for
+	passability, as are xscope_thread's arguments, so they may include (scope passable) scope pointers. A scope task can
+	be awaited, or run by coroutine_scheduler::run_until_complete(), but (unlike TAsyncTask<>) not spawned (i.e. handed
+	over to a scheduler). */
+	template<typename _Ty>
+	class TXScopeAsyncTask : public mse::impl::ns_coroutine::task_base<_Ty, mse::impl::ns_coroutine::task_promise<TXScopeAsyncTask<_Ty>, _Ty, mse::impl::ns_coroutine::xscope_async_passability_policy> >
+		, public mse::us::impl::XScopeTagBase {
+	public:
+		typedef mse::impl::ns_coroutine::task_base<_Ty, mse::impl::ns_coroutine::task_promise<TXScopeAsyncTask<_Ty>, _Ty, mse::impl::ns_coroutine::xscope_async_passability_policy> > base_class;
+
+		TXScopeAsyncTask(TXScopeAsyncTask&& src) = default;
+
+		void xscope_tag() const {}
+
+	private:
+		explicit TXScopeAsyncTask(typename base_class::handle_t handle) : base_class(handle) {}
+
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		friend class mse::impl::ns_coroutine::task_promise<TXScopeAsyncTask<_Ty>, _Ty, mse::impl::ns_coroutine::xscope_async_passability_policy>;
+	};
+
+	namespace impl {
+		namespace ns_coroutine {
+			class rescheduling_awaiter {
+			public:
+				bool await_ready() const noexcept { return false; }
+				template<typename _TPromise>
+				void await_suspend(std::coroutine_handle<_TPromise> handle) const {
+					checked_scheduler(handle.promise()).schedule(handle, handle.promise().m_root_handle);
+				}
+				void await_resume() const noexcept {}
+			};
+
+			class writelock_policy {
+			public:
+				static const bool s_is_writelock = true;
+				template<typename _TAccessRequester>
+				static auto s_try_lock_ptr(const _TAccessRequester& access_requester) {
+					return access_requester.try_writelock_ptr();
+				}
+			};
+			class readlock_policy {
+			public:
+				static const bool s_is_writelock = false;
+				template<typename _TAccessRequester>
+				static auto s_try_lock_ptr(const _TAccessRequester& access_requester) {
+					return access_requester.try_readlock_ptr();
+				}
+			};
+
+			/* The lock pointer obtained by co_writelock_ptr() (or co_readlock_ptr()). It keeps the lock registered (with
+			the scheduler) as held by the task for as long as it (or a copy of it) exists. */
+			template<typename _TLockPtr>
+			class task_lock_ptr : public std::conditional<std::is_base_of<mse::us::impl::XScopeTagBase, _TLockPtr>::value
+				, mse::us::impl::XScopeTagBase, mse::impl::TPlaceHolder<task_lock_ptr<_TLockPtr> > >::type {
+			public:
+				task_lock_ptr(_TLockPtr&& lock_ptr, const std::shared_ptr<held_lock_registry>& registry_shptr, void* root_address, bool is_writelock)
+					: m_lock_ptr(std::move(lock_ptr)), m_registry_shptr(registry_shptr), m_root_address(root_address), m_is_writelock(is_writelock) {}
+				task_lock_ptr(const task_lock_ptr& src) : m_lock_ptr(src.m_lock_ptr), m_registry_shptr(src.m_registry_shptr)
+					, m_root_address(src.m_root_address), m_is_writelock(src.m_is_writelock) {
+					/* The copy is held by the same task, so registering it can't fail. */
+					m_registry_shptr->try_register(target_address(), m_root_address, m_is_writelock);
+				}
+				task_lock_ptr(task_lock_ptr&& src) : m_lock_ptr(std::move(src.m_lock_ptr)), m_registry_shptr(std::move(src.m_registry_shptr))
+					, m_root_address(src.m_root_address), m_is_writelock(src.m_is_writelock) {}
+				~task_lock_ptr() {
+					if (m_registry_shptr) {
+						m_registry_shptr->unregister(target_address(), m_root_address, m_is_writelock);
+					}
+				}
+
+				auto& operator*() const {
+					return *m_lock_ptr;
+				}
+				auto operator->() const {
+					return m_lock_ptr.operator->();
+				}
+
+			private:
+				task_lock_ptr& operator=(const task_lock_ptr&) = delete;
+
+				const void* target_address() const {
+					return std::addressof(*m_lock_ptr);
+				}
+
+				_TLockPtr m_lock_ptr;
+				std::shared_ptr<held_lock_registry> m_registry_shptr;
+				void* m_root_address;
+				bool m_is_writelock;
+
+				MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+			};
+
+			/* If the lock isn't immediately available (or is held by another task of the scheduler), the awaiting
+			coroutine is suspended, and the scheduler retries obtaining the lock when it has no (other) coroutines ready to
+			run. */
+			template<typename _TAccessRequester, typename _TLockPolicy>
+			class lock_ptr_awaiter {
+			public:
+				/* (An mstd::optional<>, or, for scope access requesters, an xscope_optional<>, of the lock pointer.) */
+				typedef decltype(_TLockPolicy::s_try_lock_ptr(std::declval<const _TAccessRequester&>())) maybe_lock_ptr_t;
+				typedef typename std::remove_reference<decltype(std::declval<maybe_lock_ptr_t&>().value())>::type lock_ptr_t;
+
+				explicit lock_ptr_awaiter(const _TAccessRequester& access_requester) : m_access_requester(access_requester) {}
+
+				/* (Whether the lock is available to the task depends on which task it is, so the attempt is made in
+				await_suspend().) */
+				bool await_ready() const noexcept { return false; }
+				template<typename _TPromise>
+				bool await_suspend(std::coroutine_handle<_TPromise> handle) {
+					auto& scheduler = checked_scheduler(handle.promise());
+					m_registry_shptr = scheduler.held_lock_registry_shptr();
+					m_root_address = handle.promise().m_root_handle.address();
+					if (try_lock_ptr()) {
+						return false;
+					}
+					scheduler.schedule_when(handle, handle.promise().m_root_handle, s_try_lock_ptr, this);
+					return true;
+				}
+				task_lock_ptr<lock_ptr_t> await_resume() {
+					return task_lock_ptr<lock_ptr_t>(std::move(m_maybe_lock_ptr.value()), m_registry_shptr, m_root_address, _TLockPolicy::s_is_writelock);
+				}
+
+			private:
+				bool try_lock_ptr() {
+					auto maybe_lock_ptr = _TLockPolicy::s_try_lock_ptr(m_access_requester);
+					if (!maybe_lock_ptr.has_value()) {
+						return false;
+					}
+					/* The lock is released (when maybe_lock_ptr is destroyed) if another task holds a conflicting one. */
+					if (!m_registry_shptr->try_register(std::addressof(*(maybe_lock_ptr.value())), m_root_address, _TLockPolicy::s_is_writelock)) {
+						return false;
+					}
+					m_maybe_lock_ptr.emplace(std::move(maybe_lock_ptr.value()));
+					return true;
+				}
+				static bool s_try_lock_ptr(void* context) {
+					return static_cast<lock_ptr_awaiter*>(context)->try_lock_ptr();
+				}
+
+				_TAccessRequester m_access_requester;
+				std::shared_ptr<held_lock_registry> m_registry_shptr;
+				void* m_root_address = nullptr;
+				maybe_lock_ptr_t m_maybe_lock_ptr;
+			};
+		}
+	}
+
+	/* Within a task, "co_await co_reschedule();" suspends the task, allowing the scheduler to run other tasks before
+	resuming it. */
+	inline auto co_reschedule() {
+		return mse::impl::ns_coroutine::rescheduling_awaiter();
+	}
+	/* Within a task, "co_await co_writelock_ptr(access_requester)" obtains a writelock_ptr from the access requester,
+	suspending (rather than blocking) the task while the lock is unavailable. Although the tasks of a scheduler run in
+	the same thread, the scheduler keeps track of which task holds which lock, so (unlike the recursive locks of a
+	thread) lock pointers obtained this way by different tasks exclude each other. (Lock pointers held by the same task,
+	including any tasks it awaits, do not.) */
+	template<typename _TAccessRequester>
+	auto co_writelock_ptr(const _TAccessRequester& access_requester) {
+		return mse::impl::ns_coroutine::lock_ptr_awaiter<_TAccessRequester, mse::impl::ns_coroutine::writelock_policy>(access_requester);
+	}
+	template<typename _TAccessRequester>
+	auto co_readlock_ptr(const _TAccessRequester& access_requester) {
+		return mse::impl::ns_coroutine::lock_ptr_awaiter<_TAccessRequester, mse::impl::ns_coroutine::readlock_policy>(access_requester);
+	}
+
+	/* coroutine_scheduler is a lightweight, single-threaded scheduler that runs tasks (in the calling thread) when
+	run() or run_until_complete() is called. Tasks suspended waiting for a lock are resumed once the lock is obtained. */
+	class coroutine_scheduler : private mse::impl::ns_coroutine::scheduler_base {
+	public:
+		coroutine_scheduler() : m_held_lock_registry_shptr(std::make_shared<mse::impl::ns_coroutine::held_lock_registry>()) {}
+		coroutine_scheduler(const coroutine_scheduler&) = delete;
+		coroutine_scheduler& operator=(const coroutine_scheduler&) = delete;
+
+		/* Takes ownership of the task and schedules it to be run (by run() or run_until_complete()). The task's return
+		value is discarded, but an exception it exits with is rethrown by run() (or run_until_complete()). */
+		template<typename _Ty>
+		void spawn(TAsyncTask<_Ty>&& task) {
+			const auto handle = task.checked_unstarted_handle();
+			m_spawned_task_map.emplace(handle.address(), std::unique_ptr<spawned_task_base>(new spawned_task<_Ty>(std::move(task))));
+			start(handle);
+		}
+
+		/* Runs the scheduled tasks until they have all completed. */
+		void run() {
+			while (run_one_step()) {}
+		}
+
+		/* Starts the given task (which must not already be started) and runs the scheduled tasks until it has
+		completed. Returns the task's return value (or rethrows the exception it exited with). */
+		template<typename _Ty, typename _TPromise>
+		_Ty run_until_complete(mse::impl::ns_coroutine::task_base<_Ty, _TPromise>& task) {
+			const auto handle = task.checked_unstarted_handle();
+			start(handle);
+			while (!handle.done()) {
+				if (!run_one_step()) {
+					MSE_THROW(std::logic_error("the task can not be completed - coroutine_scheduler::run_until_complete()"));
+				}
+			}
+			return handle.promise().result();
+		}
+
+	private:
+		class spawned_task_base {
+		public:
+			virtual ~spawned_task_base() {}
+			virtual std::exception_ptr exception_ptr() const = 0;
+		};
+		template<typename _Ty>
+		class spawned_task : public spawned_task_base {
+		public:
+			explicit spawned_task(TAsyncTask<_Ty>&& task) : m_task(std::move(task)) {}
+			std::exception_ptr exception_ptr() const override {
+				return m_task.m_handle.promise().m_exception_ptr;
+			}
+		private:
+			TAsyncTask<_Ty> m_task;
+		};
+
+		struct entry_t {
+			std::coroutine_handle<> m_handle;
+			std::coroutine_handle<> m_root_handle;
+		};
+		struct waiting_entry_t {
+			entry_t m_entry;
+			bool(*m_try_function)(void*);
+			void* m_context;
+		};
+
+		template<typename _TPromise>
+		void start(std::coroutine_handle<_TPromise> handle) {
+			handle.promise().m_scheduler_ptr = this;
+			handle.promise().m_root_handle = handle;
+			schedule(handle, handle);
+		}
+
+		const std::shared_ptr<mse::impl::ns_coroutine::held_lock_registry>& held_lock_registry_shptr() const override {
+			return m_held_lock_registry_shptr;
+		}
+		void schedule(std::coroutine_handle<> handle, std::coroutine_handle<> root_handle) override {
+			m_ready_entries.push_back(entry_t{ handle, root_handle });
+		}
+		void schedule_when(std::coroutine_handle<> handle, std::coroutine_handle<> root_handle, bool(*try_function)(void*), void* context) override {
+			m_waiting_entries.push_back(waiting_entry_t{ entry_t{ handle, root_handle }, try_function, context });
+		}
+
+		/* Returns false if there are no scheduled tasks. */
+		bool run_one_step() {
+			if (!m_ready_entries.empty()) {
+				const auto entry = m_ready_entries.front();
+				m_ready_entries.pop_front();
+				m_spin_count = 0;
+				entry.m_handle.resume();
+				if (entry.m_root_handle.done()) {
+					on_root_task_done(entry.m_root_handle);
+				}
+				return true;
+			}
+			if (m_waiting_entries.empty()) {
+				return false;
+			}
+			/* None of the tasks are ready to run, so we check whether any of the ones waiting (for a lock) can proceed. */
+			bool a_waiting_task_can_proceed = false;
+			for (auto it = m_waiting_entries.begin(); m_waiting_entries.end() != it;) {
+				if ((*it).m_try_function((*it).m_context)) {
+					m_ready_entries.push_back((*it).m_entry);
+					it = m_waiting_entries.erase(it);
+					a_waiting_task_can_proceed = true;
+				}
+				else {
+					++it;
+				}
+			}
+			if (!a_waiting_task_can_proceed) {
+				/* The locks are presumably held by other threads. */
+				mse::impl::ns_access_mutex::spin_pause(m_spin_count);
+			}
+			return true;
+		}
+
+		void on_root_task_done(std::coroutine_handle<> root_handle) {
+			auto it = m_spawned_task_map.find(root_handle.address());
+			if (m_spawned_task_map.end() != it) {
+				const auto spawned_task_uqptr = std::move((*it).second);
+				m_spawned_task_map.erase(it);
+				const auto exception_ptr = spawned_task_uqptr->exception_ptr();
+				if (exception_ptr) {
+					std::rethrow_exception(exception_ptr);
+				}
+			}
+		}
+
+		std::deque<entry_t> m_ready_entries;
+		std::vector<waiting_entry_t> m_waiting_entries;
+		int m_spin_count = 0;
+		std::unordered_map<void*, std::unique_ptr<spawned_task_base> > m_spawned_task_map;
+		std::shared_ptr<mse::impl::ns_coroutine::held_lock_registry> m_held_lock_registry_shptr;
+	};
+#endif /*MSE_HAS_COROUTINES*/
+
+
 	/*** start of deprecated ***/
 
 #ifdef _MSC_VER
@@ -3872,6 +7567,26 @@ namespace mse {
 	*/
 }
 
+#ifdef MSE_HAS_COROUTINES
+namespace std {
+	/* A (lazily started) task may outlive the objects its caller passed by reference, so (as with mstd::thread, which
+	stores decayed copies of its arguments) the parameters of task coroutines must be passed by value. (Note that this
+	also excludes non-static member functions, whose implicit object parameter is a reference.) */
+	template<typename _Ty, typename... _TArgs>
+	struct coroutine_traits<mse::TAsyncTask<_Ty>, _TArgs...> {
+		static_assert(mse::impl::conjunction<mse::impl::negation<std::is_reference<_TArgs> >...>::value
+			, "The parameters of a TAsyncTask<> coroutine must be passed by value.");
+		typedef typename mse::TAsyncTask<_Ty>::promise_type promise_type;
+	};
+	template<typename _Ty, typename... _TArgs>
+	struct coroutine_traits<mse::TXScopeAsyncTask<_Ty>, _TArgs...> {
+		static_assert(mse::impl::conjunction<mse::impl::negation<std::is_reference<_TArgs> >...>::value
+			, "The parameters of a TXScopeAsyncTask<> coroutine must be passed by value.");
+		typedef typename mse::TXScopeAsyncTask<_Ty>::promise_type promise_type;
+	};
+}
+#endif /*MSE_HAS_COROUTINES*/
+
 #ifndef MSE_PUSH_MACRO_NOT_SUPPORTED
 #pragma pop_macro("MSE_THROW")
 #pragma pop_macro("_STD")
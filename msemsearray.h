@@ -679,17 +679,17 @@ namespace mse {
 
 				/* some construction helper functions and types */
 				template<class _TRAIterator>
-				static _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::true_type, const _TRAIterator& src) { return _TRAContainerPointerRR(src.target_container_ptr()); }
+				static MSE_CONSTEXPR20 _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::true_type, const _TRAIterator& src) { return _TRAContainerPointerRR(src.target_container_ptr()); }
 				template<class _TRAIterator>
-				static _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::true_type, _TRAIterator&& src) { return _TRAContainerPointerRR(std::forward< _TRAIterator>(src).target_container_ptr()); }
+				static MSE_CONSTEXPR20 _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::true_type, _TRAIterator&& src) { return _TRAContainerPointerRR(std::forward< _TRAIterator>(src).target_container_ptr()); }
 				template<class _Ty2>
-				static _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::false_type, const _Ty2& param) { return _TRAContainerPointerRR(param); }
+				static MSE_CONSTEXPR20 _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::false_type, const _Ty2& param) { return _TRAContainerPointerRR(param); }
 				template<class _Ty2>
-				static _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::false_type, _Ty2&& param) { return _TRAContainerPointerRR(std::forward<_Ty2>(param)); }
+				static MSE_CONSTEXPR20 _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::false_type, _Ty2&& param) { return _TRAContainerPointerRR(std::forward<_Ty2>(param)); }
 				template<class _TRAIterator>
-				static auto index_from_lone_param(std::true_type, const _TRAIterator& src) { return src.position(); }
+				static MSE_CONSTEXPR20 auto index_from_lone_param(std::true_type, const _TRAIterator& src) { return src.position(); }
 				template<class _Ty2>
-				static difference_type index_from_lone_param(std::false_type, const _Ty2& param) { return 0; }
+				static MSE_CONSTEXPR20 difference_type index_from_lone_param(std::false_type, const _Ty2& /*param*/) { return 0; }
 
 				template<class T, class EqualTo>
 				struct lone_param_seems_valid_impl
@@ -710,89 +710,89 @@ namespace mse {
 
 			public:
 				template<class _Ty2 = _TRAContainerPointerRR, class = typename std::enable_if<(std::is_same<_Ty2, _TRAContainerPointerRR>::value) && (std::is_default_constructible<_Ty2>::value), void>::type>
-				TRAIteratorBase() {}
+				MSE_CONSTEXPR20 TRAIteratorBase() {}
 
-				TRAIteratorBase(const TRAIteratorBase& src) = default;
-				TRAIteratorBase(TRAIteratorBase&& src) = default;
+				MSE_CONSTEXPR20 TRAIteratorBase(const TRAIteratorBase& src) = default;
+				MSE_CONSTEXPR20 TRAIteratorBase(TRAIteratorBase&& src) = default;
 				//TRAIteratorBase(const _TRAContainerPointerRR& ra_container_pointer, size_type index = 0) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(ra_container_pointer) {}
 				//TRAIteratorBase(_TRAContainerPointerRR&& ra_container_pointer, size_type index = 0) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(std::forward<decltype(ra_container_pointer)>(ra_container_pointer)) {}
 
 				template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2, _TRAContainerPointerRR>::value, void>::type>
-				TRAIteratorBase(us::impl::TRAIteratorBase<_Ty2>&& src) : m_index(src.position()), m_ra_container_pointer(std::forward<decltype(src)>(src).target_container_ptr()) {}
+				MSE_CONSTEXPR20 TRAIteratorBase(us::impl::TRAIteratorBase<_Ty2>&& src) : m_index(src.position()), m_ra_container_pointer(std::forward<decltype(src)>(src).target_container_ptr()) {}
 				template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2, _TRAContainerPointerRR>::value, void>::type>
-				TRAIteratorBase(const us::impl::TRAIteratorBase<_Ty2>& src) : m_index(src.position()), m_ra_container_pointer(src.target_container_ptr()) {}
+				MSE_CONSTEXPR20 TRAIteratorBase(const us::impl::TRAIteratorBase<_Ty2>& src) : m_index(src.position()), m_ra_container_pointer(src.target_container_ptr()) {}
 
 				template<class _TRAContainerPointerRR2>
-				TRAIteratorBase(const _TRAContainerPointerRR2& param, size_type index) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(param) {}
+				MSE_CONSTEXPR20 TRAIteratorBase(const _TRAContainerPointerRR2& param, size_type index) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(param) {}
 				template<class _TRAContainerPointerRR2>
-				TRAIteratorBase(_TRAContainerPointerRR2&& param, size_type index) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(std::forward<_TRAContainerPointerRR2>(param)) {}
+				MSE_CONSTEXPR20 TRAIteratorBase(_TRAContainerPointerRR2&& param, size_type index) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(std::forward<_TRAContainerPointerRR2>(param)) {}
 
 				template<class _TLoneParam, class = typename std::enable_if<lone_param_seems_valid<_TLoneParam>::value, void>::type>
-				TRAIteratorBase(const _TLoneParam& param) : m_index(index_from_lone_param(typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param))
+				MSE_CONSTEXPR20 TRAIteratorBase(const _TLoneParam& param) : m_index(index_from_lone_param(typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param))
 					, m_ra_container_pointer(ra_container_pointer_from_lone_param(
 					typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param)) {}
 				template<class _TLoneParam, class = typename std::enable_if<lone_param_seems_valid<_TLoneParam>::value
 					&& (!std::is_base_of<TRAIteratorBase, _TLoneParam>::value), void>::type>
-				TRAIteratorBase(_TLoneParam&& param) : m_index(index_from_lone_param(typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param))
+				MSE_CONSTEXPR20 TRAIteratorBase(_TLoneParam&& param) : m_index(index_from_lone_param(typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param))
 					, m_ra_container_pointer(ra_container_pointer_from_lone_param(
 					typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), std::forward<_TLoneParam>(param))) {}
 
-				auto operator*() const -> reference {
+				MSE_CONSTEXPR20 auto operator*() const -> reference {
 					return (*m_ra_container_pointer)[m_index];
 				}
-				auto operator->() const -> typename std::add_pointer<value_type>::type {
+				MSE_CONSTEXPR20 auto operator->() const -> typename std::add_pointer<value_type>::type {
 					return std::addressof((*m_ra_container_pointer)[m_index]);
 				}
-				reference operator[](difference_type _Off) const { return (*m_ra_container_pointer)[m_index + _Off]; }
-				TRAIteratorBase& operator +=(difference_type x) {
+				MSE_CONSTEXPR20 reference operator[](difference_type _Off) const { return (*m_ra_container_pointer)[m_index + _Off]; }
+				MSE_CONSTEXPR20 TRAIteratorBase& operator +=(difference_type x) {
 					m_index += (x);
 					return (*this);
 				}
-				TRAIteratorBase& operator -=(difference_type x) { operator +=(-x); return (*this); }
-				TRAIteratorBase& operator ++() { operator +=(1); return (*this); }
-				TRAIteratorBase operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
-				TRAIteratorBase& operator --() { operator -=(1); return (*this); }
-				TRAIteratorBase operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
+				MSE_CONSTEXPR20 TRAIteratorBase& operator -=(difference_type x) { operator +=(-x); return (*this); }
+				MSE_CONSTEXPR20 TRAIteratorBase& operator ++() { operator +=(1); return (*this); }
+				MSE_CONSTEXPR20 TRAIteratorBase operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
+				MSE_CONSTEXPR20 TRAIteratorBase& operator --() { operator -=(1); return (*this); }
+				MSE_CONSTEXPR20 TRAIteratorBase operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
 
-				TRAIteratorBase operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
-				TRAIteratorBase operator-(difference_type n) const { return ((*this) + (-n)); }
-				difference_type operator-(const TRAIteratorBase& _Right_cref) const {
+				MSE_CONSTEXPR20 TRAIteratorBase operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
+				MSE_CONSTEXPR20 TRAIteratorBase operator-(difference_type n) const { return ((*this) + (-n)); }
+				MSE_CONSTEXPR20 difference_type operator-(const TRAIteratorBase& _Right_cref) const {
 					if (!(_Right_cref.m_ra_container_pointer == m_ra_container_pointer)) { MSE_THROW(msearray_range_error("invalid argument - difference_type operator-() - TRAIteratorBase")); }
 					return m_index - _Right_cref.m_index;
 				}
-				bool operator ==(const TRAIteratorBase& _Right_cref) const {
+				MSE_CONSTEXPR20 bool operator ==(const TRAIteratorBase& _Right_cref) const {
 					if (!(_Right_cref.m_ra_container_pointer == m_ra_container_pointer)) { MSE_THROW(msearray_range_error("invalid argument - difference_type operator==() - TRAIteratorBase")); }
 					return (_Right_cref.m_index == m_index);
 				}
-				bool operator !=(const TRAIteratorBase& _Right_cref) const { return !((*this) == _Right_cref); }
-				bool operator<(const TRAIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
-				bool operator>(const TRAIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
-				bool operator<=(const TRAIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
-				bool operator>=(const TRAIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator !=(const TRAIteratorBase& _Right_cref) const { return !((*this) == _Right_cref); }
+				MSE_CONSTEXPR20 bool operator<(const TRAIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator>(const TRAIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator<=(const TRAIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator>=(const TRAIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
 
-				TRAIteratorBase& operator=(const TRAIteratorBase& _Right_cref) {
+				MSE_CONSTEXPR20 TRAIteratorBase& operator=(const TRAIteratorBase& _Right_cref) {
 					assignment_helper1(typename mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_TRAContainerPointerRR>::type(), _Right_cref);
 					return (*this);
 				}
-				TRAIteratorBase& operator=(TRAIteratorBase&& _Right_cref) {
+				MSE_CONSTEXPR20 TRAIteratorBase& operator=(TRAIteratorBase&& _Right_cref) {
 					assignment_helper1(typename mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_TRAContainerPointerRR>::type(), std::forward<decltype(_Right_cref)>(_Right_cref));
 					return (*this);
 				}
 				/* This assignment operator accepts iterators of different types (but pointing to the same container) and
 				attempts to obtain (and adopt) the given iterator's index position. */
 				template<typename _Ty2, class = typename std::enable_if<(!std::is_convertible<_Ty2, TRAIteratorBase>::value) && (mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_Ty2>::value), void>::type>
-				TRAIteratorBase& operator=(const _Ty2& _Right_cref) {
+				MSE_CONSTEXPR20 TRAIteratorBase& operator=(const _Ty2& _Right_cref) {
 					assignment_helper1(std::false_type(), _Right_cref);
 					return (*this);
 				}
 
-				void set_to_beginning() {
+				MSE_CONSTEXPR20 void set_to_beginning() {
 					m_index = 0;
 				}
-				difference_type position() const {
+				MSE_CONSTEXPR20 difference_type position() const {
 					return m_index;
 				}
-				_TRAContainerPointerRR target_container_ptr() const {
+				MSE_CONSTEXPR20 _TRAContainerPointerRR target_container_ptr() const {
 					return m_ra_container_pointer;
 				}
 
@@ -801,18 +801,18 @@ namespace mse {
 			private:
 				template<class _Ty2 = _TRAContainerPointerRR, class = typename std::enable_if<(std::is_same<_Ty2, _TRAContainerPointerRR>::value)
 					&& (mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_Ty2>::value), void>::type>
-				void assignment_helper1(std::true_type, const TRAIteratorBase& _Right_cref) {
+				MSE_CONSTEXPR20 void assignment_helper1(std::true_type, const TRAIteratorBase& _Right_cref) {
 					((*this).m_ra_container_pointer) = _Right_cref.target_container_ptr();
 					(*this).m_index = _Right_cref.position();
 				}
 				template<class _Ty2 = _TRAContainerPointerRR, class = typename std::enable_if<(std::is_same<_Ty2, _TRAContainerPointerRR>::value)
 					&& (mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_Ty2>::value), void>::type>
-				void assignment_helper1(std::true_type, TRAIteratorBase&& _Right_cref) {
+				MSE_CONSTEXPR20 void assignment_helper1(std::true_type, TRAIteratorBase&& _Right_cref) {
 					(*this).m_index = _Right_cref.m_index;
 					((*this).m_ra_container_pointer) = std::forward<decltype(_Right_cref)>(_Right_cref).m_ra_container_pointer;
 				}
 				template<typename _Ty2>
-				void assignment_helper1(std::false_type, const _Ty2& _Right_cref) {
+				MSE_CONSTEXPR20 void assignment_helper1(std::false_type, const _Ty2& _Right_cref) {
 					if (((*this).m_ra_container_pointer) && (_Right_cref.target_container_ptr())) {
 						const auto& this_m_ra_container_pointer_lvaluecref = *((*this).m_ra_container_pointer);
 						const auto& Right_m_ra_container_pointer_lvaluecref = *(_Right_cref.target_container_ptr());
@@ -841,27 +841,27 @@ namespace mse {
 
 		MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TXScopeRAIterator, base_class);
 
-		TXScopeRAIterator& operator +=(difference_type x) {
+		MSE_CONSTEXPR20 TXScopeRAIterator& operator +=(difference_type x) {
 			base_class::operator +=(x);
 			return (*this);
 		}
-		TXScopeRAIterator& operator -=(difference_type x) { operator +=(-x); return (*this); }
-		TXScopeRAIterator& operator ++() { operator +=(1); return (*this); }
-		TXScopeRAIterator operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
-		TXScopeRAIterator& operator --() { operator -=(1); return (*this); }
-		TXScopeRAIterator operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
+		MSE_CONSTEXPR20 TXScopeRAIterator& operator -=(difference_type x) { operator +=(-x); return (*this); }
+		MSE_CONSTEXPR20 TXScopeRAIterator& operator ++() { operator +=(1); return (*this); }
+		MSE_CONSTEXPR20 TXScopeRAIterator operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
+		MSE_CONSTEXPR20 TXScopeRAIterator& operator --() { operator -=(1); return (*this); }
+		MSE_CONSTEXPR20 TXScopeRAIterator operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
 
-		TXScopeRAIterator operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
-		TXScopeRAIterator operator-(difference_type n) const { return ((*this) + (-n)); }
-		difference_type operator-(const base_class& _Right_cref) const {
+		MSE_CONSTEXPR20 TXScopeRAIterator operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
+		MSE_CONSTEXPR20 TXScopeRAIterator operator-(difference_type n) const { return ((*this) + (-n)); }
+		MSE_CONSTEXPR20 difference_type operator-(const base_class& _Right_cref) const {
 			return base_class::operator-(_Right_cref);
 		}
 
-		TXScopeRAIterator& operator=(const TXScopeRAIterator& _Right_cref) {
+		MSE_CONSTEXPR20 TXScopeRAIterator& operator=(const TXScopeRAIterator& _Right_cref) {
 			base_class::operator=(_Right_cref);
 			return (*this);
 		}
-		TXScopeRAIterator& operator=(TXScopeRAIterator&& _Right_cref) {
+		MSE_CONSTEXPR20 TXScopeRAIterator& operator=(TXScopeRAIterator&& _Right_cref) {
 			base_class::operator=(std::forward<decltype(_Right_cref)>(_Right_cref));
 			return (*this);
 		}
@@ -961,17 +961,17 @@ namespace mse {
 
 				/* some construction helper functions and types */
 				template<class _TRAIterator>
-				static _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::true_type, const _TRAIterator& src) { return _TRAContainerPointerRR(src.target_container_ptr()); }
+				static MSE_CONSTEXPR20 _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::true_type, const _TRAIterator& src) { return _TRAContainerPointerRR(src.target_container_ptr()); }
 				template<class _TRAIterator>
-				static _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::true_type, _TRAIterator&& src) { return _TRAContainerPointerRR(std::forward< _TRAIterator>(src).target_container_ptr()); }
+				static MSE_CONSTEXPR20 _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::true_type, _TRAIterator&& src) { return _TRAContainerPointerRR(std::forward< _TRAIterator>(src).target_container_ptr()); }
 				template<class _Ty2>
-				static _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::false_type, const _Ty2& param) { return _TRAContainerPointerRR(param); }
+				static MSE_CONSTEXPR20 _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::false_type, const _Ty2& param) { return _TRAContainerPointerRR(param); }
 				template<class _Ty2>
-				static _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::false_type, _Ty2&& param) { return _TRAContainerPointerRR(std::forward<_Ty2>(param)); }
+				static MSE_CONSTEXPR20 _TRAContainerPointerRR ra_container_pointer_from_lone_param(std::false_type, _Ty2&& param) { return _TRAContainerPointerRR(std::forward<_Ty2>(param)); }
 				template<class _TRAIterator>
-				static auto index_from_lone_param(std::true_type, const _TRAIterator& src) { return src.position(); }
+				static MSE_CONSTEXPR20 auto index_from_lone_param(std::true_type, const _TRAIterator& src) { return src.position(); }
 				template<class _Ty2>
-				static difference_type index_from_lone_param(std::false_type, const _Ty2& param) { return 0; }
+				static MSE_CONSTEXPR20 difference_type index_from_lone_param(std::false_type, const _Ty2& /*param*/) { return 0; }
 
 				template<class T, class EqualTo>
 				struct lone_param_seems_valid_impl
@@ -992,114 +992,114 @@ namespace mse {
 
 			public:
 				template<class _Ty2 = _TRAContainerPointerRR, class = typename std::enable_if<(std::is_same<_Ty2, _TRAContainerPointerRR>::value) && (std::is_default_constructible<_Ty2>::value), void>::type>
-				TRAConstIteratorBase() {}
+				MSE_CONSTEXPR20 TRAConstIteratorBase() {}
 
-				TRAConstIteratorBase(const TRAConstIteratorBase& src) = default;
-				TRAConstIteratorBase(TRAConstIteratorBase&& src) = default;
-				TRAConstIteratorBase(const TRAIteratorBase<_TRAContainerPointerRR>& src) : m_index(src.m_index), m_ra_container_pointer(src.m_ra_container_pointer) {}
-				TRAConstIteratorBase(const TRAIteratorBase<_TRAContainerPointerRR>&& src) : m_index(src.m_index), m_ra_container_pointer(std::forward<decltype(src)>(src).m_ra_container_pointer) {}
+				MSE_CONSTEXPR20 TRAConstIteratorBase(const TRAConstIteratorBase& src) = default;
+				MSE_CONSTEXPR20 TRAConstIteratorBase(TRAConstIteratorBase&& src) = default;
+				MSE_CONSTEXPR20 TRAConstIteratorBase(const TRAIteratorBase<_TRAContainerPointerRR>& src) : m_index(src.m_index), m_ra_container_pointer(src.m_ra_container_pointer) {}
+				MSE_CONSTEXPR20 TRAConstIteratorBase(const TRAIteratorBase<_TRAContainerPointerRR>&& src) : m_index(src.m_index), m_ra_container_pointer(std::forward<decltype(src)>(src).m_ra_container_pointer) {}
 				//TRAConstIteratorBase(const _TRAContainerPointerRR& ra_container_pointer, size_type index = 0) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(ra_container_pointer) {}
 				//TRAConstIteratorBase(_TRAContainerPointerRR&& ra_container_pointer, size_type index = 0) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(std::forward<decltype(ra_container_pointer)>(ra_container_pointer)) {}
 
 				template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2, _TRAContainerPointerRR>::value, void>::type>
-				TRAConstIteratorBase(us::impl::TRAConstIteratorBase<_Ty2>&& src) : m_index(src.position()), m_ra_container_pointer(std::forward<decltype(src)>(src).target_container_ptr()) {}
+				MSE_CONSTEXPR20 TRAConstIteratorBase(us::impl::TRAConstIteratorBase<_Ty2>&& src) : m_index(src.position()), m_ra_container_pointer(std::forward<decltype(src)>(src).target_container_ptr()) {}
 				template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2, _TRAContainerPointerRR>::value, void>::type>
-				TRAConstIteratorBase(const us::impl::TRAConstIteratorBase<_Ty2>& src) : m_index(src.position()), m_ra_container_pointer(src.target_container_ptr()) {}
+				MSE_CONSTEXPR20 TRAConstIteratorBase(const us::impl::TRAConstIteratorBase<_Ty2>& src) : m_index(src.position()), m_ra_container_pointer(src.target_container_ptr()) {}
 
 				template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2, _TRAContainerPointerRR>::value, void>::type>
-				TRAConstIteratorBase(us::impl::TRAIteratorBase<_Ty2>&& src) : m_index(src.position()), m_ra_container_pointer(std::forward<decltype(src)>(src).target_container_ptr()) {}
+				MSE_CONSTEXPR20 TRAConstIteratorBase(us::impl::TRAIteratorBase<_Ty2>&& src) : m_index(src.position()), m_ra_container_pointer(std::forward<decltype(src)>(src).target_container_ptr()) {}
 				template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2, _TRAContainerPointerRR>::value, void>::type>
-				TRAConstIteratorBase(const us::impl::TRAIteratorBase<_Ty2>& src) : m_index(src.position()), m_ra_container_pointer(src.target_container_ptr()) {}
+				MSE_CONSTEXPR20 TRAConstIteratorBase(const us::impl::TRAIteratorBase<_Ty2>& src) : m_index(src.position()), m_ra_container_pointer(src.target_container_ptr()) {}
 
 				template<class _TRAContainerPointerRR2>
-				TRAConstIteratorBase(const _TRAContainerPointerRR2& param, size_type index) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(param) {}
+				MSE_CONSTEXPR20 TRAConstIteratorBase(const _TRAContainerPointerRR2& param, size_type index) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(param) {}
 				template<class _TRAContainerPointerRR2>
-				TRAConstIteratorBase(_TRAContainerPointerRR2&& param, size_type index) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(std::forward<_TRAContainerPointerRR2>(param)) {}
+				MSE_CONSTEXPR20 TRAConstIteratorBase(_TRAContainerPointerRR2&& param, size_type index) : m_index(difference_type(mse::msear_as_a_size_t(index))), m_ra_container_pointer(std::forward<_TRAContainerPointerRR2>(param)) {}
 
 				template<class _TLoneParam, class = typename std::enable_if<lone_param_seems_valid<_TLoneParam>::value, void>::type>
-				TRAConstIteratorBase(const _TLoneParam& param) : m_index(index_from_lone_param(typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param))
+				MSE_CONSTEXPR20 TRAConstIteratorBase(const _TLoneParam& param) : m_index(index_from_lone_param(typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param))
 					, m_ra_container_pointer(ra_container_pointer_from_lone_param(
 					typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param)) {}
 				template<class _TLoneParam, class = typename std::enable_if<lone_param_seems_valid<_TLoneParam>::value
 					&& (!std::is_base_of<TRAConstIteratorBase, _TLoneParam>::value), void>::type>
-				TRAConstIteratorBase(_TLoneParam&& param) : m_index(index_from_lone_param(typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param))
+				MSE_CONSTEXPR20 TRAConstIteratorBase(_TLoneParam&& param) : m_index(index_from_lone_param(typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), param))
 					, m_ra_container_pointer(ra_container_pointer_from_lone_param(
 					typename mse::impl::HasOrInheritsTargetContainerPtrMethod_msemsearray<_TLoneParam>::type(), std::forward<_TLoneParam>(param))) {}
 
-				auto operator*() const -> const_reference {
+				MSE_CONSTEXPR20 auto operator*() const -> const_reference {
 					return (*m_ra_container_pointer)[m_index];
 				}
-				auto operator->() const -> typename std::add_pointer<typename std::add_const<value_type>::type>::type {
+				MSE_CONSTEXPR20 auto operator->() const -> typename std::add_pointer<typename std::add_const<value_type>::type>::type {
 					return std::addressof((*m_ra_container_pointer)[m_index]);
 				}
-				const_reference operator[](difference_type _Off) const { return (*m_ra_container_pointer)[(m_index + _Off)]; }
-				TRAConstIteratorBase& operator +=(difference_type x) {
+				MSE_CONSTEXPR20 const_reference operator[](difference_type _Off) const { return (*m_ra_container_pointer)[(m_index + _Off)]; }
+				MSE_CONSTEXPR20 TRAConstIteratorBase& operator +=(difference_type x) {
 					m_index += (x);
 					return (*this);
 				}
-				TRAConstIteratorBase& operator -=(difference_type x) { operator +=(-x); return (*this); }
-				TRAConstIteratorBase& operator ++() { operator +=(1); return (*this); }
-				TRAConstIteratorBase operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
-				TRAConstIteratorBase& operator --() { operator -=(1); return (*this); }
-				TRAConstIteratorBase operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
+				MSE_CONSTEXPR20 TRAConstIteratorBase& operator -=(difference_type x) { operator +=(-x); return (*this); }
+				MSE_CONSTEXPR20 TRAConstIteratorBase& operator ++() { operator +=(1); return (*this); }
+				MSE_CONSTEXPR20 TRAConstIteratorBase operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
+				MSE_CONSTEXPR20 TRAConstIteratorBase& operator --() { operator -=(1); return (*this); }
+				MSE_CONSTEXPR20 TRAConstIteratorBase operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
 
-				TRAConstIteratorBase operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
-				TRAConstIteratorBase operator-(difference_type n) const { return ((*this) + (-n)); }
-				difference_type operator-(const TRAConstIteratorBase& _Right_cref) const {
+				MSE_CONSTEXPR20 TRAConstIteratorBase operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
+				MSE_CONSTEXPR20 TRAConstIteratorBase operator-(difference_type n) const { return ((*this) + (-n)); }
+				MSE_CONSTEXPR20 difference_type operator-(const TRAConstIteratorBase& _Right_cref) const {
 					if (!(_Right_cref.m_ra_container_pointer == m_ra_container_pointer)) { MSE_THROW(msearray_range_error("invalid argument - difference_type operator-() - TRAConstIteratorBase")); }
 					return m_index - _Right_cref.m_index;
 				}
-				bool operator ==(const TRAConstIteratorBase& _Right_cref) const {
+				MSE_CONSTEXPR20 bool operator ==(const TRAConstIteratorBase& _Right_cref) const {
 					if (!(_Right_cref.m_ra_container_pointer == m_ra_container_pointer)) { MSE_THROW(msearray_range_error("invalid argument - difference_type operator==() - TRAConstIteratorBase")); }
 					return (_Right_cref.m_index == m_index);
 				}
-				bool operator !=(const TRAConstIteratorBase& _Right_cref) const { return !((*this) == _Right_cref); }
-				bool operator<(const TRAConstIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
-				bool operator>(const TRAConstIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
-				bool operator<=(const TRAConstIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
-				bool operator>=(const TRAConstIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator !=(const TRAConstIteratorBase& _Right_cref) const { return !((*this) == _Right_cref); }
+				MSE_CONSTEXPR20 bool operator<(const TRAConstIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator>(const TRAConstIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator<=(const TRAConstIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator>=(const TRAConstIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
 
-				TRAConstIteratorBase& operator=(const TRAConstIteratorBase& _Right_cref) {
+				MSE_CONSTEXPR20 TRAConstIteratorBase& operator=(const TRAConstIteratorBase& _Right_cref) {
 					assignment_helper1(typename mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_TRAContainerPointerRR>::type(), _Right_cref);
 					return (*this);
 				}
-				TRAConstIteratorBase& operator=(TRAConstIteratorBase&& _Right_cref) {
+				MSE_CONSTEXPR20 TRAConstIteratorBase& operator=(TRAConstIteratorBase&& _Right_cref) {
 					assignment_helper1(typename mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_TRAContainerPointerRR>::type(), std::forward<decltype(_Right_cref)>(_Right_cref));
 					return (*this);
 				}
 				/* This assignment operator accepts iterators of different types (but pointing to the same container) and
 				attempts to obtain (and adopt) the given iterator's index position. */
 				template<typename _Ty2, class = typename std::enable_if<(!std::is_convertible<_Ty2, TRAConstIteratorBase>::value) && (mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_Ty2>::value), void>::type>
-				TRAConstIteratorBase& operator=(const _Ty2& _Right_cref) {
+				MSE_CONSTEXPR20 TRAConstIteratorBase& operator=(const _Ty2& _Right_cref) {
 					assignment_helper1(std::false_type(), _Right_cref);
 					return (*this);
 				}
 
-				void set_to_beginning() {
+				MSE_CONSTEXPR20 void set_to_beginning() {
 					m_index = 0;
 				}
-				difference_type position() const {
+				MSE_CONSTEXPR20 difference_type position() const {
 					return m_index;
 				}
-				_TRAContainerPointerRR target_container_ptr() const {
+				MSE_CONSTEXPR20 _TRAContainerPointerRR target_container_ptr() const {
 					return m_ra_container_pointer;
 				}
 
 			private:
 				template<class _Ty2 = _TRAContainerPointerRR, class = typename std::enable_if<(std::is_same<_Ty2, _TRAContainerPointerRR>::value)
 					&& (mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_Ty2>::value), void>::type>
-				void assignment_helper1(std::true_type, const TRAConstIteratorBase& _Right_cref) {
+				MSE_CONSTEXPR20 void assignment_helper1(std::true_type, const TRAConstIteratorBase& _Right_cref) {
 					((*this).m_ra_container_pointer) = _Right_cref.target_container_ptr();
 					(*this).m_index = _Right_cref.position();
 				}
 				template<class _Ty2 = _TRAContainerPointerRR, class = typename std::enable_if<(std::is_same<_Ty2, _TRAContainerPointerRR>::value)
 					&& (mse::impl::HasOrInheritsAssignmentOperator_msemsearray<_Ty2>::value), void>::type>
-				void assignment_helper1(std::true_type, TRAConstIteratorBase&& _Right_cref) {
+				MSE_CONSTEXPR20 void assignment_helper1(std::true_type, TRAConstIteratorBase&& _Right_cref) {
 					(*this).m_index = _Right_cref.m_index;
 					((*this).m_ra_container_pointer) = std::forward<decltype(_Right_cref)>(_Right_cref).m_ra_container_pointer;
 				}
 				template<typename _Ty2>
-				void assignment_helper1(std::false_type, const _Ty2& _Right_cref) {
+				MSE_CONSTEXPR20 void assignment_helper1(std::false_type, const _Ty2& _Right_cref) {
 					if (((*this).m_ra_container_pointer) && (_Right_cref.target_container_ptr())) {
 						const auto& this_m_ra_container_pointer_lvaluecref = *((*this).m_ra_container_pointer);
 						const auto& Right_m_ra_container_pointer_lvaluecref = *(_Right_cref.target_container_ptr());
@@ -1126,27 +1126,27 @@ namespace mse {
 
 		MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TXScopeRAConstIterator, base_class);
 
-		TXScopeRAConstIterator& operator +=(difference_type x) {
+		MSE_CONSTEXPR20 TXScopeRAConstIterator& operator +=(difference_type x) {
 			base_class::operator +=(x);
 			return (*this);
 		}
-		TXScopeRAConstIterator& operator -=(difference_type x) { operator +=(-x); return (*this); }
-		TXScopeRAConstIterator& operator ++() { operator +=(1); return (*this); }
-		TXScopeRAConstIterator operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
-		TXScopeRAConstIterator& operator --() { operator -=(1); return (*this); }
-		TXScopeRAConstIterator operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
+		MSE_CONSTEXPR20 TXScopeRAConstIterator& operator -=(difference_type x) { operator +=(-x); return (*this); }
+		MSE_CONSTEXPR20 TXScopeRAConstIterator& operator ++() { operator +=(1); return (*this); }
+		MSE_CONSTEXPR20 TXScopeRAConstIterator operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
+		MSE_CONSTEXPR20 TXScopeRAConstIterator& operator --() { operator -=(1); return (*this); }
+		MSE_CONSTEXPR20 TXScopeRAConstIterator operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
 
-		TXScopeRAConstIterator operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
-		TXScopeRAConstIterator operator-(difference_type n) const { return ((*this) + (-n)); }
-		difference_type operator-(const base_class& _Right_cref) const {
+		MSE_CONSTEXPR20 TXScopeRAConstIterator operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
+		MSE_CONSTEXPR20 TXScopeRAConstIterator operator-(difference_type n) const { return ((*this) + (-n)); }
+		MSE_CONSTEXPR20 difference_type operator-(const base_class& _Right_cref) const {
 			return base_class::operator-(_Right_cref);
 		}
 
-		TXScopeRAConstIterator& operator=(const TXScopeRAConstIterator& _Right_cref) {
+		MSE_CONSTEXPR20 TXScopeRAConstIterator& operator=(const TXScopeRAConstIterator& _Right_cref) {
 			base_class::operator=(_Right_cref);
 			return (*this);
 		}
-		TXScopeRAConstIterator& operator=(TXScopeRAConstIterator&& _Right_cref) {
+		MSE_CONSTEXPR20 TXScopeRAConstIterator& operator=(TXScopeRAConstIterator&& _Right_cref) {
 			base_class::operator=(std::forward<decltype(_Right_cref)>(_Right_cref));
 			return (*this);
 		}
@@ -2517,17 +2517,17 @@ namespace mse {
 		template <typename _Ty>
 		class TOpaqueWrapper {
 		public:
-			TOpaqueWrapper(const _Ty& value_param) : m_value(value_param) {}
-			TOpaqueWrapper(_Ty&& value_param) : m_value(std::forward<decltype(value_param)>(value_param)) {}
+			MSE_CONSTEXPR20 TOpaqueWrapper(const _Ty& value_param) : m_value(value_param) {}
+			MSE_CONSTEXPR20 TOpaqueWrapper(_Ty&& value_param) : m_value(std::forward<decltype(value_param)>(value_param)) {}
 
 			template<typename ...Args, typename = typename std::enable_if<std::is_constructible<_Ty, Args...>::value
 				&& !mse::impl::is_a_pair_with_the_first_a_base_of_the_second_msepointerbasics<TOpaqueWrapper, Args...>::value>::type>
-			TOpaqueWrapper(Args&&...args) : m_value(std::forward<Args>(args)...) {}
+			MSE_CONSTEXPR20 TOpaqueWrapper(Args&&...args) : m_value(std::forward<Args>(args)...) {}
 
-			_Ty& value() & { return m_value; }
-			auto&& value() && { return std::forward<decltype(m_value)>(m_value); }
-			const _Ty& value() const & { return m_value; }
-			const _Ty& value() const && { return m_value; }
+			MSE_CONSTEXPR20 _Ty& value() & { return m_value; }
+			MSE_CONSTEXPR20 auto&& value() && { return std::forward<decltype(m_value)>(m_value); }
+			MSE_CONSTEXPR20 const _Ty& value() const & { return m_value; }
+			MSE_CONSTEXPR20 const _Ty& value() const && { return m_value; }
 
 			_Ty m_value;
 		};
@@ -2764,19 +2764,19 @@ namespace mse {
 		typedef typename ra_it_base::size_type size_type;
 
 	private:
-		const _MA& contained_array() const& { return (*this).value(); }
-		const _MA& contained_array() const && { return (*this).value(); }
-		_MA& contained_array() & { return (*this).value(); }
-		auto&& contained_array() && { return std::move(*this).value(); }
+		MSE_CONSTEXPR20 const _MA& contained_array() const& { return (*this).value(); }
+		MSE_CONSTEXPR20 const _MA& contained_array() const && { return (*this).value(); }
+		MSE_CONSTEXPR20 _MA& contained_array() & { return (*this).value(); }
+		MSE_CONSTEXPR20 auto&& contained_array() && { return std::move(*this).value(); }
 
 	public:
-		nii_array() {}
-		nii_array(_MA&& _X) : base_class(std::forward<decltype(_X)>(_X)) {}
-		nii_array(const _MA& _X) : base_class(_X) {}
-		nii_array(_Myt&& _X) : base_class(std::forward<decltype(_X)>(_X).contained_array()) {}
-		nii_array(const _Myt& _X) : base_class(_X.contained_array()) {}
+		MSE_CONSTEXPR20 nii_array() {}
+		MSE_CONSTEXPR20 nii_array(_MA&& _X) : base_class(std::forward<decltype(_X)>(_X)) {}
+		MSE_CONSTEXPR20 nii_array(const _MA& _X) : base_class(_X) {}
+		MSE_CONSTEXPR20 nii_array(_Myt&& _X) : base_class(std::forward<decltype(_X)>(_X).contained_array()) {}
+		MSE_CONSTEXPR20 nii_array(const _Myt& _X) : base_class(_X.contained_array()) {}
 		//nii_array(_XSTD initializer_list<typename _MA::base_class::value_type> _Ilist) : base_class(_Ilist) {}
-		static std::array<_Ty, _Size> std_array_initial_value(std::true_type, _XSTD initializer_list<_Ty> _Ilist) {
+		MSE_CONSTEXPR20 static std::array<_Ty, _Size> std_array_initial_value(std::true_type, _XSTD initializer_list<_Ty> _Ilist) {
 			/* _Ty is default constructible. */
 			typedef typename std::remove_const<_Ty>::type _NCTy;
 			std::array<_NCTy, _Size> nc_retval;
@@ -2794,16 +2794,23 @@ namespace mse {
 				(*target_it) = (*Il_it);
 			}
 
+			return std_array_from_nc_std_array(typename std::is_const<_Ty>::type(), nc_retval);
+		}
+		MSE_CONSTEXPR20 static std::array<_Ty, _Size> std_array_from_nc_std_array(std::false_type, std::array<_Ty, _Size>& nc_array) {
+			/* No reinterpretation is necessary when _Ty isn't const (which also keeps this usable in constant expressions). */
+			return nc_array;
+		}
+		static std::array<_Ty, _Size> std_array_from_nc_std_array(std::true_type, std::array<typename std::remove_const<_Ty>::type, _Size>& nc_array) {
 			/* We're just reinterpreting an std::array<T, Size> as (potentially) an std::array<const T, Size> which
 			should be safe. Right?*/
-			auto& retval_ref = reinterpret_cast<std::array<_Ty, _Size>&>(nc_retval);
+			auto& retval_ref = reinterpret_cast<std::array<_Ty, _Size>&>(nc_array);
 			return retval_ref;
 		}
-		static std::array<_Ty, _Size> std_array_initial_value(std::false_type, _XSTD initializer_list<_Ty> _Ilist) {
+		MSE_CONSTEXPR20 static std::array<_Ty, _Size> std_array_initial_value(std::false_type, _XSTD initializer_list<_Ty> _Ilist) {
 			/* _Ty is not default constructible. */
 			return impl::array_helper::array_helper_type<_Ty, _Size>::std_array_initial_value2(_Ilist);
 		}
-		nii_array(_XSTD initializer_list<_Ty> _Ilist) : base_class(std_array_initial_value(std::is_default_constructible<_Ty>(), _Ilist)) {
+		MSE_CONSTEXPR20 nii_array(_XSTD initializer_list<_Ty> _Ilist) : base_class(std_array_initial_value(std::is_default_constructible<_Ty>(), _Ilist)) {
 			/* std::array<> is an "aggregate type" (basically a POD struct with no base class, constructors or private
 			data members (details here: http://en.cppreference.com/w/cpp/language/aggregate_initialization)). As such,
 			support for construction from initializer list is automatically generated by the compiler. Specifically,
@@ -2814,22 +2821,22 @@ namespace mse {
 			can. */
 		}
 
-		~nii_array() {
+		MSE_CONSTEXPR20 ~nii_array() {
 			mse::impl::destructor_lock_guard1<state_mutex_t> lock1(m_mutex1);
 
 			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
 			valid_if_Ty_is_not_an_xscope_type();
 		}
 
-		operator _MA() const { return contained_array(); }
+		MSE_CONSTEXPR20 operator _MA() const { return contained_array(); }
 
-		typename std_array::const_reference operator[](msear_size_t _P) const {
+		MSE_CONSTEXPR20 typename std_array::const_reference operator[](msear_size_t _P) const {
 			return (*this).at(msear_as_a_size_t(_P));
 		}
-		typename std_array::reference operator[](msear_size_t _P) {
+		MSE_CONSTEXPR20 typename std_array::reference operator[](msear_size_t _P) {
 			return (*this).at(msear_as_a_size_t(_P));
 		}
-		typename std_array::reference front() {	// return first element of mutable sequence
+		MSE_CONSTEXPR20 typename std_array::reference front() {	// return first element of mutable sequence
 			if (0 == (*this).size()) { MSE_THROW(nii_array_range_error("front() on empty - typename std_array::reference front() - nii_array")); }
 			return contained_array().front();
 		}
@@ -2837,7 +2844,7 @@ namespace mse {
 			if (0 == (*this).size()) { MSE_THROW(nii_array_range_error("front() on empty - typename std_array::const_reference front() - nii_array")); }
 			return contained_array().front();
 		}
-		typename std_array::reference back() {	// return last element of mutable sequence
+		MSE_CONSTEXPR20 typename std_array::reference back() {	// return last element of mutable sequence
 			if (0 == (*this).size()) { MSE_THROW(nii_array_range_error("back() on empty - typename std_array::reference back() - nii_array")); }
 			return contained_array().back();
 		}
@@ -2874,12 +2881,12 @@ namespace mse {
 			contained_array().swap(_Other);
 		}
 
-		size_type size() const _NOEXCEPT
+		MSE_CONSTEXPR20 size_type size() const _NOEXCEPT
 		{	// return length of sequence
 			return contained_array().size();
 		}
 
-		size_type max_size() const _NOEXCEPT
+		MSE_CONSTEXPR20 size_type max_size() const _NOEXCEPT
 		{	// return maximum possible length of sequence
 			return contained_array().max_size();
 		}
@@ -2889,22 +2896,22 @@ namespace mse {
 			return contained_array().empty();
 		}
 
-		reference at(msear_size_t _Pos)
+		MSE_CONSTEXPR20 reference at(msear_size_t _Pos)
 		{	// subscript mutable sequence with checking
 			return contained_array().at(msear_as_a_size_t(_Pos));
 		}
 
-		const_reference at(msear_size_t _Pos) const
+		MSE_CONSTEXPR20 const_reference at(msear_size_t _Pos) const
 		{	// subscript nonmutable sequence with checking
 			return contained_array().at(msear_as_a_size_t(_Pos));
 		}
 
-		value_type *data() _NOEXCEPT
+		MSE_CONSTEXPR20 value_type *data() _NOEXCEPT
 		{	// return pointer to mutable data array
 			return contained_array().data();
 		}
 
-		const value_type *data() const _NOEXCEPT
+		MSE_CONSTEXPR20 const value_type *data() const _NOEXCEPT
 		{	// return pointer to nonmutable data array
 			return contained_array().data();
 		}
@@ -3052,10 +3059,10 @@ namespace mse {
 		static auto xscope_ss_rend(const mse::TXScopeFixedConstPointer<_Myt>& owner_ptr) { return xscope_ss_crend(owner_ptr); }
 
 
-		bool operator==(const _Myt& _Right) const {	// test for array equality
+		MSE_CONSTEXPR20 bool operator==(const _Myt& _Right) const {	// test for array equality
 			return (_Right.contained_array() == contained_array());
 		}
-		bool operator<(const _Myt& _Right) const {	// test if _Left < _Right for arrays
+		MSE_CONSTEXPR20 bool operator<(const _Myt& _Right) const {	// test if _Left < _Right for arrays
 			return (contained_array() < _Right.contained_array());
 		}
 
@@ -3082,7 +3089,7 @@ namespace mse {
 		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
 		(intended) compile error. */
 		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
-		void valid_if_Ty_is_not_an_xscope_type() const {}
+		MSE_CONSTEXPR20 void valid_if_Ty_is_not_an_xscope_type() const {}
 
 		ss_iterator_type ss_begin() {	// return std_array::iterator for beginning of mutable sequence
 			ss_iterator_type retval(this);
@@ -3350,7 +3357,7 @@ namespace mse {
 			typedef msearray _Myt;
 
 			MSE_USING(msearray, base_class);
-			msearray(_XSTD initializer_list<typename base_class::_MA::value_type> _Ilist) : base_class(_Ilist) {}
+			MSE_CONSTEXPR20 msearray(_XSTD initializer_list<typename base_class::_MA::value_type> _Ilist) : base_class(_Ilist) {}
 
 			MSE_INHERITED_RANDOM_ACCESS_MEMBER_TYPE_DECLARATIONS(base_class);
 
@@ -3359,40 +3366,40 @@ namespace mse {
 			typedef typename base_class::_MA::reverse_iterator reverse_iterator;
 			typedef typename base_class::_MA::const_reverse_iterator const_reverse_iterator;
 
-			iterator begin() _NOEXCEPT {	// return iterator for beginning of mutable sequence
+			MSE_CONSTEXPR20 iterator begin() _NOEXCEPT {	// return iterator for beginning of mutable sequence
 				return base_class::contained_array().begin();
 			}
-			const_iterator begin() const _NOEXCEPT {	// return iterator for beginning of nonmutable sequence
+			MSE_CONSTEXPR20 const_iterator begin() const _NOEXCEPT {	// return iterator for beginning of nonmutable sequence
 				return base_class::contained_array().begin();
 			}
-			iterator end() _NOEXCEPT {	// return iterator for end of mutable sequence
+			MSE_CONSTEXPR20 iterator end() _NOEXCEPT {	// return iterator for end of mutable sequence
 				return base_class::contained_array().end();
 			}
-			const_iterator end() const _NOEXCEPT {	// return iterator for beginning of nonmutable sequence
+			MSE_CONSTEXPR20 const_iterator end() const _NOEXCEPT {	// return iterator for beginning of nonmutable sequence
 				return base_class::contained_array().end();
 			}
-			reverse_iterator rbegin() _NOEXCEPT {	// return iterator for beginning of reversed mutable sequence
+			MSE_CONSTEXPR20 reverse_iterator rbegin() _NOEXCEPT {	// return iterator for beginning of reversed mutable sequence
 				return base_class::contained_array().rbegin();
 			}
-			const_reverse_iterator rbegin() const _NOEXCEPT {	// return iterator for beginning of reversed nonmutable sequence
+			MSE_CONSTEXPR20 const_reverse_iterator rbegin() const _NOEXCEPT {	// return iterator for beginning of reversed nonmutable sequence
 				return base_class::contained_array().rbegin();
 			}
-			reverse_iterator rend() _NOEXCEPT {	// return iterator for end of reversed mutable sequence
+			MSE_CONSTEXPR20 reverse_iterator rend() _NOEXCEPT {	// return iterator for end of reversed mutable sequence
 				return base_class::contained_array().rend();
 			}
-			const_reverse_iterator rend() const _NOEXCEPT {	// return iterator for end of reversed nonmutable sequence
+			MSE_CONSTEXPR20 const_reverse_iterator rend() const _NOEXCEPT {	// return iterator for end of reversed nonmutable sequence
 				return base_class::contained_array().rend();
 			}
-			const_iterator cbegin() const _NOEXCEPT {	// return iterator for beginning of nonmutable sequence
+			MSE_CONSTEXPR20 const_iterator cbegin() const _NOEXCEPT {	// return iterator for beginning of nonmutable sequence
 				return base_class::contained_array().cbegin();
 			}
-			const_iterator cend() const _NOEXCEPT {	// return iterator for end of nonmutable sequence
+			MSE_CONSTEXPR20 const_iterator cend() const _NOEXCEPT {	// return iterator for end of nonmutable sequence
 				return base_class::contained_array().cend();
 			}
-			const_reverse_iterator crbegin() const _NOEXCEPT {	// return iterator for beginning of reversed nonmutable sequence
+			MSE_CONSTEXPR20 const_reverse_iterator crbegin() const _NOEXCEPT {	// return iterator for beginning of reversed nonmutable sequence
 				return base_class::contained_array().crbegin();
 			}
-			const_reverse_iterator crend() const _NOEXCEPT {	// return iterator for end of reversed nonmutable sequence
+			MSE_CONSTEXPR20 const_reverse_iterator crend() const _NOEXCEPT {	// return iterator for end of reversed nonmutable sequence
 				return base_class::contained_array().crend();
 			}
 
@@ -3484,8 +3491,8 @@ namespace mse {
 
 		private:
 
-			auto contained_array() const -> decltype(base_class::contained_array()) { return base_class::contained_array(); }
-			auto contained_array() -> decltype(base_class::contained_array()) { return base_class::contained_array(); }
+			MSE_CONSTEXPR20 auto contained_array() const -> decltype(base_class::contained_array()) { return base_class::contained_array(); }
+			MSE_CONSTEXPR20 auto contained_array() -> decltype(base_class::contained_array()) { return base_class::contained_array(); }
 
 			template<size_t _Idx, class _Tz, size_t _Size2>
 			friend _CONST_FUN _Tz& std::get(mse::us::msearray<_Tz, _Size2>& _Arr) _NOEXCEPT;
@@ -4394,58 +4401,58 @@ namespace mse {
 				difference_type m_index = 0;
 
 			public:
-				TRASectionConstIteratorBase(const TRASectionConstIteratorBase& src)
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase(const TRASectionConstIteratorBase& src)
 					: m_ra_iterator(src.m_ra_iterator), m_count(src.m_count), m_index(src.m_index) {}
-				TRASectionConstIteratorBase(const TRASectionIteratorBase<_TRAIterator>& src)
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase(const TRASectionIteratorBase<_TRAIterator>& src)
 					: m_ra_iterator(src.m_ra_iterator), m_count(src.m_count), m_index(src.m_index) {}
-				TRASectionConstIteratorBase(_TRAIterator ra_iterator, size_type count, size_type index = 0)
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase(_TRAIterator ra_iterator, size_type count, size_type index = 0)
 					: m_ra_iterator(ra_iterator), m_count(count), m_index(difference_type(mse::msear_as_a_size_t(index))) {}
 
-				void bounds_check(difference_type index) const {
+				MSE_CONSTEXPR20 void bounds_check(difference_type index) const {
 					if ((0 > index) || (difference_type(mse::msear_as_a_size_t(m_count)) <= index)) {
 						MSE_THROW(msearray_range_error("out of bounds index - void bounds_check() - TRASectionConstIteratorBase"));
 					}
 				}
-				void dereference_bounds_check() const {
+				MSE_CONSTEXPR20 void dereference_bounds_check() const {
 					bounds_check(m_index);
 				}
-				auto operator*() const -> const_reference {
+				MSE_CONSTEXPR20 auto operator*() const -> const_reference {
 					dereference_bounds_check();
 					return m_ra_iterator[m_index];
 				}
-				auto operator->() const -> typename std::add_pointer<typename std::add_const<value_type>::type>::type {
+				MSE_CONSTEXPR20 auto operator->() const -> typename std::add_pointer<typename std::add_const<value_type>::type>::type {
 					dereference_bounds_check();
 					return std::addressof(m_ra_iterator[m_index]);
 				}
-				const_reference operator[](difference_type _Off) const {
+				MSE_CONSTEXPR20 const_reference operator[](difference_type _Off) const {
 					bounds_check(_Off);
 					return m_ra_iterator[_Off];
 				}
-				TRASectionConstIteratorBase& operator +=(difference_type x) {
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase& operator +=(difference_type x) {
 					m_index += (x);
 					return (*this);
 				}
-				TRASectionConstIteratorBase& operator -=(difference_type x) { operator +=(-x); return (*this); }
-				TRASectionConstIteratorBase& operator ++() { operator +=(1); return (*this); }
-				TRASectionConstIteratorBase operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
-				TRASectionConstIteratorBase& operator --() { operator -=(1); return (*this); }
-				TRASectionConstIteratorBase operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase& operator -=(difference_type x) { operator +=(-x); return (*this); }
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase& operator ++() { operator +=(1); return (*this); }
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase& operator --() { operator -=(1); return (*this); }
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
 
-				TRASectionConstIteratorBase operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
-				TRASectionConstIteratorBase operator-(difference_type n) const { return ((*this) + (-n)); }
-				difference_type operator-(const TRASectionConstIteratorBase& _Right_cref) const {
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase operator-(difference_type n) const { return ((*this) + (-n)); }
+				MSE_CONSTEXPR20 difference_type operator-(const TRASectionConstIteratorBase& _Right_cref) const {
 					if (!(_Right_cref.m_ra_iterator == m_ra_iterator)) { MSE_THROW(msearray_range_error("invalid argument - difference_type operator-() - TRASectionConstIteratorBase")); }
 					return m_index - _Right_cref.m_index;
 				}
-				bool operator ==(const TRASectionConstIteratorBase& _Right_cref) const {
+				MSE_CONSTEXPR20 bool operator ==(const TRASectionConstIteratorBase& _Right_cref) const {
 					return ((_Right_cref.m_index == m_index) && (_Right_cref.m_count == m_count) && (_Right_cref.m_ra_iterator == m_ra_iterator));
 				}
-				bool operator !=(const TRASectionConstIteratorBase& _Right_cref) const { return !((*this) == _Right_cref); }
-				bool operator<(const TRASectionConstIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
-				bool operator>(const TRASectionConstIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
-				bool operator<=(const TRASectionConstIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
-				bool operator>=(const TRASectionConstIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
-				TRASectionConstIteratorBase& operator=(const TRASectionConstIteratorBase& _Right_cref) {
+				MSE_CONSTEXPR20 bool operator !=(const TRASectionConstIteratorBase& _Right_cref) const { return !((*this) == _Right_cref); }
+				MSE_CONSTEXPR20 bool operator<(const TRASectionConstIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator>(const TRASectionConstIteratorBase& _Right_cref) const { return (0 > operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator<=(const TRASectionConstIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 bool operator>=(const TRASectionConstIteratorBase& _Right_cref) const { return (0 >= operator-(_Right_cref)); }
+				MSE_CONSTEXPR20 TRASectionConstIteratorBase& operator=(const TRASectionConstIteratorBase& _Right_cref) {
 					if (!(_Right_cref.m_ra_iterator == m_ra_iterator)) { MSE_THROW(msearray_range_error("invalid argument - TRASectionConstIteratorBase& operator=() - TRASectionConstIteratorBase")); }
 					m_index = _Right_cref.m_index;
 					return (*this);
@@ -4480,28 +4487,28 @@ namespace mse {
 		MSE_INHERITED_RANDOM_ACCESS_ITERATOR_MEMBER_TYPE_DECLARATIONS(base_class);
 		typedef typename base_class::iterator_type iterator_type;
 
-		TXScopeRASectionConstIterator(const us::impl::TRASectionConstIteratorBase<_TRAIterator>& src)
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator(const us::impl::TRASectionConstIteratorBase<_TRAIterator>& src)
 			: base_class(src) {}
-		TXScopeRASectionConstIterator(_TRAIterator ra_iterator, size_type count, size_type index = 0)
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator(_TRAIterator ra_iterator, size_type count, size_type index = 0)
 			: base_class(ra_iterator, count, index) {}
 
-		TXScopeRASectionConstIterator& operator +=(difference_type x) {
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator& operator +=(difference_type x) {
 			base_class::operator +=(x);
 			return (*this);
 		}
-		TXScopeRASectionConstIterator& operator -=(difference_type x) { operator +=(-x); return (*this); }
-		TXScopeRASectionConstIterator& operator ++() { operator +=(1); return (*this); }
-		TXScopeRASectionConstIterator operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
-		TXScopeRASectionConstIterator& operator --() { operator -=(1); return (*this); }
-		TXScopeRASectionConstIterator operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator& operator -=(difference_type x) { operator +=(-x); return (*this); }
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator& operator ++() { operator +=(1); return (*this); }
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator operator ++(int) { auto _Tmp = *this; operator +=(1); return (_Tmp); }
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator& operator --() { operator -=(1); return (*this); }
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator operator --(int) { auto _Tmp = *this; operator -=(1); return (_Tmp); }
 
-		TXScopeRASectionConstIterator operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
-		TXScopeRASectionConstIterator operator-(difference_type n) const { return ((*this) + (-n)); }
-		difference_type operator-(const us::impl::TRASectionConstIteratorBase<_TRAIterator>& _Right_cref) const {
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator operator-(difference_type n) const { return ((*this) + (-n)); }
+		MSE_CONSTEXPR20 difference_type operator-(const us::impl::TRASectionConstIteratorBase<_TRAIterator>& _Right_cref) const {
 			return base_class::operator-(_Right_cref);
 		}
 
-		TXScopeRASectionConstIterator& operator=(const us::impl::TRASectionConstIteratorBase<_TRAIterator>& _Right_cref) {
+		MSE_CONSTEXPR20 TXScopeRASectionConstIterator& operator=(const us::impl::TRASectionConstIteratorBase<_TRAIterator>& _Right_cref) {
 			base_class::operator=(_Right_cref);
 			return (*this);
 		}
@@ -5036,46 +5043,46 @@ namespace mse {
 					mse::impl::random_access_const_iterator_base<typename std::remove_reference<decltype(std::declval<_TRAIterator>()[0])>::type>);
 
 				//TRandomAccessConstSectionBase(const TRandomAccessConstSectionBase& src) = default;
-				TRandomAccessConstSectionBase(const TRandomAccessConstSectionBase& src) : m_count(src.m_count), m_start_iter(src.m_start_iter) {}
-				TRandomAccessConstSectionBase(const TRandomAccessSectionBase<_TRAIterator>& src) : m_count(src.m_count), m_start_iter(src.m_start_iter) {}
-				TRandomAccessConstSectionBase(const _TRAIterator& start_iter, size_type count) : m_count(count), m_start_iter(start_iter) {}
+				MSE_CONSTEXPR20 TRandomAccessConstSectionBase(const TRandomAccessConstSectionBase& src) : m_count(src.m_count), m_start_iter(src.m_start_iter) {}
+				MSE_CONSTEXPR20 TRandomAccessConstSectionBase(const TRandomAccessSectionBase<_TRAIterator>& src) : m_count(src.m_count), m_start_iter(src.m_start_iter) {}
+				MSE_CONSTEXPR20 TRandomAccessConstSectionBase(const _TRAIterator& start_iter, size_type count) : m_count(count), m_start_iter(start_iter) {}
 
 				template <typename _TRALoneParam>
-				TRandomAccessConstSectionBase(const _TRALoneParam& param)
+				MSE_CONSTEXPR20 TRandomAccessConstSectionBase(const _TRALoneParam& param)
 					/* _TRALoneParam being either another TRandomAccess(Const)SectionBase<> or a pointer to "random access" container is
 					supported. Different initialization implementations are required for each of the two cases. */
 					: m_count(s_count_from_lone_param(param))
 					, m_start_iter(s_xscope_iter_from_lone_param(param)) {}
 				template <typename _TRALoneParam>
-				TRandomAccessConstSectionBase(_TRALoneParam&& param)
+				MSE_CONSTEXPR20 TRandomAccessConstSectionBase(_TRALoneParam&& param)
 					: m_count(s_count_from_lone_param(param))
 					, m_start_iter(s_xscope_iter_from_lone_param(std::forward<decltype(param)>(param))) {}
 
-				const_reference operator[](size_type _P) const {
+				MSE_CONSTEXPR20 const_reference operator[](size_type _P) const {
 					if (m_count <= _P) { MSE_THROW(msearray_range_error("out of bounds index - reference operator[](size_type _P) - TRandomAccessConstSectionBase")); }
 					return m_start_iter[difference_type(mse::msear_as_a_size_t(_P))];
 				}
-				const_reference at(size_type _P) const {
+				MSE_CONSTEXPR20 const_reference at(size_type _P) const {
 					return (*this)[_P];
 				}
-				const_reference front() const {
+				MSE_CONSTEXPR20 const_reference front() const {
 					if (0 == (*this).size()) { MSE_THROW(msearray_range_error("front() on empty - const_reference front() const - TRandomAccessConstSectionBase")); }
 					return (*this)[0];
 				}
-				const_reference back() const {
+				MSE_CONSTEXPR20 const_reference back() const {
 					if (0 == (*this).size()) { MSE_THROW(msearray_range_error("back() on empty - const_reference back() const - TRandomAccessConstSectionBase")); }
 					return (*this)[(*this).size() - 1];
 				}
-				size_type size() const _NOEXCEPT {
+				MSE_CONSTEXPR20 size_type size() const _NOEXCEPT {
 					return m_count;
 				}
-				size_type length() const _NOEXCEPT {
+				MSE_CONSTEXPR20 size_type length() const _NOEXCEPT {
 					return (*this).size();
 				}
-				size_type max_size() const _NOEXCEPT {	// return maximum possible length of sequence
+				MSE_CONSTEXPR20 size_type max_size() const _NOEXCEPT {	// return maximum possible length of sequence
 					return static_cast<size_type>((std::numeric_limits<difference_type>::max)());
 				}
-				bool empty() const _NOEXCEPT {
+				MSE_CONSTEXPR20 bool empty() const _NOEXCEPT {
 					return (0 == (*this).size());
 				}
 
@@ -5173,12 +5180,12 @@ namespace mse {
 					return n;
 				}
 
-				void remove_prefix(size_type n) /*_NOEXCEPT*/ {
+				MSE_CONSTEXPR20 void remove_prefix(size_type n) /*_NOEXCEPT*/ {
 					if (n > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - void remove_prefix() - TRandomAccessConstSectionBase")); }
 					m_count -= n;
 					m_start_iter += n;
 				}
-				void remove_suffix(size_type n) /*_NOEXCEPT*/ {
+				MSE_CONSTEXPR20 void remove_suffix(size_type n) /*_NOEXCEPT*/ {
 					if (n > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - void remove_suffix() - TRandomAccessConstSectionBase")); }
 					m_count -= n;
 				}
@@ -5368,21 +5375,21 @@ namespace mse {
 				public:
 					typedef xscope_const_iterator_base base_class;
 					MSE_INHERITED_RANDOM_ACCESS_ITERATOR_MEMBER_TYPE_DECLARATIONS(base_class);
-					xscope_const_iterator(const xscope_const_iterator&) = default;
-					xscope_const_iterator(xscope_const_iterator&&) = default;
+					MSE_CONSTEXPR20 xscope_const_iterator(const xscope_const_iterator&) = default;
+					MSE_CONSTEXPR20 xscope_const_iterator(xscope_const_iterator&&) = default;
 
 					//MSE_USING(xscope_const_iterator, base_class);
 					template<class _TRASectionPointer, class = typename std::enable_if<!std::is_base_of<base_class, _TRASectionPointer>::value, void>::type>
-					xscope_const_iterator(const _TRASectionPointer& ptr, size_type index = 0) : base_class((*ptr).m_start_iter, (*ptr).m_count, index) {}
+					MSE_CONSTEXPR20 xscope_const_iterator(const _TRASectionPointer& ptr, size_type index = 0) : base_class((*ptr).m_start_iter, (*ptr).m_count, index) {}
 				private:
-					xscope_const_iterator(const _TRAIterator& iter, size_type count, size_type index) : base_class(iter, count, index) {}
+					MSE_CONSTEXPR20 xscope_const_iterator(const _TRAIterator& iter, size_type count, size_type index) : base_class(iter, count, index) {}
 					friend class TRandomAccessConstSectionBase;
 				};
 				typedef xscope_const_iterator xscope_iterator;
-				xscope_const_iterator xscope_begin() const { return (*this).xscope_cbegin(); }
-				xscope_const_iterator xscope_cbegin() const { return xscope_const_iterator((*this).m_start_iter, (*this).m_count, 0); }
-				xscope_const_iterator xscope_end() const { return (*this).xscope_cend(); }
-				xscope_const_iterator xscope_cend() const {
+				MSE_CONSTEXPR20 xscope_const_iterator xscope_begin() const { return (*this).xscope_cbegin(); }
+				MSE_CONSTEXPR20 xscope_const_iterator xscope_cbegin() const { return xscope_const_iterator((*this).m_start_iter, (*this).m_count, 0); }
+				MSE_CONSTEXPR20 xscope_const_iterator xscope_end() const { return (*this).xscope_cend(); }
+				MSE_CONSTEXPR20 xscope_const_iterator xscope_cend() const {
 					auto retval(xscope_const_iterator((*this).m_start_iter, (*this).m_count, 0));
 					retval += mse::msear_as_a_size_t((*this).m_count);
 					return retval;
@@ -5406,7 +5413,7 @@ namespace mse {
 				}
 
 			protected:
-				TRandomAccessConstSectionBase subsection(size_type pos = 0, size_type n = npos) const {
+				MSE_CONSTEXPR20 TRandomAccessConstSectionBase subsection(size_type pos = 0, size_type n = npos) const {
 					if (pos > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - TRandomAccessConstSectionBase subsection() const - TRandomAccessConstSectionBase")); }
 					return TRandomAccessConstSectionBase((*this).m_start_iter + mse::msear_as_a_size_t(pos), std::min(mse::msear_as_a_size_t(n), mse::msear_as_a_size_t((*this).size()) - mse::msear_as_a_size_t(pos)));
 				}
@@ -5451,11 +5458,11 @@ namespace mse {
 			return xscope_subsection_pv(pos, n);
 		}
 		/* prefer the make_subsection() free function instead */
-		auto subsection(size_type pos = 0, size_type n = npos) const {
+		MSE_CONSTEXPR20 auto subsection(size_type pos = 0, size_type n = npos) const {
 			return subsection_pv(pos, n);
 		}
-		auto first(size_type count) const { return subsection_pv(0, count); }
-		auto last(size_type count) const { return subsection_pv(std::max(difference_type(mse::msear_as_a_size_t((*this).size())) - difference_type(mse::msear_as_a_size_t(count)), 0), count); }
+		MSE_CONSTEXPR20 auto first(size_type count) const { return subsection_pv(0, count); }
+		MSE_CONSTEXPR20 auto last(size_type count) const { return subsection_pv(std::max(difference_type(mse::msear_as_a_size_t((*this).size())) - difference_type(mse::msear_as_a_size_t(count)), 0), count); }
 
 		//typedef typename base_class::xscope_iterator xscope_iterator;
 		typedef typename base_class::xscope_const_iterator xscope_const_iterator;
@@ -5463,19 +5470,19 @@ namespace mse {
 		/* These are here because some standard algorithms require them. Prefer the "xscope_" prefixed versions to
 		acknowledge that scope iterators are returned. */
 		typedef xscope_const_iterator const_iterator;
-		auto begin() const { return (*this).xscope_cbegin(); }
-		auto cbegin() const { return (*this).xscope_cbegin(); }
-		auto end() const { return (*this).xscope_cend(); }
-		auto cend() const { return (*this).xscope_cend(); }
+		MSE_CONSTEXPR20 auto begin() const { return (*this).xscope_cbegin(); }
+		MSE_CONSTEXPR20 auto cbegin() const { return (*this).xscope_cbegin(); }
+		MSE_CONSTEXPR20 auto end() const { return (*this).xscope_cend(); }
+		MSE_CONSTEXPR20 auto cend() const { return (*this).xscope_cend(); }
 
 	private:
 
-		TXScopeRandomAccessConstSection xscope_subsection_pv(size_type pos = 0, size_type n = npos) const {
+		MSE_CONSTEXPR20 TXScopeRandomAccessConstSection xscope_subsection_pv(size_type pos = 0, size_type n = npos) const {
 			if (pos > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - TXScopeRandomAccessConstSection xscope_subsection() const - TXScopeRandomAccessConstSection")); }
 			return TXScopeRandomAccessConstSection((*this).m_start_iter + mse::msear_as_a_size_t(pos), std::min(mse::msear_as_a_size_t(n), mse::msear_as_a_size_t((*this).size()) - mse::msear_as_a_size_t(pos)));
 		}
 		typedef typename std::conditional<mse::impl::is_xscope<_TRAIterator>::value, TXScopeRandomAccessConstSection, TRandomAccessConstSection<_TRAIterator> >::type subsection_t;
-		subsection_t subsection_pv(size_type pos = 0, size_type n = npos) const {
+		MSE_CONSTEXPR20 subsection_t subsection_pv(size_type pos = 0, size_type n = npos) const {
 			if (pos > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - TRandomAccessConstSection<_TRAIterator> subsection() const - TXScopeRandomAccessConstSection")); }
 			return subsection_t((*this).m_start_iter + mse::msear_as_a_size_t(pos), std::min(mse::msear_as_a_size_t(n), mse::msear_as_a_size_t((*this).size()) - mse::msear_as_a_size_t(pos)));
 		}
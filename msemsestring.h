@@ -12,6 +12,7 @@
 #include <iostream>
 #include "msemsevector.h"
 #include "msealgorithm.h"
+#include "mserefcounting.h"
 #ifdef MSE_HAS_CXX17
 #include <string_view>
 #endif /* MSE_HAS_CXX17 */
@@ -35,6 +36,42 @@
 #include <stdexcept>
 //include <__debug>
 
+/* On x86-64 the (single byte character) search functions used by string views, string sections and nii_string are
+vectorized. SSE2 is part of the x86-64 baseline, and AVX2 kernels are selected at run-time (via CPUID) when supported.
+Define MSE_STRING_SIMD_DISABLED to use only the portable scalar implementations, or MSE_STRING_SIMD_AVX2_DISABLED to
+restrict the vectorized implementations to SSE2. */
+#ifndef MSE_STRING_SIMD_DISABLED
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define MSE_IMPL_STRING_SIMD_X86
+#endif /*(defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))*/
+#endif /*!MSE_STRING_SIMD_DISABLED*/
+
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cerrno>
+#include <system_error>
+#ifdef MSE_HAS_CXX17
+#ifdef __has_include
+#if __has_include(<charconv>)
+#include <charconv>
+#endif /*__has_include(<charconv>)*/
+#endif /*__has_include*/
+#endif /* MSE_HAS_CXX17 */
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif /*_MSC_VER*/
+
+#ifdef MSE_IMPL_STRING_SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#define MSE_IMPL_STRING_SIMD_TARGET_AVX2
+#else /*_MSC_VER*/
+#define MSE_IMPL_STRING_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif /*_MSC_VER*/
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
+
 #ifdef _MSC_VER
 #pragma warning( push )  
 #pragma warning( disable : 4505 4522 )
@@ -208,6 +245,615 @@ namespace mse {
 
 			typedef decltype(std::declval<int*>() - std::declval<int*>()) ptrdiff_t;
 
+#ifdef MSE_IMPL_STRING_SIMD_X86
+			/* Vectorized search kernels for single byte character types. The kernels operate on "candidate positions" and
+			are parameterized by a "matcher" that yields a bit mask of the (potentially) matching positions in a block and
+			verifies individual candidates. */
+
+			inline unsigned int z_simd_lowest_set_bit_index(uint32_t mask) {
+#ifdef _MSC_VER
+				unsigned long index = 0;
+				_BitScanForward(&index, mask);
+				return static_cast<unsigned int>(index);
+#else /*_MSC_VER*/
+				return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif /*_MSC_VER*/
+			}
+			inline unsigned int z_simd_highest_set_bit_index(uint32_t mask) {
+#ifdef _MSC_VER
+				unsigned long index = 0;
+				_BitScanReverse(&index, mask);
+				return static_cast<unsigned int>(index);
+#else /*_MSC_VER*/
+				return static_cast<unsigned int>(31 - __builtin_clz(mask));
+#endif /*_MSC_VER*/
+			}
+
+			inline bool z_simd_detect_avx2() {
+#ifdef MSE_STRING_SIMD_AVX2_DISABLED
+				return false;
+#elif defined(_MSC_VER)
+				int info[4] = { 0 };
+				__cpuid(info, 0);
+				if (7 > info[0]) {
+					return false;
+				}
+				__cpuid(info, 1);
+				const bool osxsave_and_avx = ((info[2] & (1 << 27)) && (info[2] & (1 << 28)));
+				if ((!osxsave_and_avx) || (6 != (_xgetbv(0) & 6))) {
+					/* The OS does not preserve the ymm registers. */
+					return false;
+				}
+				__cpuidex(info, 7, 0);
+				return (0 != (info[1] & (1 << 5)));
+#else /*_MSC_VER*/
+				__builtin_cpu_init();
+				return (0 != __builtin_cpu_supports("avx2"));
+#endif /*_MSC_VER*/
+			}
+			inline bool z_simd_has_avx2() {
+				static const bool s_has_avx2 = z_simd_detect_avx2();
+				return s_has_avx2;
+			}
+
+			/* sse2 matchers */
+			class z_sse2_char_matcher {
+			public:
+				explicit z_sse2_char_matcher(char c) : m_c(c), m_vc(_mm_set1_epi8(c)) {}
+				uint32_t mask(const char* q) const {
+					const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+					return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, m_vc)));
+				}
+				bool verify(const char*) const { return true; }
+				bool match_at(const char* q) const { return (m_c == *q); }
+			private:
+				char m_c;
+				__m128i m_vc;
+			};
+			/* Candidates are filtered on the first and last characters of the (at least two character) pattern. */
+			class z_sse2_substring_matcher {
+			public:
+				z_sse2_substring_matcher(const char* s, size_t n) : m_s(s), m_n(n), m_vfirst(_mm_set1_epi8(s[0])), m_vlast(_mm_set1_epi8(s[n - 1])) {}
+				uint32_t mask(const char* q) const {
+					const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+					const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q + m_n - 1));
+					return static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, m_vfirst), _mm_cmpeq_epi8(block_last, m_vlast))));
+				}
+				bool verify(const char* q) const { return (0 == std::memcmp(q + 1, m_s + 1, m_n - 2)); }
+				bool match_at(const char* q) const { return (m_s[0] == q[0]) && (m_s[m_n - 1] == q[m_n - 1]) && verify(q); }
+			private:
+				const char* m_s;
+				size_t m_n;
+				__m128i m_vfirst;
+				__m128i m_vlast;
+			};
+			/* Compares against each member of a (small) character set. */
+			class z_sse2_small_char_set_matcher {
+			public:
+				z_sse2_small_char_set_matcher(const char* s, size_t n) : m_s(s), m_n(n) {
+					for (size_t i = 0; i < n; i += 1) {
+						m_vset[i] = _mm_set1_epi8(s[i]);
+					}
+				}
+				uint32_t mask(const char* q) const {
+					const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+					__m128i matches = _mm_cmpeq_epi8(block, m_vset[0]);
+					for (size_t i = 1; i < m_n; i += 1) {
+						matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, m_vset[i]));
+					}
+					return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+				}
+				bool verify(const char*) const { return true; }
+				bool match_at(const char* q) const { return (nullptr != std::memchr(m_s, *q, m_n)); }
+
+				static const size_t sc_max_set_size = 16;
+			private:
+				const char* m_s;
+				size_t m_n;
+				__m128i m_vset[sc_max_set_size];
+			};
+
+			template<class _TMatcher>
+			inline const char* z_sse2_scan_forward(const char* p, size_t num_candidates, const _TMatcher& matcher) {
+				size_t i = 0;
+				for (; i + 16 <= num_candidates; i += 16) {
+					uint32_t mask = matcher.mask(p + i);
+					while (0 != mask) {
+						const char* candidate = p + i + z_simd_lowest_set_bit_index(mask);
+						if (matcher.verify(candidate)) {
+							return candidate;
+						}
+						mask &= (mask - 1);
+					}
+				}
+				for (; i < num_candidates; i += 1) {
+					if (matcher.match_at(p + i)) {
+						return p + i;
+					}
+				}
+				return nullptr;
+			}
+			template<class _TMatcher>
+			inline const char* z_sse2_scan_backward(const char* p, size_t num_candidates, const _TMatcher& matcher) {
+				size_t i = num_candidates;
+				while (16 <= i) {
+					i -= 16;
+					uint32_t mask = matcher.mask(p + i);
+					while (0 != mask) {
+						const unsigned int bit_index = z_simd_highest_set_bit_index(mask);
+						const char* candidate = p + i + bit_index;
+						if (matcher.verify(candidate)) {
+							return candidate;
+						}
+						mask &= ~(uint32_t(1) << bit_index);
+					}
+				}
+				while (0 != i) {
+					i -= 1;
+					if (matcher.match_at(p + i)) {
+						return p + i;
+					}
+				}
+				return nullptr;
+			}
+
+			/* avx2 matchers */
+			class z_avx2_char_matcher {
+			public:
+				MSE_IMPL_STRING_SIMD_TARGET_AVX2 explicit z_avx2_char_matcher(char c) : m_c(c), m_vc(_mm256_set1_epi8(c)) {}
+				MSE_IMPL_STRING_SIMD_TARGET_AVX2 uint32_t mask(const char* q) const {
+					const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q));
+					return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, m_vc)));
+				}
+				bool verify(const char*) const { return true; }
+				bool match_at(const char* q) const { return (m_c == *q); }
+			private:
+				char m_c;
+				__m256i m_vc;
+			};
+			class z_avx2_substring_matcher {
+			public:
+				MSE_IMPL_STRING_SIMD_TARGET_AVX2 z_avx2_substring_matcher(const char* s, size_t n) : m_s(s), m_n(n), m_vfirst(_mm256_set1_epi8(s[0])), m_vlast(_mm256_set1_epi8(s[n - 1])) {}
+				MSE_IMPL_STRING_SIMD_TARGET_AVX2 uint32_t mask(const char* q) const {
+					const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q));
+					const __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q + m_n - 1));
+					return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first, m_vfirst), _mm256_cmpeq_epi8(block_last, m_vlast))));
+				}
+				bool verify(const char* q) const { return (0 == std::memcmp(q + 1, m_s + 1, m_n - 2)); }
+				bool match_at(const char* q) const { return (m_s[0] == q[0]) && (m_s[m_n - 1] == q[m_n - 1]) && verify(q); }
+			private:
+				const char* m_s;
+				size_t m_n;
+				__m256i m_vfirst;
+				__m256i m_vlast;
+			};
+			/* Character sets of any size are represented as a 256 bit bitmap, indexed by the low nibble (row) and high
+			nibble (bit) of the character, so that membership of 32 characters can be tested with a couple of shuffles. */
+			class z_avx2_char_set_matcher {
+			public:
+				MSE_IMPL_STRING_SIMD_TARGET_AVX2 z_avx2_char_set_matcher(const char* s, size_t n) {
+					alignas(16) unsigned char rows_for_high_nibbles_0_to_7[16] = { 0 };
+					alignas(16) unsigned char rows_for_high_nibbles_8_to_15[16] = { 0 };
+					for (size_t i = 0; i < n; i += 1) {
+						const unsigned char uc = static_cast<unsigned char>(s[i]);
+						m_bitmap[uc >> 3] |= static_cast<unsigned char>(1 << (uc & 7));
+						if (8 > (uc >> 4)) {
+							rows_for_high_nibbles_0_to_7[uc & 15] |= static_cast<unsigned char>(1 << (uc >> 4));
+						}
+						else {
+							rows_for_high_nibbles_8_to_15[uc & 15] |= static_cast<unsigned char>(1 << ((uc >> 4) - 8));
+						}
+					}
+					m_vrows_lo = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(rows_for_high_nibbles_0_to_7)));
+					m_vrows_hi = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(rows_for_high_nibbles_8_to_15)));
+					m_vbit_for_high_nibble = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128
+						, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+				}
+				MSE_IMPL_STRING_SIMD_TARGET_AVX2 uint32_t mask(const char* q) const {
+					const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q));
+					const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+					const __m256i low_nibbles = _mm256_and_si256(block, nibble_mask);
+					const __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble_mask);
+					const __m256i rows_lo = _mm256_shuffle_epi8(m_vrows_lo, low_nibbles);
+					const __m256i rows_hi = _mm256_shuffle_epi8(m_vrows_hi, low_nibbles);
+					const __m256i high_nibble_is_8_or_more = _mm256_cmpgt_epi8(high_nibbles, _mm256_set1_epi8(7));
+					const __m256i rows = _mm256_blendv_epi8(rows_lo, rows_hi, high_nibble_is_8_or_more);
+					const __m256i bits = _mm256_shuffle_epi8(m_vbit_for_high_nibble, high_nibbles);
+					const __m256i non_members = _mm256_cmpeq_epi8(_mm256_and_si256(rows, bits), _mm256_setzero_si256());
+					return ~static_cast<uint32_t>(_mm256_movemask_epi8(non_members));
+				}
+				bool verify(const char*) const { return true; }
+				bool match_at(const char* q) const {
+					const unsigned char uc = static_cast<unsigned char>(*q);
+					return (0 != (m_bitmap[uc >> 3] & (1 << (uc & 7))));
+				}
+			private:
+				unsigned char m_bitmap[32] = { 0 };
+				__m256i m_vrows_lo;
+				__m256i m_vrows_hi;
+				__m256i m_vbit_for_high_nibble;
+			};
+
+			template<class _TMatcher>
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline const char* z_avx2_scan_forward(const char* p, size_t num_candidates, const _TMatcher& matcher) {
+				size_t i = 0;
+				for (; i + 32 <= num_candidates; i += 32) {
+					uint32_t mask = matcher.mask(p + i);
+					while (0 != mask) {
+						const char* candidate = p + i + z_simd_lowest_set_bit_index(mask);
+						if (matcher.verify(candidate)) {
+							return candidate;
+						}
+						mask &= (mask - 1);
+					}
+				}
+				for (; i < num_candidates; i += 1) {
+					if (matcher.match_at(p + i)) {
+						return p + i;
+					}
+				}
+				return nullptr;
+			}
+			template<class _TMatcher>
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline const char* z_avx2_scan_backward(const char* p, size_t num_candidates, const _TMatcher& matcher) {
+				size_t i = num_candidates;
+				while (32 <= i) {
+					i -= 32;
+					uint32_t mask = matcher.mask(p + i);
+					while (0 != mask) {
+						const unsigned int bit_index = z_simd_highest_set_bit_index(mask);
+						const char* candidate = p + i + bit_index;
+						if (matcher.verify(candidate)) {
+							return candidate;
+						}
+						mask &= ~(uint32_t(1) << bit_index);
+					}
+				}
+				while (0 != i) {
+					i -= 1;
+					if (matcher.match_at(p + i)) {
+						return p + i;
+					}
+				}
+				return nullptr;
+			}
+
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline const char* z_avx2_find_char(const char* p, size_t n, char c) {
+				return z_avx2_scan_forward(p, n, z_avx2_char_matcher(c));
+			}
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline const char* z_avx2_rfind_char(const char* p, size_t n, char c) {
+				return z_avx2_scan_backward(p, n, z_avx2_char_matcher(c));
+			}
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline const char* z_avx2_find_substring(const char* p, size_t n, const char* s, size_t s_n) {
+				return z_avx2_scan_forward(p, n - s_n + 1, z_avx2_substring_matcher(s, s_n));
+			}
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline const char* z_avx2_rfind_substring(const char* p, size_t n, const char* s, size_t s_n) {
+				return z_avx2_scan_backward(p, n - s_n + 1, z_avx2_substring_matcher(s, s_n));
+			}
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline const char* z_avx2_find_first_of(const char* p, size_t n, const char* s, size_t s_n) {
+				return z_avx2_scan_forward(p, n, z_avx2_char_set_matcher(s, s_n));
+			}
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline const char* z_avx2_find_last_of(const char* p, size_t n, const char* s, size_t s_n) {
+				return z_avx2_scan_backward(p, n, z_avx2_char_set_matcher(s, s_n));
+			}
+
+			/* The following functions return a pointer to the found element, or nullptr if there is no match. */
+
+			inline const char* z_simd_find_char(const char* p, size_t n, char c) {
+				if (z_simd_has_avx2()) {
+					return z_avx2_find_char(p, n, c);
+				}
+				return z_sse2_scan_forward(p, n, z_sse2_char_matcher(c));
+			}
+			inline const char* z_simd_rfind_char(const char* p, size_t n, char c) {
+				if (z_simd_has_avx2()) {
+					return z_avx2_rfind_char(p, n, c);
+				}
+				return z_sse2_scan_backward(p, n, z_sse2_char_matcher(c));
+			}
+			inline const char* z_simd_find_substring(const char* p, size_t n, const char* s, size_t s_n) {
+				if ((0 == s_n) || (s_n > n)) {
+					return (0 == s_n) ? p : nullptr;
+				}
+				if (1 == s_n) {
+					return z_simd_find_char(p, n, s[0]);
+				}
+				if (z_simd_has_avx2()) {
+					return z_avx2_find_substring(p, n, s, s_n);
+				}
+				return z_sse2_scan_forward(p, n - s_n + 1, z_sse2_substring_matcher(s, s_n));
+			}
+			inline const char* z_simd_rfind_substring(const char* p, size_t n, const char* s, size_t s_n) {
+				if ((0 == s_n) || (s_n > n)) {
+					return (0 == s_n) ? (p + n) : nullptr;
+				}
+				if (1 == s_n) {
+					return z_simd_rfind_char(p, n, s[0]);
+				}
+				if (z_simd_has_avx2()) {
+					return z_avx2_rfind_substring(p, n, s, s_n);
+				}
+				return z_sse2_scan_backward(p, n - s_n + 1, z_sse2_substring_matcher(s, s_n));
+			}
+			inline const char* z_simd_find_first_of(const char* p, size_t n, const char* s, size_t s_n) {
+				if (0 == s_n) {
+					return nullptr;
+				}
+				if (z_simd_has_avx2()) {
+					return z_avx2_find_first_of(p, n, s, s_n);
+				}
+				if (z_sse2_small_char_set_matcher::sc_max_set_size < s_n) {
+					/* Without (SSSE3) byte shuffles, large character sets are handled by the scalar implementation. */
+					for (size_t i = 0; i < n; i += 1) {
+						if (nullptr != std::memchr(s, p[i], s_n)) {
+							return p + i;
+						}
+					}
+					return nullptr;
+				}
+				return z_sse2_scan_forward(p, n, z_sse2_small_char_set_matcher(s, s_n));
+			}
+			inline const char* z_simd_find_last_of(const char* p, size_t n, const char* s, size_t s_n) {
+				if (0 == s_n) {
+					return nullptr;
+				}
+				if (z_simd_has_avx2()) {
+					return z_avx2_find_last_of(p, n, s, s_n);
+				}
+				if (z_sse2_small_char_set_matcher::sc_max_set_size < s_n) {
+					for (size_t i = n; 0 != i;) {
+						i -= 1;
+						if (nullptr != std::memchr(s, p[i], s_n)) {
+							return p + i;
+						}
+					}
+					return nullptr;
+				}
+				return z_sse2_scan_backward(p, n, z_sse2_small_char_set_matcher(s, s_n));
+			}
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
+
+			/* UTF-8 validation. z_utf8_decode() returns the length of the (valid) UTF-8 encoded code point at the given
+			position (storing the decoded value), or zero if the sequence at that position is invalid or truncated. */
+			template<typename _TBytes>
+			inline size_t z_utf8_decode(const _TBytes& bytes, size_t pos, size_t size, char32_t& code_point) {
+				const unsigned int b0 = static_cast<unsigned char>(bytes[pos]);
+				if (0x80 > b0) {
+					code_point = char32_t(b0);
+					return 1;
+				}
+				size_t length = 0;
+				unsigned int min_b1 = 0x80;
+				unsigned int max_b1 = 0xBF;
+				char32_t cp = 0;
+				if (0xC2 > b0) {
+					/* continuation byte, or overlong two byte sequence */
+					return 0;
+				}
+				else if (0xE0 > b0) {
+					length = 2;
+					cp = char32_t(b0 & 0x1F);
+				}
+				else if (0xF0 > b0) {
+					length = 3;
+					cp = char32_t(b0 & 0x0F);
+					if (0xE0 == b0) {
+						min_b1 = 0xA0; /* overlong */
+					}
+					else if (0xED == b0) {
+						max_b1 = 0x9F; /* surrogate */
+					}
+				}
+				else if (0xF5 > b0) {
+					length = 4;
+					cp = char32_t(b0 & 0x07);
+					if (0xF0 == b0) {
+						min_b1 = 0x90; /* overlong */
+					}
+					else if (0xF4 == b0) {
+						max_b1 = 0x8F; /* beyond U+10FFFF */
+					}
+				}
+				else {
+					return 0;
+				}
+				if (size - pos < length) {
+					return 0;
+				}
+				for (size_t i = 1; length > i; i += 1) {
+					const unsigned int b = static_cast<unsigned char>(bytes[pos + i]);
+					if ((1 == i) ? ((min_b1 > b) || (max_b1 < b)) : (0x80 != (b & 0xC0))) {
+						return 0;
+					}
+					cp = char32_t((cp << 6) | (b & 0x3F));
+				}
+				code_point = cp;
+				return length;
+			}
+			/* These return the position of the first byte that is not part of a valid UTF-8 sequence, or size_t(-1) if
+			there isn't one. */
+			template<typename _TBytes>
+			inline size_t z_utf8_find_invalid_scalar(const _TBytes& bytes, size_t pos, size_t size) {
+				char32_t code_point = 0;
+				while (size > pos) {
+					const size_t length = z_utf8_decode(bytes, pos, size, code_point);
+					if (0 == length) {
+						return pos;
+					}
+					pos += length;
+				}
+				return size_t(-1);
+			}
+			/* Returns the position of the start of the last sequence that begins before the given position (if that
+			sequence might extend to or beyond the given position). */
+			inline size_t z_utf8_sequence_boundary_at_or_before(const unsigned char* p, size_t pos) {
+				for (size_t k = 1; (3 >= k) && (k <= pos); k += 1) {
+					const unsigned int b = p[pos - k];
+					if (0xC0 <= b) {
+						return pos - k;
+					}
+					if (0x80 > b) {
+						break;
+					}
+				}
+				return pos;
+			}
+
+#ifdef MSE_IMPL_STRING_SIMD_X86
+			/* Skips over blocks of ascii characters sixteen at a time. */
+			inline size_t z_sse2_utf8_find_invalid(const unsigned char* p, size_t pos, size_t n) {
+				char32_t code_point = 0;
+				while (n > pos) {
+					if (16 <= n - pos) {
+						const uint32_t mask = uint32_t(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + pos))));
+						if (0 == mask) {
+							pos += 16;
+							continue;
+						}
+						pos += z_simd_lowest_set_bit_index(mask);
+					}
+					const size_t length = z_utf8_decode(p, pos, n, code_point);
+					if (0 == length) {
+						return pos;
+					}
+					pos += length;
+				}
+				return size_t(-1);
+			}
+
+			/* An implementation of the "lookup" algorithm described in "Validating UTF-8 In Less Than One Instruction
+			Per Byte" (Keiser & Lemire). Each byte is classified (via table lookups on the high and low nibbles of the
+			preceding byte and the high nibble of the byte itself) into a set of possible error conditions, and the
+			errors are those conditions common to all three classifications. When an error is detected in a block, the
+			(exact) position of the first invalid byte is determined by the scalar implementation. */
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline __m256i z_avx2_utf8_block_errors(__m256i input, __m256i prev_input) {
+				const char TOO_SHORT = 0x01; /* lead byte not followed by a continuation byte */
+				const char TOO_LONG = 0x02; /* ascii followed by a continuation byte */
+				const char OVERLONG_3 = 0x04;
+				const char TOO_LARGE = 0x08;
+				const char SURROGATE = 0x10;
+				const char OVERLONG_2 = 0x20;
+				const char TOO_LARGE_1000 = 0x40;
+				const char OVERLONG_4 = 0x40;
+				const char TWO_CONTS = char(0x80); /* continuation byte followed by a continuation byte */
+				const char CARRY = char(TOO_SHORT | TOO_LONG | TWO_CONTS);
+
+				const __m256i byte_1_high_table = _mm256_setr_epi8(
+					TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+					TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+					char(TOO_SHORT | OVERLONG_2), TOO_SHORT, char(TOO_SHORT | OVERLONG_3 | SURROGATE), char(TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4),
+					TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+					TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+					char(TOO_SHORT | OVERLONG_2), TOO_SHORT, char(TOO_SHORT | OVERLONG_3 | SURROGATE), char(TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4));
+				const char L0 = char(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4);
+				const char L1 = char(CARRY | OVERLONG_2);
+				const char L4 = char(CARRY | TOO_LARGE);
+				const char L5 = char(CARRY | TOO_LARGE | TOO_LARGE_1000);
+				const char LD = char(CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE);
+				const __m256i byte_1_low_table = _mm256_setr_epi8(
+					L0, L1, CARRY, CARRY, L4, L5, L5, L5, L5, L5, L5, L5, L5, LD, L5, L5,
+					L0, L1, CARRY, CARRY, L4, L5, L5, L5, L5, L5, L5, L5, L5, LD, L5, L5);
+				const char H8 = char(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4);
+				const char H9 = char(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE);
+				const char HA = char(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE);
+				const __m256i byte_2_high_table = _mm256_setr_epi8(
+					TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+					H8, H9, HA, HA, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+					TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+					H8, H9, HA, HA, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT);
+
+				const __m256i low_nibble_mask = _mm256_set1_epi8(0x0F);
+				/* The input shifted (across lanes) by one, two and three bytes, with the preceding block's last bytes
+				shifted in. */
+				const __m256i prev_shifted_in = _mm256_permute2x128_si256(prev_input, input, 0x21);
+				const __m256i prev1 = _mm256_alignr_epi8(input, prev_shifted_in, 15);
+				const __m256i prev2 = _mm256_alignr_epi8(input, prev_shifted_in, 14);
+				const __m256i prev3 = _mm256_alignr_epi8(input, prev_shifted_in, 13);
+
+				const __m256i byte_1_high = _mm256_shuffle_epi8(byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble_mask));
+				const __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, low_nibble_mask));
+				const __m256i byte_2_high = _mm256_shuffle_epi8(byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble_mask));
+				const __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+				/* The third and fourth bytes of three and four byte sequences must be continuation bytes (which the
+				special cases classify as TWO_CONTS). */
+				const __m256i is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(char(0xE0 - 0x80)));
+				const __m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(char(0xF0 - 0x80)));
+				const __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(TWO_CONTS));
+				return _mm256_xor_si256(must_be_continuation, special_cases);
+			}
+			MSE_IMPL_STRING_SIMD_TARGET_AVX2 inline size_t z_avx2_utf8_find_invalid(const unsigned char* p, size_t n) {
+				__m256i prev_input = _mm256_setzero_si256();
+				bool prev_input_is_ascii = true;
+				size_t pos = 0;
+				for (; 32 <= n - pos; pos += 32) {
+					const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + pos));
+					const bool input_is_ascii = (0 == _mm256_movemask_epi8(input));
+					if (!(input_is_ascii && prev_input_is_ascii)) {
+						const __m256i errors = z_avx2_utf8_block_errors(input, prev_input);
+						if (!_mm256_testz_si256(errors, errors)) {
+							break;
+						}
+					}
+					prev_input = input;
+					prev_input_is_ascii = input_is_ascii;
+				}
+				/* The (remaining) blocks, and any sequence that straddles the preceding block, are handled by the
+				non-avx2 implementation. */
+				return z_sse2_utf8_find_invalid(p, z_utf8_sequence_boundary_at_or_before(p, pos), n);
+			}
+
+			inline size_t z_simd_utf8_find_invalid(const unsigned char* p, size_t n) {
+				if (z_simd_has_avx2()) {
+					return z_avx2_utf8_find_invalid(p, n);
+				}
+				return z_sse2_utf8_find_invalid(p, 0, n);
+			}
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
+
+			inline size_t z_utf8_find_invalid(const unsigned char* p, size_t n) {
+#ifdef MSE_IMPL_STRING_SIMD_X86
+				return z_simd_utf8_find_invalid(p, n);
+#else /*MSE_IMPL_STRING_SIMD_X86*/
+				return z_utf8_find_invalid_scalar(p, 0, n);
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
+			}
+
+			/* Whether the vectorized implementations apply to the given character and traits types. */
+			template<class _CharT, class _Traits>
+			struct z_is_simd_searchable : std::integral_constant<bool,
+#ifdef MSE_IMPL_STRING_SIMD_X86
+				(1 == sizeof(_CharT)) && std::is_integral<_CharT>::value && std::is_same<_Traits, std::char_traits<_CharT> >::value
+#else /*MSE_IMPL_STRING_SIMD_X86*/
+				false
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
+			> {};
+
+			/* These return a pointer to the found element, or nullptr if there is no match. */
+			template<class _CharT, class _Traits>
+			inline const _CharT* z_find_char_dispatch(std::false_type, const _CharT* z_p, size_t z_n, _CharT z_c) {
+				return _Traits::find(z_p, z_n, z_c);
+			}
+			template<class _CharT, class _Traits>
+			inline const _CharT* z_rfind_char_dispatch(std::false_type, const _CharT* z_p, size_t z_n, _CharT z_c) {
+				for (const _CharT* z_ps = z_p + z_n; z_ps != z_p;)
+				{
+					if (_Traits::eq(*--z_ps, z_c))
+						return z_ps;
+				}
+				return nullptr;
+			}
+#ifdef MSE_IMPL_STRING_SIMD_X86
+			template<class _CharT, class _Traits>
+			inline const _CharT* z_find_char_dispatch(std::true_type, const _CharT* z_p, size_t z_n, _CharT z_c) {
+				return reinterpret_cast<const _CharT*>(z_simd_find_char(reinterpret_cast<const char*>(z_p), z_n, static_cast<char>(z_c)));
+			}
+			template<class _CharT, class _Traits>
+			inline const _CharT* z_rfind_char_dispatch(std::true_type, const _CharT* z_p, size_t z_n, _CharT z_c) {
+				return reinterpret_cast<const _CharT*>(z_simd_rfind_char(reinterpret_cast<const char*>(z_p), z_n, static_cast<char>(z_c)));
+			}
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
+
 			// z_str_find
 			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
 			inline _SizeT _LIBCPP_CONSTEXPR_AFTER_CXX11 _LIBCPP_INLINE_VISIBILITY
@@ -216,7 +862,8 @@ namespace mse {
 			{
 				if (z_pos >= z_sz)
 					return z_npos;
-				const _CharT* z_r = _Traits::find(z_p + z_pos, z_sz - z_pos, z_c);
+				const _CharT* z_r = z_find_char_dispatch<_CharT, _Traits>(typename z_is_simd_searchable<_CharT, _Traits>::type()
+					, z_p + z_pos, z_sz - z_pos, z_c);
 				if (z_r == 0)
 					return z_npos;
 				return static_cast<_SizeT>(z_r - z_p);
@@ -259,6 +906,20 @@ namespace mse {
 					++z_first1;
 				}
 			}
+			template <class _CharT, class _Traits>
+			inline const _CharT* z_search_substring_dispatch(std::false_type, const _CharT *z_first1, const _CharT *z_last1,
+				const _CharT *z_first2, const _CharT *z_last2) {
+				return z_search_substring<_CharT, _Traits>(z_first1, z_last1, z_first2, z_last2);
+			}
+#ifdef MSE_IMPL_STRING_SIMD_X86
+			template <class _CharT, class _Traits>
+			inline const _CharT* z_search_substring_dispatch(std::true_type, const _CharT *z_first1, const _CharT *z_last1,
+				const _CharT *z_first2, const _CharT *z_last2) {
+				const char* z_r = z_simd_find_substring(reinterpret_cast<const char*>(z_first1), size_t(z_last1 - z_first1)
+					, reinterpret_cast<const char*>(z_first2), size_t(z_last2 - z_first2));
+				return z_r ? reinterpret_cast<const _CharT*>(z_r) : z_last1;
+			}
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
 
 			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
 			inline _SizeT _LIBCPP_CONSTEXPR_AFTER_CXX11 _LIBCPP_INLINE_VISIBILITY
@@ -271,8 +932,8 @@ namespace mse {
 				if (z_n == 0) // There is nothing to search, just return z_pos.
 					return z_pos;
 
-				const _CharT *z_r = z_search_substring<_CharT, _Traits>(
-					z_p + z_pos, z_p + z_sz, z_s, z_s + z_n);
+				const _CharT *z_r = z_search_substring_dispatch<_CharT, _Traits>(typename z_is_simd_searchable<_CharT, _Traits>::type()
+					, z_p + z_pos, z_p + z_sz, z_s, z_s + z_n);
 
 				if (z_r == z_p + z_sz)
 					return z_npos;
@@ -293,13 +954,35 @@ namespace mse {
 					++z_pos;
 				else
 					z_pos = z_sz;
-				for (const _CharT* z_ps = z_p + z_pos; z_ps != z_p;)
-				{
-					if (_Traits::eq(*--z_ps, z_c))
-						return static_cast<_SizeT>(z_ps - z_p);
-				}
-				return z_npos;
+				const _CharT* z_r = z_rfind_char_dispatch<_CharT, _Traits>(typename z_is_simd_searchable<_CharT, _Traits>::type()
+					, z_p, z_pos, z_c);
+				if (z_r == 0)
+					return z_npos;
+				return static_cast<_SizeT>(z_r - z_p);
+			}
+
+			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
+			inline _SizeT _LIBCPP_CONSTEXPR_AFTER_CXX11 _LIBCPP_INLINE_VISIBILITY
+				z_str_rfind_helper1(std::false_type, const _CharT *z_p, _SizeT z_pos,
+					const _CharT* z_s, _SizeT z_n) _NOEXCEPT
+			{
+				const _CharT* z_r = _VSTD::find_end(
+					z_p, z_p + z_pos, z_s, z_s + z_n, _Traits::eq);
+				if (z_n > 0 && z_r == z_p + z_pos)
+					return z_npos;
+				return static_cast<_SizeT>(z_r - z_p);
+			}
+#ifdef MSE_IMPL_STRING_SIMD_X86
+			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
+			inline _SizeT z_str_rfind_helper1(std::true_type, const _CharT *z_p, _SizeT z_pos,
+					const _CharT* z_s, _SizeT z_n) _NOEXCEPT
+			{
+				const char* z_r = z_simd_rfind_substring(reinterpret_cast<const char*>(z_p), z_pos, reinterpret_cast<const char*>(z_s), z_n);
+				if (z_r == 0)
+					return z_npos;
+				return static_cast<_SizeT>(reinterpret_cast<const _CharT*>(z_r) - z_p);
 			}
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
 
 			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
 			inline _SizeT _LIBCPP_CONSTEXPR_AFTER_CXX11 _LIBCPP_INLINE_VISIBILITY
@@ -307,16 +990,14 @@ namespace mse {
 					const _CharT* z_s, _SizeT z_pos, _SizeT z_n) _NOEXCEPT
 			{
 				z_pos = _VSTD::min(z_pos, z_sz);
+				if (z_n == 0) // An empty pattern matches at z_pos (even if z_p is null).
+					return z_pos;
 				if (z_n < z_sz - z_pos)
 					z_pos += z_n;
 				else
 					z_pos = z_sz;
-				const _CharT* z_r = _VSTD::find_end(
-					z_p, z_p + z_pos, z_s, z_s + z_n, _Traits::eq,
-					std::random_access_iterator_tag(), std::random_access_iterator_tag());
-				if (z_n > 0 && z_r == z_p + z_pos)
-					return z_npos;
-				return static_cast<_SizeT>(z_r - z_p);
+				return z_str_rfind_helper1<_CharT, _SizeT, _Traits, z_npos>(typename z_is_simd_searchable<_CharT, _Traits>::type()
+					, z_p, z_pos, z_s, z_n);
 			}
 
 			template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -334,20 +1015,65 @@ namespace mse {
 			// z_str_find_first_of
 			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
 			inline _SizeT _LIBCPP_CONSTEXPR_AFTER_CXX11 _LIBCPP_INLINE_VISIBILITY
-				z_str_find_first_of(const _CharT *z_p, _SizeT z_sz,
+				z_str_find_first_of_helper1(std::false_type, const _CharT *z_p, _SizeT z_sz,
 					const _CharT* z_s, _SizeT z_pos, _SizeT z_n) _NOEXCEPT
 			{
-				if (z_pos >= z_sz || z_n == 0)
-					return z_npos;
 				const _CharT* z_r = /*_VSTD::*/z_find_first_of_ce
 				(z_p + z_pos, z_p + z_sz, z_s, z_s + z_n, _Traits::eq);
 				if (z_r == z_p + z_sz)
 					return z_npos;
 				return static_cast<_SizeT>(z_r - z_p);
 			}
+#ifdef MSE_IMPL_STRING_SIMD_X86
+			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
+			inline _SizeT z_str_find_first_of_helper1(std::true_type, const _CharT *z_p, _SizeT z_sz,
+					const _CharT* z_s, _SizeT z_pos, _SizeT z_n) _NOEXCEPT
+			{
+				const char* z_r = z_simd_find_first_of(reinterpret_cast<const char*>(z_p + z_pos), z_sz - z_pos, reinterpret_cast<const char*>(z_s), z_n);
+				if (z_r == 0)
+					return z_npos;
+				return static_cast<_SizeT>(reinterpret_cast<const _CharT*>(z_r) - z_p);
+			}
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
+
+			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
+			inline _SizeT _LIBCPP_CONSTEXPR_AFTER_CXX11 _LIBCPP_INLINE_VISIBILITY
+				z_str_find_first_of(const _CharT *z_p, _SizeT z_sz,
+					const _CharT* z_s, _SizeT z_pos, _SizeT z_n) _NOEXCEPT
+			{
+				if (z_pos >= z_sz || z_n == 0)
+					return z_npos;
+				return z_str_find_first_of_helper1<_CharT, _SizeT, _Traits, z_npos>(typename z_is_simd_searchable<_CharT, _Traits>::type()
+					, z_p, z_sz, z_s, z_pos, z_n);
+			}
 
 
 			// z_str_find_last_of
+			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
+			inline _SizeT _LIBCPP_CONSTEXPR_AFTER_CXX11 _LIBCPP_INLINE_VISIBILITY
+				z_str_find_last_of_helper1(std::false_type, const _CharT *z_p,
+					const _CharT* z_s, _SizeT z_pos, _SizeT z_n) _NOEXCEPT
+			{
+				for (const _CharT* z_ps = z_p + z_pos; z_ps != z_p;)
+				{
+					const _CharT* z_r = _Traits::find(z_s, z_n, *--z_ps);
+					if (z_r)
+						return static_cast<_SizeT>(z_ps - z_p);
+				}
+				return z_npos;
+			}
+#ifdef MSE_IMPL_STRING_SIMD_X86
+			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
+			inline _SizeT z_str_find_last_of_helper1(std::true_type, const _CharT *z_p,
+					const _CharT* z_s, _SizeT z_pos, _SizeT z_n) _NOEXCEPT
+			{
+				const char* z_r = z_simd_find_last_of(reinterpret_cast<const char*>(z_p), z_pos, reinterpret_cast<const char*>(z_s), z_n);
+				if (z_r == 0)
+					return z_npos;
+				return static_cast<_SizeT>(reinterpret_cast<const _CharT*>(z_r) - z_p);
+			}
+#endif /*MSE_IMPL_STRING_SIMD_X86*/
+
 			template<class _CharT, class _SizeT, class _Traits, _SizeT z_npos>
 			inline _SizeT _LIBCPP_CONSTEXPR_AFTER_CXX11 _LIBCPP_INLINE_VISIBILITY
 				z_str_find_last_of(const _CharT *z_p, _SizeT z_sz,
@@ -359,12 +1085,8 @@ namespace mse {
 						++z_pos;
 					else
 						z_pos = z_sz;
-					for (const _CharT* z_ps = z_p + z_pos; z_ps != z_p;)
-					{
-						const _CharT* z_r = _Traits::find(z_s, z_n, *--z_ps);
-						if (z_r)
-							return static_cast<_SizeT>(z_ps - z_p);
-					}
+					return z_str_find_last_of_helper1<_CharT, _SizeT, _Traits, z_npos>(typename z_is_simd_searchable<_CharT, _Traits>::type()
+						, z_p, z_s, z_pos, z_n);
 				}
 				return z_npos;
 			}
@@ -459,33 +1181,197 @@ namespace mse {
 				return (_Val);
 			}
 
-			template<class _Ptr>
-			inline _LIBCPP_INLINE_VISIBILITY
-				size_t z_do_string_hash(_Ptr z_p, _Ptr z_e)
-			{
-				typedef typename std::iterator_traits<_Ptr>::value_type value_type;
-				typedef decltype(sizeof(value_type)) l_size_type;
-				l_size_type num_bytes = (z_e - z_p) * sizeof(value_type);
-
-				if (true) {
-					return T_Hash_bytes(z_p, num_bytes);
+			/* A word-at-a-time hash (the "final" version of the public domain wyhash algorithm) of the little-endian byte
+			representation of the (integral) elements in [_First, _First + _Count). It's used by the std::hash<>
+			specializations of the string and string section types (unless MSE_LEGACY_STRING_HASH is defined, in which case
+			the string sections use the FNV-1a T_Hash_bytes() and strings delegate to std::hash<std::basic_string<> >).
+			Strings and contiguous string sections with the same contents produce the same hash value. */
+			namespace wyhash {
+				inline void mum(uint64_t& a, uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+					const unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+					a = static_cast<uint64_t>(r);
+					b = static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+					a = _umul128(a, b, &b);
+#else
+					const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+					const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+					uint64_t c = (t < rl) ? 1 : 0;
+					const uint64_t lo = t + (rm1 << 32);
+					c += (lo < t) ? 1 : 0;
+					const uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+					a = lo;
+					b = hi;
+#endif
+				}
+				inline uint64_t mix(uint64_t a, uint64_t b) {
+					mum(a, b);
+					return a ^ b;
 				}
-				else {
-					//return z_murmur2_or_cityhash<size_t>()(z_p, (z_e - z_p) * sizeof(value_type));
 
-					/* Rather than include a hash implementation, we'll just use the existing one for std::string. */
-					/* todo: check if C++17 is available, and if so, use std::basic_string_view's hash instead. */
-					std::string string1;
-					string1.resize(num_bytes);
-					char * bytesz_p = reinterpret_cast<char *>(z_p);
-					for (l_size_type i = 0; i < num_bytes; i += 1) {
-						string1[i] = *bytesz_p;
-						++bytesz_p;
+				static const uint64_t sc_secret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+				/* Reads (little-endian) words from a contiguous array of elements. */
+				class contiguous_reader {
+				public:
+					contiguous_reader(const unsigned char* p) : m_p(p) {}
+					uint64_t r8(size_t offset) const {
+						uint64_t v = 0;
+						std::memcpy(&v, m_p + offset, 8);
+						return from_little_endian(v);
 					}
-					std::hash<std::string> str_hash;
-					return str_hash(string1);
-				}
-			}
+					uint64_t r4(size_t offset) const {
+						uint32_t v = 0;
+						std::memcpy(&v, m_p + offset, 4);
+						return static_cast<uint32_t>(from_little_endian(v));
+					}
+					uint64_t r1(size_t offset) const { return m_p[offset]; }
+				private:
+					template<typename _TInt>
+					static uint64_t from_little_endian(_TInt v) {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+						_TInt retval = 0;
+						for (size_t i = 0; i < sizeof(_TInt); i += 1) {
+							retval = (retval << 8) | ((v >> (8 * i)) & 0xff);
+						}
+						return retval;
+#else
+						return v;
+#endif
+					}
+					const unsigned char* m_p;
+				};
+
+				/* Assembles words from the elements referenced by a (not necessarily contiguous) random access iterator. */
+				template<typename _TRAIterator>
+				class iterator_reader {
+				public:
+					typedef typename std::remove_cv<typename std::remove_reference<decltype(*std::declval<_TRAIterator>())>::type>::type element_t;
+					static_assert(std::is_integral<element_t>::value, "the element type must be an integral (character) type");
+					typedef typename std::make_unsigned<element_t>::type unsigned_element_t;
+
+					iterator_reader(const _TRAIterator& first) : m_first(first) {}
+					uint64_t r8(size_t offset) const {
+						uint64_t retval = 0;
+						for (size_t i = 0; i < 8; i += 1) {
+							retval |= r1(offset + i) << (8 * i);
+						}
+						return retval;
+					}
+					uint64_t r4(size_t offset) const {
+						uint64_t retval = 0;
+						for (size_t i = 0; i < 4; i += 1) {
+							retval |= r1(offset + i) << (8 * i);
+						}
+						return retval;
+					}
+					uint64_t r1(size_t offset) const {
+						const uint64_t element = static_cast<unsigned_element_t>(m_first[offset / sizeof(element_t)]);
+						return (element >> (8 * (offset % sizeof(element_t)))) & 0xff;
+					}
+				private:
+					const _TRAIterator& m_first;
+				};
+
+				template<typename _TReader>
+				inline uint64_t hash(const _TReader& reader, size_t len, uint64_t seed = 0) {
+					seed ^= mix(seed ^ sc_secret[0], sc_secret[1]);
+					uint64_t a = 0;
+					uint64_t b = 0;
+					if (16 >= len) {
+						if (4 <= len) {
+							a = (reader.r4(0) << 32) | reader.r4((len >> 3) << 2);
+							b = (reader.r4(len - 4) << 32) | reader.r4(len - 4 - ((len >> 3) << 2));
+						}
+						else if (0 < len) {
+							a = (reader.r1(0) << 16) | (reader.r1(len >> 1) << 8) | reader.r1(len - 1);
+						}
+					}
+					else {
+						size_t offset = 0;
+						size_t i = len;
+						if (48 < i) {
+							uint64_t see1 = seed;
+							uint64_t see2 = seed;
+							do {
+								seed = mix(reader.r8(offset) ^ sc_secret[1], reader.r8(offset + 8) ^ seed);
+								see1 = mix(reader.r8(offset + 16) ^ sc_secret[2], reader.r8(offset + 24) ^ see1);
+								see2 = mix(reader.r8(offset + 32) ^ sc_secret[3], reader.r8(offset + 40) ^ see2);
+								offset += 48;
+								i -= 48;
+							} while (48 < i);
+							seed ^= see1 ^ see2;
+						}
+						while (16 < i) {
+							seed = mix(reader.r8(offset) ^ sc_secret[1], reader.r8(offset + 8) ^ seed);
+							offset += 16;
+							i -= 16;
+						}
+						a = reader.r8(offset + i - 16);
+						b = reader.r8(offset + i - 8);
+					}
+					a ^= sc_secret[1];
+					b ^= seed;
+					mum(a, b);
+					return mix(a ^ sc_secret[0] ^ len, b ^ sc_secret[1]);
+				}
+			}
+
+			template <typename _TElement>
+			inline size_t T_Hash_contiguous_elements(const _TElement* _First, size_t _Count) _NOEXCEPT
+			{
+				static_assert(std::is_integral<_TElement>::value, "the element type must be an integral (character) type");
+				return static_cast<size_t>(wyhash::hash(wyhash::contiguous_reader(reinterpret_cast<const unsigned char*>(_First)), _Count * sizeof(_TElement)));
+			}
+			template <typename _TRAIterator>
+			inline size_t T_Hash_elements(const _TRAIterator& _First, size_t _Count)
+			{
+				typedef wyhash::iterator_reader<_TRAIterator> reader_t;
+				return static_cast<size_t>(wyhash::hash(reader_t(_First), _Count * sizeof(typename reader_t::element_t)));
+			}
+
+			template <typename _Ty, typename _Traits, typename _A>
+			inline size_t T_Hash_basic_string(const std::basic_string<_Ty, _Traits, _A>& str) _NOEXCEPT
+			{
+#ifdef MSE_LEGACY_STRING_HASH
+				return std::hash<std::basic_string<_Ty, _Traits, _A> >()(str);
+#else // MSE_LEGACY_STRING_HASH
+				return T_Hash_contiguous_elements(str.data(), str.size());
+#endif // MSE_LEGACY_STRING_HASH
+			}
+
+			template<class _Ptr>
+			inline _LIBCPP_INLINE_VISIBILITY
+				size_t z_do_string_hash(_Ptr z_p, _Ptr z_e)
+			{
+				typedef typename std::iterator_traits<_Ptr>::value_type value_type;
+				typedef decltype(sizeof(value_type)) l_size_type;
+				l_size_type num_bytes = (z_e - z_p) * sizeof(value_type);
+
+				if (true) {
+#ifdef MSE_LEGACY_STRING_HASH
+					return T_Hash_bytes(z_p, num_bytes);
+#else // MSE_LEGACY_STRING_HASH
+					return T_Hash_contiguous_elements(z_p, size_t(z_e - z_p));
+#endif // MSE_LEGACY_STRING_HASH
+				}
+				else {
+					//return z_murmur2_or_cityhash<size_t>()(z_p, (z_e - z_p) * sizeof(value_type));
+
+					/* Rather than include a hash implementation, we'll just use the existing one for std::string. */
+					/* todo: check if C++17 is available, and if so, use std::basic_string_view's hash instead. */
+					std::string string1;
+					string1.resize(num_bytes);
+					char * bytesz_p = reinterpret_cast<char *>(z_p);
+					for (l_size_type i = 0; i < num_bytes; i += 1) {
+						string1[i] = *bytesz_p;
+						++bytesz_p;
+					}
+					std::hash<std::string> str_hash;
+					return str_hash(string1);
+				}
+			}
 
 			template<class _CharT, class _Traits = std::char_traits<_CharT> >
 			class _LIBCPP_TEMPLATE_VIS basic_string_view {
@@ -1168,6 +2054,42 @@ namespace mse {
 			template <typename _Ty> auto make_xscope_string_const_section_helper1(std::true_type, TXScopeCagedItemFixedConstPointerToRValue<_Ty>&& param)
 				->impl::ra_section::mkxsscsh1_ReturnType<_Ty>;
 			template <typename _TRALoneParam> auto make_xscope_string_const_section_helper1(std::false_type, const _TRALoneParam& param);
+
+			/* String sections whose iterators reference contiguous storage can use the (vectorized, where supported) raw
+			pointer search implementations of string_view. */
+			template <typename _TRAIterator>
+			struct is_contiguous_string_section_iterator : std::integral_constant<bool,
+				std::is_pointer<_TRAIterator>::value || mse::impl::is_contiguous_sequence_iterator<_TRAIterator>::value> {};
+			template <typename _TRAIterator1, typename _TRAIterator2 = _TRAIterator1>
+			struct are_contiguous_string_section_iterators : std::integral_constant<bool,
+				is_contiguous_string_section_iterator<_TRAIterator1>::value && is_contiguous_string_section_iterator<_TRAIterator2>::value> {};
+
+			template <typename _TStringSection>
+			auto as_contiguous_string_view(const _TStringSection& section)
+				-> mse::us::impl::basic_string_view<typename std::remove_const<typename _TStringSection::value_type>::type, typename _TStringSection::traits_type> {
+				typedef mse::us::impl::basic_string_view<typename std::remove_const<typename _TStringSection::value_type>::type, typename _TStringSection::traits_type> string_view_t;
+				return (1 <= section.size()) ? string_view_t(std::addressof(section[0]), section.size()) : string_view_t();
+			}
+
+			template <typename _TStringSection, typename _TRAIterator>
+			size_t string_section_hash_helper1(std::true_type, const _TStringSection& section, const _TRAIterator&) {
+				const auto sv = as_contiguous_string_view(section);
+				return mse::us::impl::T_Hash_contiguous_elements(sv.data(), sv.size());
+			}
+			template <typename _TStringSection, typename _TRAIterator>
+			size_t string_section_hash_helper1(std::false_type, const _TStringSection& section, const _TRAIterator& first) {
+				return mse::us::impl::T_Hash_elements(first, section.length());
+			}
+			/* "first" is an iterator to the beginning of the section. */
+			template <typename _TStringSection, typename _TRAIterator>
+			size_t string_section_hash(const _TStringSection& section, const _TRAIterator& first) {
+#ifdef MSE_LEGACY_STRING_HASH
+				return mse::us::impl::T_Hash_bytes(first, section.length());
+#else // MSE_LEGACY_STRING_HASH
+				return string_section_hash_helper1(typename are_contiguous_string_section_iterators<typename _TStringSection::iterator_type>::type()
+					, section, first);
+#endif // MSE_LEGACY_STRING_HASH
+			}
 		}
 	}
 	template <typename _TRALoneParam> auto make_xscope_string_const_section(const _TRALoneParam& param) -> decltype(mse::impl::ra_section::make_xscope_string_const_section_helper1(
@@ -1287,16 +2209,16 @@ namespace mse {
 		}
 
 		size_type find(const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos = 0) const _NOEXCEPT {
-			return base_class::find(s, pos);
+			return find_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<_TRAIterator, typename TStringConstSectionBase<_TRASection, _TRAConstSection>::iterator_type>::type(), s, pos);
 		}
 		size_type rfind(const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos = npos) const _NOEXCEPT {
-			return base_class::rfind(s, pos);
+			return rfind_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<_TRAIterator, typename TStringConstSectionBase<_TRASection, _TRAConstSection>::iterator_type>::type(), s, pos);
 		}
 		size_type find_first_of(const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos = 0) const _NOEXCEPT {
-			return base_class::find_first_of(s, pos);
+			return find_first_of_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<_TRAIterator, typename TStringConstSectionBase<_TRASection, _TRAConstSection>::iterator_type>::type(), s, pos);
 		}
 		size_type find_last_of(const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos = npos) const _NOEXCEPT {
-			return base_class::find_last_of(s, pos);
+			return find_last_of_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<_TRAIterator, typename TStringConstSectionBase<_TRASection, _TRAConstSection>::iterator_type>::type(), s, pos);
 		}
 		size_type find_first_not_of(const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos = 0) const _NOEXCEPT {
 			return base_class::find_first_not_of(s, pos);
@@ -1312,6 +2234,33 @@ namespace mse {
 			return base_class::ends_with(s);
 		}
 
+	private:
+		size_type find_helper1(std::true_type, const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos) const {
+			return mse::impl::ra_section::as_contiguous_string_view(*this).find(mse::impl::ra_section::as_contiguous_string_view(s), pos);
+		}
+		size_type find_helper1(std::false_type, const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos) const {
+			return base_class::find(s, pos);
+		}
+		size_type rfind_helper1(std::true_type, const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos) const {
+			return mse::impl::ra_section::as_contiguous_string_view(*this).rfind(mse::impl::ra_section::as_contiguous_string_view(s), pos);
+		}
+		size_type rfind_helper1(std::false_type, const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos) const {
+			return base_class::rfind(s, pos);
+		}
+		size_type find_first_of_helper1(std::true_type, const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos) const {
+			return mse::impl::ra_section::as_contiguous_string_view(*this).find_first_of(mse::impl::ra_section::as_contiguous_string_view(s), pos);
+		}
+		size_type find_first_of_helper1(std::false_type, const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos) const {
+			return base_class::find_first_of(s, pos);
+		}
+		size_type find_last_of_helper1(std::true_type, const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos) const {
+			return mse::impl::ra_section::as_contiguous_string_view(*this).find_last_of(mse::impl::ra_section::as_contiguous_string_view(s), pos);
+		}
+		size_type find_last_of_helper1(std::false_type, const TStringConstSectionBase<_TRASection, _TRAConstSection>& s, size_type pos) const {
+			return base_class::find_last_of(s, pos);
+		}
+
+	public:
 		typedef typename base_class::xscope_iterator xscope_iterator;
 		typedef typename base_class::xscope_const_iterator xscope_const_iterator;
 
@@ -1625,16 +2574,16 @@ namespace mse {
 		}
 
 		size_type find(const TStringConstSectionBase& s, size_type pos = 0) const _NOEXCEPT {
-			return base_class::find(s, pos);
+			return find_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<_TRAIterator>::type(), s, pos);
 		}
 		size_type rfind(const TStringConstSectionBase& s, size_type pos = npos) const _NOEXCEPT {
-			return base_class::rfind(s, pos);
+			return rfind_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<_TRAIterator>::type(), s, pos);
 		}
 		size_type find_first_of(const TStringConstSectionBase& s, size_type pos = 0) const _NOEXCEPT {
-			return base_class::find_first_of(s, pos);
+			return find_first_of_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<_TRAIterator>::type(), s, pos);
 		}
 		size_type find_last_of(const TStringConstSectionBase& s, size_type pos = npos) const _NOEXCEPT {
-			return base_class::find_last_of(s, pos);
+			return find_last_of_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<_TRAIterator>::type(), s, pos);
 		}
 		size_type find_first_not_of(const TStringConstSectionBase& s, size_type pos = 0) const _NOEXCEPT {
 			return base_class::find_first_not_of(s, pos);
@@ -1650,6 +2599,33 @@ namespace mse {
 			return base_class::ends_with(s);
 		}
 
+	private:
+		size_type find_helper1(std::true_type, const TStringConstSectionBase& s, size_type pos) const {
+			return mse::impl::ra_section::as_contiguous_string_view(*this).find(mse::impl::ra_section::as_contiguous_string_view(s), pos);
+		}
+		size_type find_helper1(std::false_type, const TStringConstSectionBase& s, size_type pos) const {
+			return base_class::find(s, pos);
+		}
+		size_type rfind_helper1(std::true_type, const TStringConstSectionBase& s, size_type pos) const {
+			return mse::impl::ra_section::as_contiguous_string_view(*this).rfind(mse::impl::ra_section::as_contiguous_string_view(s), pos);
+		}
+		size_type rfind_helper1(std::false_type, const TStringConstSectionBase& s, size_type pos) const {
+			return base_class::rfind(s, pos);
+		}
+		size_type find_first_of_helper1(std::true_type, const TStringConstSectionBase& s, size_type pos) const {
+			return mse::impl::ra_section::as_contiguous_string_view(*this).find_first_of(mse::impl::ra_section::as_contiguous_string_view(s), pos);
+		}
+		size_type find_first_of_helper1(std::false_type, const TStringConstSectionBase& s, size_type pos) const {
+			return base_class::find_first_of(s, pos);
+		}
+		size_type find_last_of_helper1(std::true_type, const TStringConstSectionBase& s, size_type pos) const {
+			return mse::impl::ra_section::as_contiguous_string_view(*this).find_last_of(mse::impl::ra_section::as_contiguous_string_view(s), pos);
+		}
+		size_type find_last_of_helper1(std::false_type, const TStringConstSectionBase& s, size_type pos) const {
+			return base_class::find_last_of(s, pos);
+		}
+
+	public:
 		//typedef typename base_class::xscope_iterator xscope_iterator;
 		typedef typename base_class::xscope_const_iterator xscope_const_iterator;
 
@@ -2341,8 +3317,7 @@ namespace std {
 		using result_type = size_t;
 
 		size_t operator()(const mse::TXScopeStringSection<_TRAIterator, _Traits>& _Keyval) const /*_NOEXCEPT*/ {
-			/* todo: optimize */
-			auto retval = mse::us::impl::T_Hash_bytes(_Keyval.xscope_cbegin(), _Keyval.length());
+			auto retval = mse::impl::ra_section::string_section_hash(_Keyval, _Keyval.xscope_cbegin());
 			return retval;
 		}
 	};
@@ -2353,8 +3328,7 @@ namespace std {
 		using result_type = size_t;
 
 		size_t operator()(const mse::TStringSection<_TRAIterator, _Traits>& _Keyval) const /*_NOEXCEPT*/ {
-			/* todo: optimize */
-			auto retval = mse::us::impl::T_Hash_bytes(_Keyval.cbegin(), _Keyval.length());
+			auto retval = mse::impl::ra_section::string_section_hash(_Keyval, _Keyval.cbegin());
 			return retval;
 		}
 	};
@@ -2365,8 +3339,7 @@ namespace std {
 		using result_type = size_t;
 
 		size_t operator()(const mse::TXScopeStringConstSection<_TRAIterator, _Traits>& _Keyval) const /*_NOEXCEPT*/ {
-			/* todo: optimize */
-			auto retval = mse::us::impl::T_Hash_bytes(_Keyval.xscope_cbegin(), _Keyval.length());
+			auto retval = mse::impl::ra_section::string_section_hash(_Keyval, _Keyval.xscope_cbegin());
 			return retval;
 		}
 	};
@@ -2377,8 +3350,7 @@ namespace std {
 		using result_type = size_t;
 
 		size_t operator()(const mse::TStringConstSection<_TRAIterator, _Traits>& _Keyval) const /*_NOEXCEPT*/ {
-			/* todo: optimize */
-			auto retval = mse::us::impl::T_Hash_bytes(_Keyval.cbegin(), _Keyval.length());
+			auto retval = mse::impl::ra_section::string_section_hash(_Keyval, _Keyval.cbegin());
 			return retval;
 		}
 	};
@@ -2846,247 +3818,1398 @@ namespace mse {
 				, std::true_type, std::false_type>::type(), param)) {
 			}
 
-			TXScopeNRPStringConstSectionFParam xscope_subsection(size_type pos = 0, size_type n = npos) const {
-				return base_class::xscope_subsection(pos, n);
-			}
-			typedef typename std::conditional<mse::impl::is_potentially_xscope<_TRAIterator>::value, TXScopeNRPStringConstSectionFParam, TNRPStringConstSection<_TRAIterator> >::type subsection_t;
-			subsection_t subsection(size_type pos = 0, size_type n = npos) const {
-				return base_class::subsection(pos, n);
-			}
+			TXScopeNRPStringConstSectionFParam xscope_subsection(size_type pos = 0, size_type n = npos) const {
+				return base_class::xscope_subsection(pos, n);
+			}
+			typedef typename std::conditional<mse::impl::is_potentially_xscope<_TRAIterator>::value, TXScopeNRPStringConstSectionFParam, TNRPStringConstSection<_TRAIterator> >::type subsection_t;
+			subsection_t subsection(size_type pos = 0, size_type n = npos) const {
+				return base_class::subsection(pos, n);
+			}
+
+			//typedef typename base_class::xscope_iterator xscope_iterator;
+			typedef typename base_class::xscope_const_iterator xscope_const_iterator;
+
+			void xscope_not_returnable_tag() const {}
+			void xscope_tag() const {}
+
+		private:
+			template <typename _TRAContainer>
+			static mse::TXScopeFixedConstPointer<_TRAContainer> construction_helper1(std::true_type, const mse::TXScopeCagedItemFixedConstPointerToRValue<_TRAContainer>& caged_xscpptr) {
+				return mse::rsv::TXScopeFixedConstPointerFParam<_TRAContainer>(caged_xscpptr);
+			}
+			static mse::TXScopeNRPStringConstSection<_TRAIterator> construction_helper1(std::true_type, const mse::TXScopeCagedStringConstSectionToRValue<_TRAIterator>& caged_xscpsection) {
+				return caged_xscpsection.uncaged_string_section();
+			}
+			template <typename _TRALoneParam>
+			static auto construction_helper1(std::false_type, const _TRALoneParam& param) {
+				return param;
+			}
+
+			MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+		};
+
+		/* Template specializations of TFParam<>. */
+
+		template<typename _Ty>
+		class TFParam<mse::TXScopeNRPStringConstSection<_Ty> > : public TXScopeNRPStringConstSectionFParam<_Ty> {
+		public:
+			typedef TXScopeNRPStringConstSectionFParam<_Ty> base_class;
+			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TFParam, base_class);
+			void xscope_not_returnable_tag() const {}
+			void xscope_tag() const {}
+		private:
+			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
+		};
+
+		template<typename _Ty>
+		class TFParam<const mse::TXScopeNRPStringConstSection<_Ty> > : public TXScopeNRPStringConstSectionFParam<_Ty> {
+		public:
+			typedef TXScopeNRPStringConstSectionFParam<_Ty> base_class;
+			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TFParam, base_class);
+			void xscope_not_returnable_tag() const {}
+			void xscope_tag() const {}
+		private:
+			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
+		};
+
+#if 0
+		template<typename _Ty>
+		class TFParam<mse::TXScopeCagedNRPStringConstSectionToRValue<_Ty> > : public TXScopeNRPStringConstSectionFParam<_Ty> {
+		public:
+			typedef TXScopeNRPStringConstSectionFParam<_Ty> base_class;
+			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TFParam, base_class);
+			void xscope_not_returnable_tag() const {}
+			void xscope_tag() const {}
+		private:
+			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
+		};
+#endif //0
+
+		/* Template specializations of TReturnableFParam<>. */
+
+		template<typename _Ty>
+		class TReturnableFParam<mse::TXScopeNRPStringConstSection<_Ty> > : public TXScopeNRPStringConstSection<_Ty> {
+		public:
+			typedef TXScopeNRPStringConstSection<_Ty> base_class;
+			MSE_INHERITED_STRING_SECTION_MEMBER_TYPE_AND_NPOS_DECLARATIONS(base_class);
+			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TReturnableFParam, base_class);
+
+			/* Subsections of TReturnableFParam<mse::TXScopeNRPStringConstSection<_Ty> > can inherit the "returnability"
+			of the original section. */
+			auto xscope_subsection(size_type pos = 0, size_type n = npos) const {
+				typedef decltype(base_class::xscope_subsection(pos, n)) base_return_type;
+				return TReturnableFParam<base_return_type>(base_class::xscope_subsection(pos, n));
+			}
+			auto xscope_substr(size_type pos = 0, size_type n = npos) const {
+				return xscope_subsection(pos, n);
+			}
+			auto subsection(size_type pos = 0, size_type n = npos) const {
+				typedef decltype(base_class::subsection(pos, n)) base_return_type;
+				return TReturnableFParam<base_return_type>(base_class::subsection(pos, n));
+			}
+			auto substr(size_type pos = 0, size_type n = npos) const {
+				return subsection(pos, n);
+			}
+
+			void returnable_once_tag() const {}
+			void xscope_returnable_tag() const {}
+			void xscope_tag() const {}
+		private:
+			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
+		};
+
+		template<typename _Ty>
+		class TReturnableFParam<const mse::TXScopeNRPStringConstSection<_Ty> > : public TXScopeNRPStringConstSection<_Ty> {
+		public:
+			typedef TXScopeNRPStringConstSection<_Ty> base_class;
+			MSE_INHERITED_STRING_SECTION_MEMBER_TYPE_AND_NPOS_DECLARATIONS(base_class);
+			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TReturnableFParam, base_class);
+
+			/* Subsections of TReturnableFParam<const mse::TXScopeNRPStringConstSection<_Ty> > can inherit the "returnability"
+			of the original section. */
+			auto xscope_subsection(size_type pos = 0, size_type n = npos) const {
+				typedef decltype(base_class::xscope_subsection(pos, n)) base_return_type;
+				return TReturnableFParam<base_return_type>(base_class::xscope_subsection(pos, n));
+			}
+			auto xscope_substr(size_type pos = 0, size_type n = npos) const {
+				return xscope_subsection(pos, n);
+			}
+			auto subsection(size_type pos = 0, size_type n = npos) const {
+				typedef decltype(base_class::subsection(pos, n)) base_return_type;
+				return TReturnableFParam<base_return_type>(base_class::subsection(pos, n));
+			}
+			auto substr(size_type pos = 0, size_type n = npos) const {
+				return subsection(pos, n);
+			}
+
+			void returnable_once_tag() const {}
+			void xscope_returnable_tag() const {}
+			void xscope_tag() const {}
+		private:
+			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
+		};
+
+		template<typename _Ty>
+		class TReturnableFParam<mse::TXScopeNRPStringSection<_Ty> > : public TXScopeNRPStringSection<_Ty> {
+		public:
+			typedef TXScopeNRPStringSection<_Ty> base_class;
+			MSE_INHERITED_STRING_SECTION_MEMBER_TYPE_AND_NPOS_DECLARATIONS(base_class);
+			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TReturnableFParam, base_class);
+
+			/* Subsections of TReturnableFParam<mse::TXScopeNRPStringSection<_Ty> > can inherit the "returnability"
+			of the original section. */
+			auto xscope_subsection(size_type pos = 0, size_type n = npos) const {
+				typedef decltype(base_class::xscope_subsection(pos, n)) base_return_type;
+				return TReturnableFParam<base_return_type>(base_class::xscope_subsection(pos, n));
+			}
+			auto xscope_substr(size_type pos = 0, size_type n = npos) const {
+				return xscope_subsection(pos, n);
+			}
+			auto subsection(size_type pos = 0, size_type n = npos) const {
+				typedef decltype(base_class::subsection(pos, n)) base_return_type;
+				return TReturnableFParam<base_return_type>(base_class::subsection(pos, n));
+			}
+			auto substr(size_type pos = 0, size_type n = npos) const {
+				return subsection(pos, n);
+			}
+
+			void returnable_once_tag() const {}
+			void xscope_returnable_tag() const {}
+			void xscope_tag() const {}
+		private:
+			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
+		};
+
+		template<typename _Ty>
+		class TReturnableFParam<const mse::TXScopeNRPStringSection<_Ty> > : public TXScopeNRPStringSection<_Ty> {
+		public:
+			typedef TXScopeNRPStringSection<_Ty> base_class;
+			MSE_INHERITED_STRING_SECTION_MEMBER_TYPE_AND_NPOS_DECLARATIONS(base_class);
+			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TReturnableFParam, base_class);
+
+			/* Subsections of TReturnableFParam<const mse::TXScopeNRPStringSection<_Ty> > can inherit the "returnability"
+			of the original section. */
+			auto xscope_subsection(size_type pos = 0, size_type n = npos) const {
+				typedef decltype(base_class::xscope_subsection(pos, n)) base_return_type;
+				return TReturnableFParam<base_return_type>(base_class::xscope_subsection(pos, n));
+			}
+			auto xscope_substr(size_type pos = 0, size_type n = npos) const {
+				return xscope_subsection(pos, n);
+			}
+			auto subsection(size_type pos = 0, size_type n = npos) const {
+				typedef decltype(base_class::subsection(pos, n)) base_return_type;
+				return TReturnableFParam<base_return_type>(base_class::subsection(pos, n));
+			}
+			auto substr(size_type pos = 0, size_type n = npos) const {
+				return subsection(pos, n);
+			}
+
+			void returnable_once_tag() const {}
+			void xscope_returnable_tag() const {}
+			void xscope_tag() const {}
+		private:
+			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
+		};
+	}
+
+	template <typename _TElement, class _Traits = std::char_traits<_TElement> >
+	using TXScopeCSSSXSTENRPStringConstSection = TXScopeNRPStringConstSection<TXScopeCSSSXSTERAConstIterator<_TElement>, _Traits>;
+	template <typename _TElement, class _Traits = std::char_traits<_TElement> >
+	using TXScopeCSSSXSTENRPStringSection = TXScopeNRPStringSection<TXScopeCSSSXSTERAIterator<_TElement>, _Traits>;
+}
+
+namespace std {
+
+	template <typename _TRAIterator, class _Traits>
+	struct hash<mse::TXScopeNRPStringSection<_TRAIterator, _Traits> > : public hash<mse::TXScopeStringSection<_TRAIterator, _Traits> > {
+		typedef hash<mse::TXScopeStringSection<_TRAIterator, _Traits> > base_class;
+		typedef typename base_class::argument_type argument_type;
+		typedef typename base_class::result_type result_type;
+	};
+
+	template <typename _TRAIterator, class _Traits>
+	struct hash<mse::TNRPStringSection<_TRAIterator, _Traits> > : public hash<mse::TStringSection<_TRAIterator, _Traits> > {
+		typedef hash<mse::TNRPStringSection<_TRAIterator, _Traits> > base_class;
+		typedef typename base_class::argument_type argument_type;
+		typedef typename base_class::result_type result_type;
+	};
+
+	template <typename _TRAIterator, class _Traits>
+	struct hash<mse::TXScopeNRPStringConstSection<_TRAIterator, _Traits> > : public hash<mse::TXScopeStringConstSection<_TRAIterator, _Traits> > {
+		typedef hash<mse::TXScopeStringConstSection<_TRAIterator, _Traits> > base_class;
+		typedef typename base_class::argument_type argument_type;
+		typedef typename base_class::result_type result_type;
+	};
+
+	template <typename _TRAIterator, class _Traits>
+	struct hash<mse::TNRPStringConstSection<_TRAIterator, _Traits> > : public hash<mse::TStringConstSection<_TRAIterator, _Traits> > {
+		typedef hash<mse::TStringConstSection<_TRAIterator, _Traits> > base_class;
+		typedef typename base_class::argument_type argument_type;
+		typedef typename base_class::result_type result_type;
+	};
+}
+
+namespace mse {
+
+	/* shorter aliases */
+	template <typename... Args>
+	auto mknss(Args&&... args) -> decltype(make_nrp_string_section(std::forward<Args>(args)...)) {
+		return make_nrp_string_section(std::forward<Args>(args)...);
+	}
+	template <typename... Args>
+	auto mknscs(Args&&... args) -> decltype(make_nrp_string_const_section(std::forward<Args>(args)...)) {
+		return make_nrp_string_const_section(std::forward<Args>(args)...);
+	}
+}
+
+namespace mse {
+
+	/* "String section tokenizers" lazily split a string section into (delimiter separated) tokens. Each token is
+	itself a (sub)section of the original section, so tokenizing involves no copying or allocation. As with
+	std::string_view-based "split" functions, adjacent delimiters produce empty tokens, and a section containing n
+	delimiters yields n + 1 tokens. */
+
+	namespace impl {
+		namespace ns_string_tokenizer {
+
+			template<typename _TCharT>
+			class char_delimiter_finder {
+			public:
+				explicit char_delimiter_finder(const _TCharT& delimiter) : m_delimiter(delimiter) {}
+
+				template<typename _TStringSection>
+				size_t find_in(const _TStringSection& section, size_t pos) const {
+					return find_in_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<typename _TStringSection::iterator_type>::type()
+						, section, pos);
+				}
+
+			private:
+				template<typename _TStringSection>
+				size_t find_in_helper1(std::true_type, const _TStringSection& section, size_t pos) const {
+					return mse::impl::ra_section::as_contiguous_string_view(section).find(m_delimiter, pos);
+				}
+				template<typename _TStringSection>
+				size_t find_in_helper1(std::false_type, const _TStringSection& section, size_t pos) const {
+					for (size_t i = pos; section.size() > i; i += 1) {
+						if (_TStringSection::traits_type::eq(section[i], m_delimiter)) {
+							return i;
+						}
+					}
+					return _TStringSection::npos;
+				}
+
+				_TCharT m_delimiter;
+			};
+
+			template<typename _TDelimiterSetSection>
+			class char_set_delimiter_finder {
+			public:
+				explicit char_set_delimiter_finder(const _TDelimiterSetSection& delimiter_set) : m_delimiter_set(delimiter_set) {}
+
+				template<typename _TStringSection>
+				size_t find_in(const _TStringSection& section, size_t pos) const {
+					return find_in_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<typename _TStringSection::iterator_type
+						, typename _TDelimiterSetSection::iterator_type>::type(), section, pos);
+				}
+
+			private:
+				template<typename _TStringSection>
+				size_t find_in_helper1(std::true_type, const _TStringSection& section, size_t pos) const {
+					return mse::impl::ra_section::as_contiguous_string_view(section).find_first_of(
+						mse::impl::ra_section::as_contiguous_string_view(m_delimiter_set), pos);
+				}
+				template<typename _TStringSection>
+				size_t find_in_helper1(std::false_type, const _TStringSection& section, size_t pos) const {
+					for (size_t i = pos; section.size() > i; i += 1) {
+						for (size_t j = 0; m_delimiter_set.size() > j; j += 1) {
+							if (_TStringSection::traits_type::eq(section[i], m_delimiter_set[j])) {
+								return i;
+							}
+						}
+					}
+					return _TStringSection::npos;
+				}
+
+				_TDelimiterSetSection m_delimiter_set;
+			};
+
+			template<typename _TPredicate>
+			class predicate_delimiter_finder {
+			public:
+				explicit predicate_delimiter_finder(const _TPredicate& predicate) : m_predicate(predicate) {}
+
+				template<typename _TStringSection>
+				size_t find_in(const _TStringSection& section, size_t pos) const {
+					return find_in_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<typename _TStringSection::iterator_type>::type()
+						, section, pos);
+				}
+
+			private:
+				template<typename _TStringSection>
+				size_t find_in_helper1(std::true_type, const _TStringSection& section, size_t pos) const {
+					const auto sv = mse::impl::ra_section::as_contiguous_string_view(section);
+					if (sv.size() <= pos) {
+						return _TStringSection::npos;
+					}
+					const auto found_ptr = std::find_if(sv.data() + pos, sv.data() + sv.size(), m_predicate);
+					return (sv.data() + sv.size() == found_ptr) ? _TStringSection::npos : size_t(found_ptr - sv.data());
+				}
+				template<typename _TStringSection>
+				size_t find_in_helper1(std::false_type, const _TStringSection& section, size_t pos) const {
+					for (size_t i = pos; section.size() > i; i += 1) {
+						if (m_predicate(section[i])) {
+							return i;
+						}
+					}
+					return _TStringSection::npos;
+				}
+
+				_TPredicate m_predicate;
+			};
+		}
+	}
+
+	template<typename _TStringSection, typename _TDelimiterFinder>
+	class TXScopeStringSectionTokenizer : public mse::us::impl::XScopeTagBase {
+	public:
+		typedef typename _TStringSection::size_type size_type;
+		typedef decltype(mse::make_xscope_subsection(std::declval<const _TStringSection&>(), size_type(0), size_type(0))) token_type;
+		static const size_t npos = size_t(-1);
+
+		TXScopeStringSectionTokenizer(const _TStringSection& section, const _TDelimiterFinder& delimiter_finder)
+			: m_section(section), m_delimiter_finder(delimiter_finder) {}
+		TXScopeStringSectionTokenizer(const TXScopeStringSectionTokenizer&) = default;
+
+		/* An input iterator that yields the tokens. */
+		class xscope_const_iterator : public mse::us::impl::XScopeTagBase {
+		public:
+			typedef std::input_iterator_tag iterator_category;
+			typedef token_type value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef void pointer;
+			typedef token_type reference;
+
+			token_type operator*() const {
+				if (npos == m_token_start) {
+					MSE_THROW(std::out_of_range("attempt to dereference an end iterator - TXScopeStringSectionTokenizer::xscope_const_iterator"));
+				}
+				return mse::make_xscope_subsection(m_tokenizer_ptr->m_section, m_token_start, m_token_end - m_token_start);
+			}
+			xscope_const_iterator& operator++() {
+				if (npos == m_token_start) {
+					MSE_THROW(std::out_of_range("attempt to increment an end iterator - TXScopeStringSectionTokenizer::xscope_const_iterator"));
+				}
+				if (m_tokenizer_ptr->m_section.size() <= m_token_end) {
+					m_token_start = npos;
+					m_token_end = npos;
+				}
+				else {
+					set_token_start(m_token_end + 1);
+				}
+				return *this;
+			}
+			xscope_const_iterator operator++(int) {
+				xscope_const_iterator retval(*this);
+				++(*this);
+				return retval;
+			}
+			bool operator==(const xscope_const_iterator& other) const {
+				return (m_tokenizer_ptr == other.m_tokenizer_ptr) && (m_token_start == other.m_token_start);
+			}
+			bool operator!=(const xscope_const_iterator& other) const { return !((*this) == other); }
+
+			/* The position (in the tokenized section) of the current token. */
+			size_type position() const { return m_token_start; }
+
+		private:
+			xscope_const_iterator(const TXScopeStringSectionTokenizer& tokenizer, size_type token_start) : m_tokenizer_ptr(std::addressof(tokenizer)) {
+				if (npos == token_start) {
+					m_token_start = npos;
+					m_token_end = npos;
+				}
+				else {
+					set_token_start(token_start);
+				}
+			}
+			void set_token_start(size_type token_start) {
+				m_token_start = token_start;
+				const auto delimiter_pos = m_tokenizer_ptr->m_delimiter_finder.find_in(m_tokenizer_ptr->m_section, token_start);
+				m_token_end = (npos == delimiter_pos) ? m_tokenizer_ptr->m_section.size() : delimiter_pos;
+			}
+
+			const TXScopeStringSectionTokenizer* m_tokenizer_ptr = nullptr;
+			size_type m_token_start = npos;
+			size_type m_token_end = npos;
+
+			MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+			friend class TXScopeStringSectionTokenizer;
+		};
+
+		/* The iterators refer to the tokenizer, so they can't be obtained from a temporary one. */
+		xscope_const_iterator begin() const & { return xscope_const_iterator(*this, 0); }
+		xscope_const_iterator end() const & { return xscope_const_iterator(*this, npos); }
+		xscope_const_iterator cbegin() const & { return begin(); }
+		xscope_const_iterator cend() const & { return end(); }
+		void begin() const && = delete;
+		void end() const && = delete;
+		void cbegin() const && = delete;
+		void cend() const && = delete;
+
+		void xscope_tag() const {}
+
+	private:
+		TXScopeStringSectionTokenizer& operator=(const TXScopeStringSectionTokenizer&) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		_TStringSection m_section;
+		_TDelimiterFinder m_delimiter_finder;
+	};
+
+	/* Tokenize by a delimiter character. */
+	template<typename _TStringSection, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value), void>::type>
+	auto make_xscope_string_tokenizer(const _TStringSection& section, const typename _TStringSection::nonconst_value_type& delimiter) {
+		typedef mse::impl::ns_string_tokenizer::char_delimiter_finder<typename _TStringSection::nonconst_value_type> finder_t;
+		return TXScopeStringSectionTokenizer<_TStringSection, finder_t>(section, finder_t(delimiter));
+	}
+	/* Tokenize by any of the characters in the given delimiter set (string section). */
+	template<typename _TStringSection, typename _TDelimiterSetSection, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value)
+		&& (std::is_base_of<mse::us::impl::StringSectionTagBase, _TDelimiterSetSection>::value), void>::type>
+	auto make_xscope_string_tokenizer_any_of(const _TStringSection& section, const _TDelimiterSetSection& delimiter_set) {
+		typedef mse::impl::ns_string_tokenizer::char_set_delimiter_finder<_TDelimiterSetSection> finder_t;
+		return TXScopeStringSectionTokenizer<_TStringSection, finder_t>(section, finder_t(delimiter_set));
+	}
+	/* Tokenize by the characters that satisfy the given predicate. */
+	template<typename _TStringSection, typename _TPredicate, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value), void>::type>
+	auto make_xscope_string_tokenizer_if(const _TStringSection& section, const _TPredicate& predicate) {
+		typedef mse::impl::ns_string_tokenizer::predicate_delimiter_finder<_TPredicate> finder_t;
+		return TXScopeStringSectionTokenizer<_TStringSection, finder_t>(section, finder_t(predicate));
+	}
+}
+
+namespace mse {
+
+	/* from_chars() and to_chars() are analogues of the std:: functions of the same name that operate directly on
+	string sections. They do not allocate (so, for example, mse::from_chars(section, value) can be used instead of
+	std::stoi(std::string(section))), and errors (including out of range values) are reported via the ec member of the
+	returned result rather than via exceptions. The count member of the returned result indicates the number of
+	characters consumed or written. As with the std:: versions, leading whitespace and leading '+' signs are not
+	accepted, and a leading '-' sign is accepted only for signed types. Parsing into mse::CInt, mse::CSize_t and other
+	mse::TInt<> types is supported, with range checking appropriate to the type. */
+
+	struct from_chars_result {
+		size_t count = 0;
+		std::errc ec = std::errc();
+	};
+	struct to_chars_result {
+		size_t count = 0;
+		std::errc ec = std::errc();
+	};
+
+	namespace impl {
+		namespace ns_string_numeric {
+
+			/* mse::TInt<> and mse::CNDSize_t values are parsed and formatted via their native counterparts. */
+			template<typename _Ty> struct native_numeric_type { typedef _Ty type; };
+			template<typename _TBaseInt> struct native_numeric_type<mse::TInt<_TBaseInt> > { typedef _TBaseInt type; };
+			template<> struct native_numeric_type<mse::CNDSize_t> { typedef size_t type; };
+
+			template<typename _Ty>
+			struct is_supported_integer : std::integral_constant<bool, std::is_integral<typename native_numeric_type<_Ty>::type>::value
+				&& (!std::is_same<typename native_numeric_type<_Ty>::type, bool>::value)> {};
+
+			/* Longer floating point representations are rejected when they can't be parsed in place. */
+			static const size_t sc_max_buffered_floating_point_length = 256;
+
+			/* Character readers give uniform (unchecked) indexed access to the elements of contiguous and non-contiguous
+			string sections. */
+			template<typename _TStringSection>
+			class section_reader {
+			public:
+				typedef typename std::remove_const<typename _TStringSection::value_type>::type char_type;
+				explicit section_reader(const _TStringSection& section) : m_section(section) {}
+				char_type operator[](size_t index) const { return m_section[index]; }
+				size_t size() const { return m_section.size(); }
+			private:
+				const _TStringSection& m_section;
+			};
+			template<typename _TCharT>
+			class contiguous_reader {
+			public:
+				typedef _TCharT char_type;
+				contiguous_reader(const _TCharT* data, size_t size) : m_data(data), m_size(size) {}
+				char_type operator[](size_t index) const { return m_data[index]; }
+				size_t size() const { return m_size; }
+				const _TCharT* data() const { return m_data; }
+			private:
+				const _TCharT* m_data;
+				size_t m_size;
+			};
+
+			template<typename _TStringSection>
+			auto make_reader_helper1(std::true_type, const _TStringSection& section) {
+				const auto sv = mse::impl::ra_section::as_contiguous_string_view(section);
+				return contiguous_reader<typename decltype(sv)::value_type>(sv.data(), sv.size());
+			}
+			template<typename _TStringSection>
+			auto make_reader_helper1(std::false_type, const _TStringSection& section) {
+				return section_reader<_TStringSection>(section);
+			}
+			template<typename _TStringSection>
+			auto make_reader(const _TStringSection& section) {
+				return make_reader_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<typename _TStringSection::iterator_type>::type(), section);
+			}
+
+			template<typename _TCharT>
+			int digit_value(const _TCharT& ch) {
+				if ((_TCharT('0') <= ch) && (_TCharT('9') >= ch)) {
+					return int(ch - _TCharT('0'));
+				}
+				else if ((_TCharT('a') <= ch) && (_TCharT('z') >= ch)) {
+					return int(ch - _TCharT('a')) + 10;
+				}
+				else if ((_TCharT('A') <= ch) && (_TCharT('Z') >= ch)) {
+					return int(ch - _TCharT('A')) + 10;
+				}
+				return 36;
+			}
+
+			template<typename _TInt, typename _TReader>
+			from_chars_result parse_integer(const _TReader& reader, _TInt& value, int base) {
+				typedef typename _TReader::char_type char_type;
+				typedef typename std::make_unsigned<_TInt>::type unsigned_t;
+				from_chars_result retval;
+				const size_t size = reader.size();
+				size_t index = 0;
+				bool is_negative = false;
+				if (std::is_signed<_TInt>::value && (1 <= size) && (char_type('-') == reader[0])) {
+					is_negative = true;
+					index = 1;
+				}
+				const size_t digits_start = index;
+				const unsigned_t ubase = unsigned_t(base);
+				const unsigned_t max_magnitude = is_negative ? unsigned_t(unsigned_t(0) - unsigned_t((std::numeric_limits<_TInt>::min)()))
+					: unsigned_t((std::numeric_limits<_TInt>::max)());
+				unsigned_t magnitude = 0;
+				bool overflowed = false;
+				for (; size > index; index += 1) {
+					const int digit = digit_value(reader[index]);
+					if (base <= digit) {
+						break;
+					}
+					if ((magnitude > (max_magnitude / ubase)) || (unsigned_t(max_magnitude - magnitude * ubase) < unsigned_t(digit))) {
+						overflowed = true;
+					}
+					else {
+						magnitude = unsigned_t(magnitude * ubase + unsigned_t(digit));
+					}
+				}
+				if (digits_start == index) {
+					retval.ec = std::errc::invalid_argument;
+					return retval;
+				}
+				retval.count = index;
+				if (overflowed) {
+					retval.ec = std::errc::result_out_of_range;
+					return retval;
+				}
+				value = is_negative ? _TInt(unsigned_t(unsigned_t(0) - magnitude)) : _TInt(magnitude);
+				return retval;
+			}
+
+			template<typename _TCharT>
+			bool equals_ignoring_case(const _TCharT& ch, char lower_case_ch) {
+				return (_TCharT(lower_case_ch) == ch) || (_TCharT(lower_case_ch - ('a' - 'A')) == ch);
+			}
+			template<typename _TReader>
+			bool matches_ignoring_case(const _TReader& reader, size_t pos, const char* lower_case_str) {
+				for (; '\0' != *lower_case_str; ++lower_case_str, ++pos) {
+					if ((reader.size() <= pos) || (!equals_ignoring_case(reader[pos], *lower_case_str))) {
+						return false;
+					}
+				}
+				return true;
+			}
+			/* Returns the length of the (std::chars_format::general) floating point representation at the start of the
+			reader's range, or zero if there isn't one. */
+			template<typename _TReader>
+			size_t floating_point_representation_length(const _TReader& reader) {
+				typedef typename _TReader::char_type char_type;
+				const size_t size = reader.size();
+				size_t index = 0;
+				if ((1 <= size) && (char_type('-') == reader[0])) {
+					index = 1;
+				}
+				if (matches_ignoring_case(reader, index, "infinity")) {
+					return index + 8;
+				}
+				if (matches_ignoring_case(reader, index, "inf") || matches_ignoring_case(reader, index, "nan")) {
+					return index + 3;
+				}
+				size_t num_digits = 0;
+				for (; (size > index) && (10 > digit_value(reader[index])); index += 1, num_digits += 1) {}
+				if ((size > index) && (char_type('.') == reader[index])) {
+					index += 1;
+					for (; (size > index) && (10 > digit_value(reader[index])); index += 1, num_digits += 1) {}
+				}
+				if (0 == num_digits) {
+					return 0;
+				}
+				if ((size > index) && equals_ignoring_case(reader[index], 'e')) {
+					size_t exponent_index = index + 1;
+					if ((size > exponent_index) && ((char_type('-') == reader[exponent_index]) || (char_type('+') == reader[exponent_index]))) {
+						exponent_index += 1;
+					}
+					const size_t exponent_digits_start = exponent_index;
+					for (; (size > exponent_index) && (10 > digit_value(reader[exponent_index])); exponent_index += 1) {}
+					if (exponent_digits_start < exponent_index) {
+						index = exponent_index;
+					}
+				}
+				return index;
+			}
+
+			inline float strto_floating_point(const char* str, char** str_end, float*) { return std::strtof(str, str_end); }
+			inline double strto_floating_point(const char* str, char** str_end, double*) { return std::strtod(str, str_end); }
+			inline long double strto_floating_point(const char* str, char** str_end, long double*) { return std::strtold(str, str_end); }
+
+			template<typename _TFloat, typename _TReader>
+			from_chars_result parse_buffered_floating_point(const _TReader& reader, _TFloat& value) {
+				from_chars_result retval;
+				const size_t length = floating_point_representation_length(reader);
+				if (0 == length) {
+					retval.ec = std::errc::invalid_argument;
+					return retval;
+				}
+				if (sc_max_buffered_floating_point_length < length) {
+					retval.ec = std::errc::value_too_large;
+					return retval;
+				}
+				/* The validated representation consists solely of (basic source character set) characters, so it can
+				be safely narrowed into a (null terminated) char buffer. */
+				char buffer[sc_max_buffered_floating_point_length + 1];
+				for (size_t i = 0; length > i; i += 1) {
+					buffer[i] = char(reader[i]);
+				}
+				buffer[length] = '\0';
+#if defined(MSE_HAS_CXX17) && defined(__cpp_lib_to_chars)
+				const auto res = std::from_chars(buffer, buffer + length, value);
+				retval.count = size_t(res.ptr - buffer);
+				retval.ec = res.ec;
+#else /*defined(MSE_HAS_CXX17) && defined(__cpp_lib_to_chars)*/
+				char* str_end = buffer;
+				const int saved_errno = errno;
+				errno = 0;
+				const _TFloat result = strto_floating_point(buffer, &str_end, static_cast<_TFloat*>(nullptr));
+				retval.count = size_t(str_end - buffer);
+				if (0 == retval.count) {
+					retval.ec = std::errc::invalid_argument;
+				}
+				else if (ERANGE == errno) {
+					retval.ec = std::errc::result_out_of_range;
+				}
+				else {
+					value = result;
+				}
+				errno = saved_errno;
+#endif /*defined(MSE_HAS_CXX17) && defined(__cpp_lib_to_chars)*/
+				return retval;
+			}
+			template<typename _TFloat, typename _TReader>
+			from_chars_result parse_floating_point_helper1(std::false_type, const _TReader& reader, _TFloat& value) {
+				return parse_buffered_floating_point(reader, value);
+			}
+#if defined(MSE_HAS_CXX17) && defined(__cpp_lib_to_chars)
+			/* Contiguous char data can be parsed in place. */
+			template<typename _TFloat>
+			from_chars_result parse_floating_point_helper1(std::true_type, const contiguous_reader<char>& reader, _TFloat& value) {
+				from_chars_result retval;
+				const auto res = std::from_chars(reader.data(), reader.data() + reader.size(), value);
+				retval.count = size_t(res.ptr - reader.data());
+				retval.ec = res.ec;
+				return retval;
+			}
+#else /*defined(MSE_HAS_CXX17) && defined(__cpp_lib_to_chars)*/
+			template<typename _TFloat>
+			from_chars_result parse_floating_point_helper1(std::true_type, const contiguous_reader<char>& reader, _TFloat& value) {
+				return parse_buffered_floating_point(reader, value);
+			}
+#endif /*defined(MSE_HAS_CXX17) && defined(__cpp_lib_to_chars)*/
+			template<typename _TFloat, typename _TReader>
+			from_chars_result parse_floating_point(const _TReader& reader, _TFloat& value) {
+				return parse_floating_point_helper1(typename std::is_same<_TReader, contiguous_reader<char> >::type(), reader, value);
+			}
+
+			template<typename _Ty, typename _TReader>
+			from_chars_result from_chars_helper1(std::true_type, const _TReader& reader, _Ty& value, int base) {
+				if ((2 > base) || (36 < base)) {
+					MSE_THROW(std::invalid_argument("invalid base - mse::from_chars()"));
+				}
+				typename native_numeric_type<_Ty>::type native_value = 0;
+				const auto retval = parse_integer(reader, native_value, base);
+				if (std::errc() == retval.ec) {
+					value = native_value;
+				}
+				return retval;
+			}
+			template<typename _Ty, typename _TReader>
+			from_chars_result from_chars_helper1(std::false_type, const _TReader& reader, _Ty& value, int) {
+				return parse_floating_point(reader, value);
+			}
+
+			/* Large enough for any integer in base 2 or any (shortest round trip or max_digits10 precision) floating
+			point representation. */
+			static const size_t sc_format_buffer_size = 160;
+
+			template<typename _TInt>
+			size_t format_integer(char* buffer, _TInt value, int base) {
+				typedef typename std::make_unsigned<_TInt>::type unsigned_t;
+				static const char sc_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+				const bool is_negative = (_TInt(0) > value);
+				unsigned_t magnitude = is_negative ? unsigned_t(unsigned_t(0) - unsigned_t(value)) : unsigned_t(value);
+				char reversed_digits[sc_format_buffer_size];
+				size_t num_digits = 0;
+				do {
+					reversed_digits[num_digits] = sc_digits[magnitude % unsigned_t(base)];
+					num_digits += 1;
+					magnitude = unsigned_t(magnitude / unsigned_t(base));
+				} while (0 != magnitude);
+				size_t length = 0;
+				if (is_negative) {
+					buffer[0] = '-';
+					length = 1;
+				}
+				while (1 <= num_digits) {
+					num_digits -= 1;
+					buffer[length] = reversed_digits[num_digits];
+					length += 1;
+				}
+				return length;
+			}
+
+			inline int format_floating_point_with_snprintf(char* buffer, float value) { return std::snprintf(buffer, sc_format_buffer_size, "%.*g", std::numeric_limits<float>::max_digits10, double(value)); }
+			inline int format_floating_point_with_snprintf(char* buffer, double value) { return std::snprintf(buffer, sc_format_buffer_size, "%.*g", std::numeric_limits<double>::max_digits10, value); }
+			inline int format_floating_point_with_snprintf(char* buffer, long double value) { return std::snprintf(buffer, sc_format_buffer_size, "%.*Lg", std::numeric_limits<long double>::max_digits10, value); }
+
+			template<typename _TFloat>
+			size_t format_floating_point(char* buffer, _TFloat value) {
+#if defined(MSE_HAS_CXX17) && defined(__cpp_lib_to_chars)
+				/* Shortest representation that round trips. */
+				const auto res = std::to_chars(buffer, buffer + sc_format_buffer_size, value);
+				return (std::errc() == res.ec) ? size_t(res.ptr - buffer) : 0;
+#else /*defined(MSE_HAS_CXX17) && defined(__cpp_lib_to_chars)*/
+				const int res = format_floating_point_with_snprintf(buffer, value);
+				return ((0 <= res) && (int(sc_format_buffer_size) > res)) ? size_t(res) : 0;
+#endif /*defined(MSE_HAS_CXX17) && defined(__cpp_lib_to_chars)*/
+			}
+
+			template<typename _Ty>
+			size_t to_chars_helper1(std::true_type, char* buffer, const _Ty& value, int base) {
+				if ((2 > base) || (36 < base)) {
+					MSE_THROW(std::invalid_argument("invalid base - mse::to_chars()"));
+				}
+				typedef typename native_numeric_type<_Ty>::type native_t;
+				return format_integer(buffer, static_cast<native_t>(value), base);
+			}
+			template<typename _Ty>
+			size_t to_chars_helper1(std::false_type, char* buffer, const _Ty& value, int) {
+				return format_floating_point(buffer, value);
+			}
+
+			template<typename _TStringSection>
+			void copy_to_section_helper1(std::true_type, const _TStringSection& section, const char* buffer, size_t length) {
+				std::copy(buffer, buffer + length, std::addressof(section[0]));
+			}
+			template<typename _TStringSection>
+			void copy_to_section_helper1(std::false_type, const _TStringSection& section, const char* buffer, size_t length) {
+				for (size_t i = 0; length > i; i += 1) {
+					section[i] = buffer[i];
+				}
+			}
+		}
+	}
+
+	/* Parses an integer (in the given base) or floating point value from the beginning of the section. On failure the
+	value is left unmodified. */
+	template<typename _TStringSection, typename _Ty, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value)
+		&& ((mse::impl::ns_string_numeric::is_supported_integer<_Ty>::value) || (std::is_floating_point<_Ty>::value)), void>::type>
+	from_chars_result from_chars(const _TStringSection& section, _Ty& value, int base = 10) {
+		return mse::impl::ns_string_numeric::from_chars_helper1(typename mse::impl::ns_string_numeric::is_supported_integer<_Ty>::type()
+			, mse::impl::ns_string_numeric::make_reader(section), value, base);
+	}
+
+	/* Writes the representation of the value to the beginning of the (writable) section. If the section is not large
+	enough, the ec member of the result will be set to std::errc::value_too_large. */
+	template<typename _TStringSection, typename _Ty, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value)
+		&& ((mse::impl::ns_string_numeric::is_supported_integer<_Ty>::value) || (std::is_floating_point<_Ty>::value)), void>::type>
+	to_chars_result to_chars(const _TStringSection& section, const _Ty& value, int base = 10) {
+		to_chars_result retval;
+		char buffer[mse::impl::ns_string_numeric::sc_format_buffer_size];
+		const size_t length = mse::impl::ns_string_numeric::to_chars_helper1(typename mse::impl::ns_string_numeric::is_supported_integer<_Ty>::type()
+			, buffer, value, base);
+		if (0 == length) {
+			retval.ec = std::errc::invalid_argument;
+		}
+		else if (section.size() < length) {
+			retval.count = section.size();
+			retval.ec = std::errc::value_too_large;
+		}
+		else {
+			mse::impl::ns_string_numeric::copy_to_section_helper1(typename std::integral_constant<bool
+				, mse::impl::ra_section::are_contiguous_string_section_iterators<typename _TStringSection::iterator_type>::value
+				&& std::is_same<typename std::remove_const<typename _TStringSection::value_type>::type, char>::value>::type(), section, buffer, length);
+			retval.count = length;
+		}
+		return retval;
+	}
+
+	/* A convenience function that parses the entire section as a value of the specified type, and throws an exception
+	(std::invalid_argument or std::out_of_range, like std::stoi()) on failure. */
+	template<typename _Ty, typename _TStringSection>
+	_Ty parse_number(const _TStringSection& section, int base = 10) {
+		_Ty value = _Ty(0);
+		const auto res = mse::from_chars(section, value, base);
+		if (std::errc::result_out_of_range == res.ec) {
+			MSE_THROW(std::out_of_range("value out of range - mse::parse_number()"));
+		}
+		else if ((std::errc() != res.ec) || (section.size() != res.count)) {
+			MSE_THROW(std::invalid_argument("invalid numeric representation - mse::parse_number()"));
+		}
+		return value;
+	}
+}
+
+namespace mse {
+
+	/* TXScopeStringBuilder<> accumulates a sequence of string "pieces" and materializes the concatenated result with
+	a single allocation. Appended (contiguous) non-scope string sections are referenced rather than copied. The
+	builder keeps a copy of each such section, and accesses the section's contents through that copy, and only when
+	the result is materialized. Non-scope sections either keep their target alive or check its validity, so the
+	section's (bounds) checking applies if its target has been modified in the meantime. Individual characters,
+	numbers, non-contiguous sections, and sections whose target's lifetime isn't tied to the builder's (i.e. scope
+	sections and sections with raw pointer iterators), are copied into chunks of storage owned by the builder. */
+
+	namespace impl {
+		namespace ns_string_builder {
+			template<typename _TChar, class _Traits>
+			class section_holder_base {
+			public:
+				typedef mse::us::impl::basic_string_view<_TChar, _Traits> string_view_t;
+				virtual ~section_holder_base() {}
+				/* Returns a view of the (current) contents of the held section. */
+				virtual string_view_t contiguous_view() const = 0;
+			};
+			template<typename _TChar, class _Traits, typename _TStringSection>
+			class section_holder : public section_holder_base<_TChar, _Traits> {
+			public:
+				typedef section_holder_base<_TChar, _Traits> base_class;
+				typedef typename base_class::string_view_t string_view_t;
+				explicit section_holder(const _TStringSection& section) : m_section(section) {}
+				string_view_t contiguous_view() const override {
+					const auto count = m_section.size();
+					if (1 <= count) {
+						/* Accessing the first and last elements via the section verifies (where the section is checked)
+						that the whole (contiguous) range is still valid. */
+						const _TChar* first_ptr = std::addressof(m_section[0]);
+						const _TChar* last_ptr = std::addressof(m_section[count - 1]);
+						if (first_ptr + (count - 1) != last_ptr) {
+							MSE_THROW(std::logic_error("section storage is no longer contiguous - TXScopeStringBuilder"));
+						}
+						return string_view_t(first_ptr, count);
+					}
+					return string_view_t();
+				}
+			private:
+				_TStringSection m_section;
+			};
+
+			/* Only sections that keep their target alive, or check its validity, can be held (and accessed later). */
+			template<typename _TStringSection>
+			struct is_holdable_section : std::integral_constant<bool,
+				mse::impl::is_potentially_not_xscope<_TStringSection>::value
+				&& mse::impl::is_potentially_not_xscope<typename _TStringSection::iterator_type>::value
+				&& (!std::is_pointer<typename _TStringSection::iterator_type>::value)
+				&& mse::impl::ra_section::are_contiguous_string_section_iterators<typename _TStringSection::iterator_type>::value> {};
+		}
+	}
+
+	template<typename _TChar = char, class _Traits = std::char_traits<_TChar> >
+	class TXScopeStringBuilder : public mse::us::impl::XScopeTagBase {
+	public:
+		typedef _TChar value_type;
+		typedef _Traits traits_type;
+		typedef size_t size_type;
+		typedef mse::nii_basic_string<_TChar, _Traits> owned_chunk_type;
+		typedef decltype(mse::make_xscope_string_const_section(std::declval<mse::TXScopeFixedConstPointer<owned_chunk_type> >())) piece_section_type;
+
+		TXScopeStringBuilder() {}
+		TXScopeStringBuilder(TXScopeStringBuilder&& src) = default;
+
+		/* References the contents of the given string section (if it's a non-scope section with contiguous storage),
+		otherwise copies them. */
+		template<typename _TStringSection, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value), void>::type>
+		TXScopeStringBuilder& append(const _TStringSection& section) {
+			return append_helper1(typename mse::impl::ns_string_builder::is_holdable_section<_TStringSection>::type(), section);
+		}
+		/* Copies the contents of the given string section. */
+		template<typename _TStringSection, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value), void>::type>
+		TXScopeStringBuilder& append_copy(const _TStringSection& section) {
+			const size_type count = section.size();
+			_TChar* dest = allocate_owned(count);
+			for (size_type i = 0; count > i; i += 1) {
+				dest[i] = section[i];
+			}
+			return (*this);
+		}
+		TXScopeStringBuilder& append(size_type count, const _TChar& ch) {
+			_Traits::assign(allocate_owned(count), count, ch);
+			return (*this);
+		}
+		TXScopeStringBuilder& append(const _TChar& ch) {
+			return append(1, ch);
+		}
+		/* Appends the representation of the given (integer or floating point) value (as produced by mse::to_chars()). */
+		template<typename _Ty, class = typename std::enable_if<(mse::impl::ns_string_numeric::is_supported_integer<_Ty>::value) || (std::is_floating_point<_Ty>::value), void>::type>
+		TXScopeStringBuilder& append_number(const _Ty& value, int base = 10) {
+			char buffer[mse::impl::ns_string_numeric::sc_format_buffer_size];
+			const size_t length = mse::impl::ns_string_numeric::to_chars_helper1(typename mse::impl::ns_string_numeric::is_supported_integer<_Ty>::type()
+				, buffer, value, base);
+			_TChar* dest = allocate_owned(length);
+			for (size_t i = 0; length > i; i += 1) {
+				dest[i] = _TChar(buffer[i]);
+			}
+			return (*this);
+		}
+
+		template<typename _TStringSection, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value), void>::type>
+		TXScopeStringBuilder& operator+=(const _TStringSection& section) { return append(section); }
+		TXScopeStringBuilder& operator+=(const _TChar& ch) { return append(ch); }
+
+		size_type size() const { return m_size; }
+		size_type length() const { return m_size; }
+		bool empty() const { return (0 == m_size); }
+		/* The number of (contiguous) pieces that make up the result. */
+		size_type piece_count() const { return m_pieces.size(); }
+
+		void clear() {
+			m_pieces.clear();
+			m_section_holders.clear();
+			m_owned_chunks.clear();
+			m_current_chunk_capacity = 0;
+			m_current_chunk_used = 0;
+			m_size = 0;
+		}
+
+		/* Calls the given function with each of the pieces (as (checked) scope string sections) that make up the
+		result, in order. Pieces stored in the builder are referenced, while (the current contents of) referenced
+		sections are passed as a temporary copy. */
+		template<typename _TFunction>
+		void for_each_section(const _TFunction& func) const {
+			for (size_type i = 0; m_pieces.size() > i; i += 1) {
+				const piece_t piece = m_pieces[i];
+				if (piece.m_section_holder_ptr) {
+					const auto sv = piece.m_section_holder_ptr->contiguous_view();
+					mse::TXScopeObj<owned_chunk_type> xscope_piece_copy(sv.data(), sv.size());
+					func(mse::make_xscope_string_const_section(mse::TXScopeFixedConstPointer<owned_chunk_type>(&xscope_piece_copy)));
+				}
+				else {
+					/* The builder outlives the call, so its storage can be referenced via a scope pointer. */
+					const auto xscope_chunk_csection = mse::make_xscope_string_const_section(mse::us::unsafe_make_xscope_const_pointer_to(*(piece.m_owned_chunk_ptr)));
+					func(mse::make_xscope_subsection(xscope_chunk_csection, piece.m_offset, piece.m_size));
+				}
+			}
+		}
+
+		/* Materializes the result with a single allocation. */
+		template<typename _TString = mse::nii_basic_string<_TChar, _Traits> >
+		_TString str() const {
+			_TString retval;
+			retval.reserve(m_size);
+			for (const auto& piece : m_pieces) {
+				const auto sv = piece_view(piece);
+				retval.append(sv.data(), sv.size());
+			}
+			return retval;
+		}
+
+		void xscope_tag() const {}
+
+	private:
+		TXScopeStringBuilder(const TXScopeStringBuilder&) = delete;
+		TXScopeStringBuilder& operator=(const TXScopeStringBuilder&) = delete;
+
+		/* Holdable sections are held, and their contents are accessed through them when needed. */
+		template<typename _TStringSection>
+		TXScopeStringBuilder& append_helper1(std::true_type, const _TStringSection& section) {
+			if (1 <= section.size()) {
+				typedef mse::impl::ns_string_builder::section_holder<_TChar, _Traits, _TStringSection> section_holder_t;
+				m_section_holders.emplace_back(std::unique_ptr<section_holder_base_t>(new section_holder_t(section)));
+				m_pieces.push_back(piece_t{ nullptr, section.size(), nullptr, 0, m_section_holders.back().get() });
+				m_size += section.size();
+			}
+			return (*this);
+		}
+		template<typename _TStringSection>
+		TXScopeStringBuilder& append_helper1(std::false_type, const _TStringSection& section) {
+			return append_copy(section);
+		}
+
+		typedef mse::impl::ns_string_builder::section_holder_base<_TChar, _Traits> section_holder_base_t;
+		typedef typename section_holder_base_t::string_view_t string_view_t;
+
+		struct piece_t {
+			const _TChar* m_data;
+			size_type m_size;
+			/* (For pieces stored in the builder's own storage.) */
+			const owned_chunk_type* m_owned_chunk_ptr;
+			size_type m_offset;
+			const section_holder_base_t* m_section_holder_ptr;
+		};
+		static string_view_t piece_view(const piece_t& piece) {
+			if (piece.m_section_holder_ptr) {
+				return piece.m_section_holder_ptr->contiguous_view();
+			}
+			return string_view_t(piece.m_data, piece.m_size);
+		}
+		/* Returns storage, owned by the builder, for the given number of characters, appending it to the result. */
+		_TChar* allocate_owned(size_type count) {
+			if (0 == count) {
+				return nullptr;
+			}
+			if (m_current_chunk_capacity - m_current_chunk_used < count) {
+				/* Chunk sizes grow geometrically (up to a limit) so that the number of allocations grows only
+				logarithmically with the amount of owned data. */
+				size_type new_capacity = (std::max)(size_type(sc_min_chunk_size), (std::min)(size_type(2 * m_current_chunk_capacity), size_type(sc_max_chunk_size)));
+				new_capacity = (std::max)(new_capacity, count);
+				m_owned_chunks.emplace_back(new owned_chunk_type(new_capacity, _TChar()));
+				m_current_chunk_capacity = new_capacity;
+				m_current_chunk_used = 0;
+			}
+			owned_chunk_type& chunk = *(m_owned_chunks.back());
+			const size_type offset = m_current_chunk_used;
+			_TChar* retval = std::addressof(chunk[offset]);
+			m_current_chunk_used += count;
+			m_size += count;
+			if ((1 <= m_pieces.size()) && (std::addressof(chunk) == m_pieces.back().m_owned_chunk_ptr)
+				&& (m_pieces.back().m_offset + m_pieces.back().m_size == offset)) {
+				/* Adjacent owned data is coalesced into a single piece. */
+				m_pieces.back().m_size += count;
+			}
+			else {
+				m_pieces.push_back(piece_t{ retval, count, std::addressof(chunk), offset, nullptr });
+			}
+			return retval;
+		}
+
+		static const size_type sc_min_chunk_size = 256;
+		static const size_type sc_max_chunk_size = 64 * 1024;
+
+		std::vector<piece_t> m_pieces;
+		std::vector<std::unique_ptr<section_holder_base_t> > m_section_holders;
+		/* The chunks are sized when they're created, and never resized, so their storage doesn't move. */
+		std::vector<std::unique_ptr<owned_chunk_type> > m_owned_chunks;
+		size_type m_current_chunk_capacity = 0;
+		size_type m_current_chunk_used = 0;
+		size_type m_size = 0;
+
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+	};
+}
+
+namespace mse {
 
-			//typedef typename base_class::xscope_iterator xscope_iterator;
-			typedef typename base_class::xscope_const_iterator xscope_const_iterator;
+	/* TStringInternPool<> maps string contents to compact "handles", so that (interned) strings can be compared and
+	hashed in constant time. The pool retains a single copy of each distinct string interned, and
+	TStringConstSection<>s referencing these copies can be obtained from the handles. These sections hold a
+	(reference counting) reference to the string they reference, so they remain valid for (at least) the lifetime of
+	the pool. The pool is not thread safe. */
 
-			void xscope_not_returnable_tag() const {}
-			void xscope_tag() const {}
+	template<typename _TChar, class _Traits> class TStringInternPool;
 
-		private:
-			template <typename _TRAContainer>
-			static mse::TXScopeFixedConstPointer<_TRAContainer> construction_helper1(std::true_type, const mse::TXScopeCagedItemFixedConstPointerToRValue<_TRAContainer>& caged_xscpptr) {
-				return mse::rsv::TXScopeFixedConstPointerFParam<_TRAContainer>(caged_xscpptr);
-			}
-			static mse::TXScopeNRPStringConstSection<_TRAIterator> construction_helper1(std::true_type, const mse::TXScopeCagedStringConstSectionToRValue<_TRAIterator>& caged_xscpsection) {
-				return caged_xscpsection.uncaged_string_section();
-			}
-			template <typename _TRALoneParam>
-			static auto construction_helper1(std::false_type, const _TRALoneParam& param) {
-				return param;
-			}
+	template<typename _TChar = char, class _Traits = std::char_traits<_TChar> >
+	class TInternedStringHandle {
+	public:
+		typedef uint32_t index_type;
 
-			MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
-		};
+		/* A default constructed handle doesn't refer to any string. */
+		TInternedStringHandle() {}
 
-		/* Template specializations of TFParam<>. */
+		bool operator==(const TInternedStringHandle& rhs) const { return (m_index == rhs.m_index); }
+		bool operator!=(const TInternedStringHandle& rhs) const { return !((*this) == rhs); }
+		/* Handles are ordered by interning order, not by the contents of the strings. */
+		bool operator<(const TInternedStringHandle& rhs) const { return (m_index < rhs.m_index); }
 
-		template<typename _Ty>
-		class TFParam<mse::TXScopeNRPStringConstSection<_Ty> > : public TXScopeNRPStringConstSectionFParam<_Ty> {
-		public:
-			typedef TXScopeNRPStringConstSectionFParam<_Ty> base_class;
-			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TFParam, base_class);
-			void xscope_not_returnable_tag() const {}
-			void xscope_tag() const {}
-		private:
-			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
-		};
+		bool is_valid() const { return (sc_invalid_index != m_index); }
+		explicit operator bool() const { return is_valid(); }
+		index_type index() const { return m_index; }
 
-		template<typename _Ty>
-		class TFParam<const mse::TXScopeNRPStringConstSection<_Ty> > : public TXScopeNRPStringConstSectionFParam<_Ty> {
-		public:
-			typedef TXScopeNRPStringConstSectionFParam<_Ty> base_class;
-			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TFParam, base_class);
-			void xscope_not_returnable_tag() const {}
-			void xscope_tag() const {}
-		private:
-			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
-		};
+	private:
+		explicit TInternedStringHandle(index_type index) : m_index(index) {}
 
-#if 0
-		template<typename _Ty>
-		class TFParam<mse::TXScopeCagedNRPStringConstSectionToRValue<_Ty> > : public TXScopeNRPStringConstSectionFParam<_Ty> {
-		public:
-			typedef TXScopeNRPStringConstSectionFParam<_Ty> base_class;
-			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TFParam, base_class);
-			void xscope_not_returnable_tag() const {}
-			void xscope_tag() const {}
-		private:
-			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
-		};
-#endif //0
+		static const index_type sc_invalid_index = index_type(-1);
+		index_type m_index = sc_invalid_index;
 
-		/* Template specializations of TReturnableFParam<>. */
+		friend class TStringInternPool<_TChar, _Traits>;
+	};
 
-		template<typename _Ty>
-		class TReturnableFParam<mse::TXScopeNRPStringConstSection<_Ty> > : public TXScopeNRPStringConstSection<_Ty> {
-		public:
-			typedef TXScopeNRPStringConstSection<_Ty> base_class;
-			MSE_INHERITED_STRING_SECTION_MEMBER_TYPE_AND_NPOS_DECLARATIONS(base_class);
-			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TReturnableFParam, base_class);
+	template<typename _TChar = char, class _Traits = std::char_traits<_TChar> >
+	class TStringInternPool {
+	public:
+		typedef TInternedStringHandle<_TChar, _Traits> handle_type;
+		typedef mse::nii_basic_string<_TChar, _Traits> string_type;
+		typedef mse::TRefCountingNotNullPointer<const string_type> string_pointer_type;
+		typedef decltype(mse::make_string_const_section(std::declval<string_pointer_type>())) section_type;
+		typedef size_t size_type;
 
-			/* Subsections of TReturnableFParam<mse::TXScopeNRPStringConstSection<_Ty> > can inherit the "returnability"
-			of the original section. */
-			auto xscope_subsection(size_type pos = 0, size_type n = npos) const {
-				typedef decltype(base_class::xscope_subsection(pos, n)) base_return_type;
-				return TReturnableFParam<base_return_type>(base_class::xscope_subsection(pos, n));
-			}
-			auto xscope_substr(size_type pos = 0, size_type n = npos) const {
-				return xscope_subsection(pos, n);
-			}
-			auto subsection(size_type pos = 0, size_type n = npos) const {
-				typedef decltype(base_class::subsection(pos, n)) base_return_type;
-				return TReturnableFParam<base_return_type>(base_class::subsection(pos, n));
-			}
-			auto substr(size_type pos = 0, size_type n = npos) const {
-				return subsection(pos, n);
-			}
+		TStringInternPool() {}
 
-			void returnable_once_tag() const {}
-			void xscope_returnable_tag() const {}
-			void xscope_tag() const {}
-		private:
-			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
-		};
+		/* Returns the handle of the string with the same contents as the given string section, adding a copy of the
+		string to the pool if it's not already present. */
+		template<typename _TStringSection, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value), void>::type>
+		handle_type intern(const _TStringSection& section) {
+			return intern_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<typename _TStringSection::iterator_type>::type(), section);
+		}
+		/* Returns the handle of the string with the same contents as the given string section, or an invalid handle if
+		the string has not been interned. */
+		template<typename _TStringSection, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value), void>::type>
+		handle_type find(const _TStringSection& section) const {
+			return find_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<typename _TStringSection::iterator_type>::type(), section);
+		}
 
-		template<typename _Ty>
-		class TReturnableFParam<const mse::TXScopeNRPStringConstSection<_Ty> > : public TXScopeNRPStringConstSection<_Ty> {
-		public:
-			typedef TXScopeNRPStringConstSection<_Ty> base_class;
-			MSE_INHERITED_STRING_SECTION_MEMBER_TYPE_AND_NPOS_DECLARATIONS(base_class);
-			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TReturnableFParam, base_class);
+		/* Returns a string section referencing the interned string corresponding to the given handle. */
+		section_type section(const handle_type& handle) const {
+			return mse::make_string_const_section(string_pointer(handle));
+		}
+		size_type length(const handle_type& handle) const {
+			return string_pointer(handle)->size();
+		}
 
-			/* Subsections of TReturnableFParam<const mse::TXScopeNRPStringConstSection<_Ty> > can inherit the "returnability"
-			of the original section. */
-			auto xscope_subsection(size_type pos = 0, size_type n = npos) const {
-				typedef decltype(base_class::xscope_subsection(pos, n)) base_return_type;
-				return TReturnableFParam<base_return_type>(base_class::xscope_subsection(pos, n));
-			}
-			auto xscope_substr(size_type pos = 0, size_type n = npos) const {
-				return xscope_subsection(pos, n);
-			}
-			auto subsection(size_type pos = 0, size_type n = npos) const {
-				typedef decltype(base_class::subsection(pos, n)) base_return_type;
-				return TReturnableFParam<base_return_type>(base_class::subsection(pos, n));
-			}
-			auto substr(size_type pos = 0, size_type n = npos) const {
-				return subsection(pos, n);
-			}
+		/* The number of distinct strings interned. */
+		size_type size() const { return m_strings.size(); }
+		bool empty() const { return m_strings.empty(); }
+		void reserve(size_type count) {
+			m_strings.reserve(count);
+			m_index_map.reserve(count);
+		}
 
-			void returnable_once_tag() const {}
-			void xscope_returnable_tag() const {}
-			void xscope_tag() const {}
-		private:
-			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
+	private:
+		typedef mse::us::impl::basic_string_view<_TChar, _Traits> string_view_type;
+		struct string_view_hash {
+			size_t operator()(const string_view_type& sv) const { return mse::us::impl::T_Hash_contiguous_elements(sv.data(), sv.size()); }
 		};
 
-		template<typename _Ty>
-		class TReturnableFParam<mse::TXScopeNRPStringSection<_Ty> > : public TXScopeNRPStringSection<_Ty> {
-		public:
-			typedef TXScopeNRPStringSection<_Ty> base_class;
-			MSE_INHERITED_STRING_SECTION_MEMBER_TYPE_AND_NPOS_DECLARATIONS(base_class);
-			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TReturnableFParam, base_class);
+		template<typename _TStringSection>
+		handle_type intern_helper1(std::true_type, const _TStringSection& section) {
+			const auto sv = mse::impl::ra_section::as_contiguous_string_view(section);
+			auto found_it = m_index_map.find(sv);
+			if (m_index_map.end() != found_it) {
+				return handle_type(found_it->second);
+			}
+			return add_string(mse::make_refcounting<const string_type>(sv.data(), sv.size()));
+		}
+		template<typename _TStringSection>
+		handle_type intern_helper1(std::false_type, const _TStringSection& section) {
+			/* The contents of non-contiguous sections are copied to (contiguous) temporary storage. */
+			const string_type str(section);
+			return intern_helper1(std::true_type(), mse::make_xscope_string_const_section(mse::us::unsafe_make_xscope_const_pointer_to(str)));
+		}
+		template<typename _TStringSection>
+		handle_type find_helper1(std::true_type, const _TStringSection& section) const {
+			auto found_it = m_index_map.find(mse::impl::ra_section::as_contiguous_string_view(section));
+			return (m_index_map.end() != found_it) ? handle_type(found_it->second) : handle_type();
+		}
+		template<typename _TStringSection>
+		handle_type find_helper1(std::false_type, const _TStringSection& section) const {
+			const string_type str(section);
+			return find_helper1(std::true_type(), mse::make_xscope_string_const_section(mse::us::unsafe_make_xscope_const_pointer_to(str)));
+		}
 
-			/* Subsections of TReturnableFParam<mse::TXScopeNRPStringSection<_Ty> > can inherit the "returnability"
-			of the original section. */
-			auto xscope_subsection(size_type pos = 0, size_type n = npos) const {
-				typedef decltype(base_class::xscope_subsection(pos, n)) base_return_type;
-				return TReturnableFParam<base_return_type>(base_class::xscope_subsection(pos, n));
+		handle_type add_string(const string_pointer_type& str_ptr) {
+			if (handle_type::sc_invalid_index <= m_strings.size()) {
+				MSE_THROW(std::length_error("too many strings - TStringInternPool::intern()"));
 			}
-			auto xscope_substr(size_type pos = 0, size_type n = npos) const {
-				return xscope_subsection(pos, n);
+			const auto index = typename handle_type::index_type(m_strings.size());
+			m_strings.push_back(str_ptr);
+			/* The (heap allocated) interned strings are never modified or moved, so the map keys can reference their
+			contents directly. */
+			const auto sv = (1 <= str_ptr->size()) ? string_view_type(std::addressof((*str_ptr)[0]), str_ptr->size()) : string_view_type();
+			m_index_map.emplace(sv, index);
+			return handle_type(index);
+		}
+		const string_pointer_type& string_pointer(const handle_type& handle) const {
+			if (m_strings.size() <= handle.m_index) {
+				MSE_THROW(std::out_of_range("invalid handle - TStringInternPool"));
 			}
-			auto subsection(size_type pos = 0, size_type n = npos) const {
-				typedef decltype(base_class::subsection(pos, n)) base_return_type;
-				return TReturnableFParam<base_return_type>(base_class::subsection(pos, n));
+			return m_strings[handle.m_index];
+		}
+
+		std::vector<string_pointer_type> m_strings;
+		std::unordered_map<string_view_type, typename handle_type::index_type, string_view_hash> m_index_map;
+	};
+}
+
+namespace std {
+	template<typename _TChar, class _Traits>
+	struct hash<mse::TInternedStringHandle<_TChar, _Traits> > {
+		size_t operator()(const mse::TInternedStringHandle<_TChar, _Traits>& _Keyval) const {
+			return size_t(_Keyval.index());
+		}
+	};
+}
+
+namespace mse {
+
+	/* UTF-8 validation and decoding of (single byte character) string sections. For sections that reference
+	contiguous storage, validation uses (on x86-64) a vectorized (AVX2, or SSE2 for mostly ascii text)
+	implementation. */
+
+	namespace impl {
+		namespace ns_utf8 {
+			template<typename _TStringSection>
+			struct is_byte_string_section : std::integral_constant<bool, (std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value)
+				&& (1 == sizeof(typename _TStringSection::value_type)) && (std::is_integral<typename std::remove_const<typename _TStringSection::value_type>::type>::value)> {};
+
+			template<typename _TStringSection>
+			size_t find_invalid_helper1(std::true_type, const _TStringSection& section) {
+				const auto sv = mse::impl::ra_section::as_contiguous_string_view(section);
+				return mse::us::impl::z_utf8_find_invalid(reinterpret_cast<const unsigned char*>(sv.data()), sv.size());
 			}
-			auto substr(size_type pos = 0, size_type n = npos) const {
-				return subsection(pos, n);
+			template<typename _TStringSection>
+			size_t find_invalid_helper1(std::false_type, const _TStringSection& section) {
+				return mse::us::impl::z_utf8_find_invalid_scalar(mse::impl::ns_string_numeric::make_reader(section), 0, section.size());
 			}
+		}
+	}
 
-			void returnable_once_tag() const {}
-			void xscope_returnable_tag() const {}
-			void xscope_tag() const {}
-		private:
-			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
-		};
+	/* Returns the position of the first byte that is not part of a valid UTF-8 encoded code point, or npos if the
+	entire section is valid UTF-8. (Overlong encodings, surrogates and values beyond U+10FFFF are invalid.) */
+	template<typename _TStringSection, class = typename std::enable_if<(mse::impl::ns_utf8::is_byte_string_section<_TStringSection>::value), void>::type>
+	typename _TStringSection::size_type find_invalid_utf8(const _TStringSection& section) {
+		const size_t res = mse::impl::ns_utf8::find_invalid_helper1(typename mse::impl::ra_section::are_contiguous_string_section_iterators<typename _TStringSection::iterator_type>::type(), section);
+		return (size_t(-1) == res) ? _TStringSection::npos : typename _TStringSection::size_type(res);
+	}
+	template<typename _TStringSection, class = typename std::enable_if<(mse::impl::ns_utf8::is_byte_string_section<_TStringSection>::value), void>::type>
+	bool is_valid_utf8(const _TStringSection& section) {
+		return (_TStringSection::npos == mse::find_invalid_utf8(section));
+	}
 
-		template<typename _Ty>
-		class TReturnableFParam<const mse::TXScopeNRPStringSection<_Ty> > : public TXScopeNRPStringSection<_Ty> {
+	/* TXScopeUTF8CodePointSection<> presents a (UTF-8 encoded) string section as a (forward traversable) sequence of
+	(char32_t) code points. Invalid (or truncated) sequences are presented as individual U+FFFD replacement
+	characters, one per invalid byte. */
+	template<typename _TStringSection>
+	class TXScopeUTF8CodePointSection : public mse::us::impl::XScopeTagBase {
+	public:
+		typedef char32_t value_type;
+		typedef size_t size_type;
+		static const char32_t replacement_character = 0xFFFD;
+		static const size_type npos = size_type(-1);
+
+		explicit TXScopeUTF8CodePointSection(const _TStringSection& section) : m_section(section) {}
+
+		class xscope_const_iterator : public mse::us::impl::XScopeTagBase {
 		public:
-			typedef TXScopeNRPStringSection<_Ty> base_class;
-			MSE_INHERITED_STRING_SECTION_MEMBER_TYPE_AND_NPOS_DECLARATIONS(base_class);
-			MSE_USING_AND_DEFAULT_COPY_AND_MOVE_CONSTRUCTOR_DECLARATIONS(TReturnableFParam, base_class);
+			typedef std::forward_iterator_tag iterator_category;
+			typedef char32_t value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const char32_t* pointer;
+			typedef char32_t reference;
 
-			/* Subsections of TReturnableFParam<const mse::TXScopeNRPStringSection<_Ty> > can inherit the "returnability"
-			of the original section. */
-			auto xscope_subsection(size_type pos = 0, size_type n = npos) const {
-				typedef decltype(base_class::xscope_subsection(pos, n)) base_return_type;
-				return TReturnableFParam<base_return_type>(base_class::xscope_subsection(pos, n));
+			xscope_const_iterator(const xscope_const_iterator& src) = default;
+
+			char32_t operator*() const {
+				if (npos == m_pos) {
+					MSE_THROW(std::out_of_range("attempt to dereference an end iterator - TXScopeUTF8CodePointSection::xscope_const_iterator"));
+				}
+				return m_code_point;
 			}
-			auto xscope_substr(size_type pos = 0, size_type n = npos) const {
-				return xscope_subsection(pos, n);
+			xscope_const_iterator& operator++() {
+				if (npos == m_pos) {
+					MSE_THROW(std::out_of_range("attempt to increment an end iterator - TXScopeUTF8CodePointSection::xscope_const_iterator"));
+				}
+				set_position(m_pos + m_length);
+				return (*this);
 			}
-			auto subsection(size_type pos = 0, size_type n = npos) const {
-				typedef decltype(base_class::subsection(pos, n)) base_return_type;
-				return TReturnableFParam<base_return_type>(base_class::subsection(pos, n));
+			xscope_const_iterator operator++(int) {
+				xscope_const_iterator retval(*this);
+				++(*this);
+				return retval;
 			}
-			auto substr(size_type pos = 0, size_type n = npos) const {
-				return subsection(pos, n);
+			bool operator==(const xscope_const_iterator& other) const {
+				return (m_code_point_section_ptr == other.m_code_point_section_ptr) && (m_pos == other.m_pos);
 			}
+			bool operator!=(const xscope_const_iterator& other) const { return !((*this) == other); }
+
+			/* The (byte) position, in the underlying string section, of the current code point. */
+			size_type position() const { return m_pos; }
+			/* The number of bytes encoding the current code point. */
+			size_type length() const { return m_length; }
+			/* Whether the current code point was decoded from a valid UTF-8 sequence. */
+			bool is_valid() const { return m_is_valid; }
 
-			void returnable_once_tag() const {}
-			void xscope_returnable_tag() const {}
-			void xscope_tag() const {}
 		private:
-			MSE_USING_ASSIGNMENT_OPERATOR_AND_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION(base_class);
-		};
-	}
+			xscope_const_iterator(const TXScopeUTF8CodePointSection& code_point_section, size_type pos) : m_code_point_section_ptr(std::addressof(code_point_section)) {
+				set_position(pos);
+			}
+			void set_position(size_type pos) {
+				const auto& section = m_code_point_section_ptr->m_section;
+				if ((npos == pos) || (section.size() <= pos)) {
+					m_pos = npos;
+					m_length = 0;
+					return;
+				}
+				m_pos = pos;
+				char32_t code_point = 0;
+				const size_t length = mse::us::impl::z_utf8_decode(mse::impl::ns_string_numeric::make_reader(section), pos, section.size(), code_point);
+				m_is_valid = (0 != length);
+				m_length = m_is_valid ? length : 1;
+				m_code_point = m_is_valid ? code_point : char32_t(replacement_character);
+			}
+
+			const TXScopeUTF8CodePointSection* m_code_point_section_ptr = nullptr;
+			size_type m_pos = npos;
+			size_type m_length = 0;
+			char32_t m_code_point = 0;
+			bool m_is_valid = false;
 
-	template <typename _TElement, class _Traits = std::char_traits<_TElement> >
-	using TXScopeCSSSXSTENRPStringConstSection = TXScopeNRPStringConstSection<TXScopeCSSSXSTERAConstIterator<_TElement>, _Traits>;
-	template <typename _TElement, class _Traits = std::char_traits<_TElement> >
-	using TXScopeCSSSXSTENRPStringSection = TXScopeNRPStringSection<TXScopeCSSSXSTERAIterator<_TElement>, _Traits>;
-}
+			MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
 
-namespace std {
+			friend class TXScopeUTF8CodePointSection;
+		};
 
-	template <typename _TRAIterator, class _Traits>
-	struct hash<mse::TXScopeNRPStringSection<_TRAIterator, _Traits> > : public hash<mse::TXScopeStringSection<_TRAIterator, _Traits> > {
-		typedef hash<mse::TXScopeStringSection<_TRAIterator, _Traits> > base_class;
-		typedef typename base_class::argument_type argument_type;
-		typedef typename base_class::result_type result_type;
-	};
+		/* The iterators refer to the code point section, so they can't be obtained from a temporary one. */
+		xscope_const_iterator begin() const & { return xscope_const_iterator(*this, 0); }
+		xscope_const_iterator end() const & { return xscope_const_iterator(*this, npos); }
+		xscope_const_iterator cbegin() const & { return begin(); }
+		xscope_const_iterator cend() const & { return end(); }
+		void begin() const && = delete;
+		void end() const && = delete;
+		void cbegin() const && = delete;
+		void cend() const && = delete;
+
+		/* The number of code points (including replacement characters). Note that this requires a traversal. */
+		size_type count() const {
+			size_type retval = 0;
+			for (auto iter = begin(); end() != iter; ++iter) {
+				retval += 1;
+			}
+			return retval;
+		}
+		/* The size, in bytes, of the underlying string section. */
+		size_type byte_size() const { return m_section.size(); }
+		bool empty() const { return (0 == m_section.size()); }
 
-	template <typename _TRAIterator, class _Traits>
-	struct hash<mse::TNRPStringSection<_TRAIterator, _Traits> > : public hash<mse::TStringSection<_TRAIterator, _Traits> > {
-		typedef hash<mse::TNRPStringSection<_TRAIterator, _Traits> > base_class;
-		typedef typename base_class::argument_type argument_type;
-		typedef typename base_class::result_type result_type;
-	};
+		void xscope_tag() const {}
 
-	template <typename _TRAIterator, class _Traits>
-	struct hash<mse::TXScopeNRPStringConstSection<_TRAIterator, _Traits> > : public hash<mse::TXScopeStringConstSection<_TRAIterator, _Traits> > {
-		typedef hash<mse::TXScopeStringConstSection<_TRAIterator, _Traits> > base_class;
-		typedef typename base_class::argument_type argument_type;
-		typedef typename base_class::result_type result_type;
-	};
+	private:
+		TXScopeUTF8CodePointSection& operator=(const TXScopeUTF8CodePointSection&) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
 
-	template <typename _TRAIterator, class _Traits>
-	struct hash<mse::TNRPStringConstSection<_TRAIterator, _Traits> > : public hash<mse::TStringConstSection<_TRAIterator, _Traits> > {
-		typedef hash<mse::TStringConstSection<_TRAIterator, _Traits> > base_class;
-		typedef typename base_class::argument_type argument_type;
-		typedef typename base_class::result_type result_type;
+		_TStringSection m_section;
 	};
-}
 
-namespace mse {
-
-	/* shorter aliases */
-	template <typename... Args>
-	auto mknss(Args&&... args) -> decltype(make_nrp_string_section(std::forward<Args>(args)...)) {
-		return make_nrp_string_section(std::forward<Args>(args)...);
-	}
-	template <typename... Args>
-	auto mknscs(Args&&... args) -> decltype(make_nrp_string_const_section(std::forward<Args>(args)...)) {
-		return make_nrp_string_const_section(std::forward<Args>(args)...);
+	template<typename _TStringSection, class = typename std::enable_if<(mse::impl::ns_utf8::is_byte_string_section<_TStringSection>::value), void>::type>
+	auto make_xscope_utf8_code_point_section(const _TStringSection& section) {
+		return TXScopeUTF8CodePointSection<_TStringSection>(section);
 	}
 }
 
@@ -3522,6 +5645,11 @@ namespace mse {
 					structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
 					return std::move(*this).value();
 				}
+				/* The search member functions use the (vectorized, where supported) string_view search implementations. */
+				mse::us::impl::basic_string_view<_Ty, _Traits> contained_string_view_pv() const {
+					const auto& cbs_cref = contained_basic_string();
+					return mse::us::impl::basic_string_view<_Ty, _Traits>(cbs_cref.data(), cbs_cref.size());
+				}
 
 			public:
 				explicit gnii_basic_string(const _A& _Al = _A()) : base_class(_Al) { /*m_debug_size = size();*/ }
@@ -4873,7 +7001,7 @@ namespace mse {
 				template<class _StringViewIsh>
 				size_type find_helper2(std::true_type, const _StringViewIsh& _Right, const size_type _Off = npos) const {
 					std::basic_string_view<_Ty, _Traits> _As_view = _Right;
-					return contained_basic_string().find(_As_view, mse::as_a_size_t(_Off));
+					return contained_string_view_pv().find(_As_view.data(), mse::as_a_size_t(_Off), _As_view.size());
 				}
 				template<class _TParam1>
 				size_type find_helper2(std::false_type, const _TParam1& _Right, const size_type _Off = npos) const {
@@ -4900,19 +7028,19 @@ namespace mse {
 		#endif /* MSE_HAS_CXX17 */
 
 				size_type find(const gnii_basic_string& _Right, const size_type _Off = 0) const _NOEXCEPT {
-					return contained_basic_string().find(_Right.contained_basic_string(), _Off);
+					return contained_string_view_pv().find(_Right.contained_string_view_pv(), mse::as_a_size_t(_Off));
 				}
 
 				size_type find(const _Ty * const _Ptr, const size_type _Off, const size_type _Count) const _NOEXCEPT {
-					return contained_basic_string().find(_Ptr, _Off, _Count);
+					return contained_string_view_pv().find(_Ptr, mse::as_a_size_t(_Off), mse::as_a_size_t(_Count));
 				}
 
 				size_type find(const _Ty * const _Ptr, const size_type _Off = 0) const _NOEXCEPT {
-					return contained_basic_string().find(_Ptr, _Off);
+					return contained_string_view_pv().find(_Ptr, mse::as_a_size_t(_Off));
 				}
 
 				size_type find(const _Ty _Ch, const size_type _Off = 0) const _NOEXCEPT {
-					return contained_basic_string().find(_Ch, _Off);
+					return contained_string_view_pv().find(_Ch, mse::as_a_size_t(_Off));
 				}
 
 		#ifdef MSE_HAS_CXX17
@@ -4920,7 +7048,7 @@ namespace mse {
 				template<class _StringViewIsh>
 				size_type rfind_helper2(std::true_type, const _StringViewIsh& _Right, const size_type _Off = npos) const {
 					std::basic_string_view<_Ty, _Traits> _As_view = _Right;
-					return contained_basic_string().rfind(_As_view, mse::as_a_size_t(_Off));
+					return contained_string_view_pv().rfind(_As_view.data(), mse::as_a_size_t(_Off), _As_view.size());
 				}
 				template<class _TParam1>
 				size_type rfind_helper2(std::false_type, const _TParam1& _Right, const size_type _Off = npos) const {
@@ -4947,19 +7075,19 @@ namespace mse {
 		#endif /* MSE_HAS_CXX17 */
 
 				size_type rfind(const gnii_basic_string& _Right, const size_type _Off = npos) const _NOEXCEPT {
-					return contained_basic_string().rfind(_Right.contained_basic_string(), _Off);
+					return contained_string_view_pv().rfind(_Right.contained_string_view_pv(), mse::as_a_size_t(_Off));
 				}
 
 				size_type rfind(const _Ty * const _Ptr, const size_type _Off, const size_type _Count) const _NOEXCEPT {
-					return contained_basic_string().rfind(_Ptr, _Off, _Count);
+					return contained_string_view_pv().rfind(_Ptr, mse::as_a_size_t(_Off), mse::as_a_size_t(_Count));
 				}
 
 				size_type rfind(const _Ty * const _Ptr, const size_type _Off = npos) const _NOEXCEPT {
-					return contained_basic_string().rfind(_Ptr, _Off);
+					return contained_string_view_pv().rfind(_Ptr, mse::as_a_size_t(_Off));
 				}
 
 				size_type rfind(const _Ty _Ch, const size_type _Off = npos) const _NOEXCEPT {
-					return contained_basic_string().rfind(_Ch, _Off);
+					return contained_string_view_pv().rfind(_Ch, mse::as_a_size_t(_Off));
 				}
 
 		#if 0//_HAS_CXX17
@@ -4972,20 +7100,20 @@ namespace mse {
 		#endif /* _HAS_CXX17 */
 
 				size_type find_first_of(const gnii_basic_string& _Right, const size_type _Off = 0) const _NOEXCEPT {
-					return contained_basic_string().find_first_of(_Right.contained_basic_string(), _Off);
+					return contained_string_view_pv().find_first_of(_Right.contained_string_view_pv(), mse::as_a_size_t(_Off));
 				}
 
 				size_type find_first_of(const _Ty * const _Ptr, const size_type _Off,
 					const size_type _Count) const _NOEXCEPT {
-					return contained_basic_string().find_first_of(_Ptr, _Off, _Count);
+					return contained_string_view_pv().find_first_of(_Ptr, mse::as_a_size_t(_Off), mse::as_a_size_t(_Count));
 				}
 
 				size_type find_first_of(const _Ty * const _Ptr, const size_type _Off = 0) const _NOEXCEPT {
-					return contained_basic_string().find_first_of(_Ptr, _Off);
+					return contained_string_view_pv().find_first_of(_Ptr, mse::as_a_size_t(_Off));
 				}
 
 				size_type find_first_of(const _Ty _Ch, const size_type _Off = 0) const _NOEXCEPT {
-					return contained_basic_string().find_first_of(_Ch, _Off);
+					return contained_string_view_pv().find_first_of(_Ch, mse::as_a_size_t(_Off));
 				}
 
 		#if 0//_HAS_CXX17
@@ -4998,20 +7126,20 @@ namespace mse {
 		#endif /* _HAS_CXX17 */
 
 				size_type find_last_of(const gnii_basic_string& _Right, size_type _Off = npos) const _NOEXCEPT {
-					return contained_basic_string().find_last_of(_Right.contained_basic_string(), _Off);
+					return contained_string_view_pv().find_last_of(_Right.contained_string_view_pv(), mse::as_a_size_t(_Off));
 				}
 
 				size_type find_last_of(const _Ty * const _Ptr, const size_type _Off,
 					const size_type _Count) const _NOEXCEPT {
-					return contained_basic_string().find_last_of(_Ptr, _Off, _Count);
+					return contained_string_view_pv().find_last_of(_Ptr, mse::as_a_size_t(_Off), mse::as_a_size_t(_Count));
 				}
 
 				size_type find_last_of(const _Ty * const _Ptr, const size_type _Off = npos) const _NOEXCEPT {
-					return contained_basic_string().find_last_of(_Ptr, _Off);
+					return contained_string_view_pv().find_last_of(_Ptr, mse::as_a_size_t(_Off));
 				}
 
 				size_type find_last_of(const _Ty _Ch, const size_type _Off = npos) const _NOEXCEPT {
-					return contained_basic_string().find_last_of(_Ch, _Off);
+					return contained_string_view_pv().find_last_of(_Ch, mse::as_a_size_t(_Off));
 				}
 
 		#if 0//_HAS_CXX17
@@ -5563,16 +7691,13 @@ namespace std {
 
 	template<class _Elem, class _Traits, class _Alloc, class _TStateMutex, template<typename> class _TTXScopeConstIterator>
 	struct hash<mse::us::impl::gnii_basic_string<_Elem, _Traits, _Alloc, _TStateMutex, _TTXScopeConstIterator> > {	// hash functor for mse::us::impl::gnii_basic_string
-		typedef typename mse::us::impl::gnii_basic_string<_Elem, _Traits, _Alloc, _TStateMutex, _TTXScopeConstIterator>::base_class basic_string_t;
 		using argument_type = mse::us::impl::gnii_basic_string<_Elem, _Traits, _Alloc, _TStateMutex, _TTXScopeConstIterator>;
 		using result_type = size_t;
 
 		size_t operator()(const mse::us::impl::gnii_basic_string<_Elem, _Traits, _Alloc, _TStateMutex, _TTXScopeConstIterator>& _Keyval) const _NOEXCEPT {
-			auto retval = m_bs_hash(_Keyval.contained_basic_string());
+			auto retval = mse::us::impl::T_Hash_basic_string(_Keyval.contained_basic_string());
 			return retval;
 		}
-
-		hash<basic_string_t> m_bs_hash;
 	};
 
 	template<class _Elem, class _Traits, class _Alloc, class _TStateMutex, template<typename> class _TTXScopeConstIterator>
@@ -94,7 +94,7 @@ namespace mse {
 		template<class _StateMutex>
 		class destructor_lock_guard1 {
 		public:
-			explicit destructor_lock_guard1(_StateMutex& _Mtx) : _MyStateMutex(_Mtx) {
+			explicit MSE_CONSTEXPR20 destructor_lock_guard1(_StateMutex& _Mtx) : _MyStateMutex(_Mtx) {
 				MSE_TRY {
 					_Mtx.lock();
 				}
@@ -107,7 +107,7 @@ namespace mse {
 					assert(false); std::terminate();
 				}
 			}
-			~destructor_lock_guard1() _NOEXCEPT {
+			MSE_CONSTEXPR20 ~destructor_lock_guard1() _NOEXCEPT {
 				_MyStateMutex.unlock();
 			}
 			destructor_lock_guard1(const destructor_lock_guard1&) = delete;
@@ -188,14 +188,14 @@ namespace mse {
 
 	class non_thread_safe_mutex {
 	public:
-		non_thread_safe_mutex() {}
-		void lock() {	// lock exclusive
+		MSE_CONSTEXPR20 non_thread_safe_mutex() {}
+		MSE_CONSTEXPR20 void lock() {	// lock exclusive
 			if (m_is_locked) {
 				MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
 			}
 			m_is_locked = true;
 		}
-		bool try_lock() {	// try to lock exclusive
+		MSE_CONSTEXPR20 bool try_lock() {	// try to lock exclusive
 			if (m_is_locked) {
 				return false;
 			}
@@ -213,7 +213,7 @@ namespace mse {
 		bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {	// try to lock until time point
 			return try_lock();
 		}
-		void unlock() {	// unlock exclusive
+		MSE_CONSTEXPR20 void unlock() {	// unlock exclusive
 			assert(m_is_locked);
 			m_is_locked = false;
 		}
@@ -279,10 +279,10 @@ namespace mse {
 
 	class dummy_recursive_shared_timed_mutex {
 	public:
-		dummy_recursive_shared_timed_mutex() {}
-		void lock() {
+		MSE_CONSTEXPR20 dummy_recursive_shared_timed_mutex() {}
+		MSE_CONSTEXPR20 void lock() {
 		}
-		bool try_lock() {
+		MSE_CONSTEXPR20 bool try_lock() {
 			return true;
 		}
 		template<class _Rep, class _Period>
@@ -293,12 +293,12 @@ namespace mse {
 		bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {	// try to lock until time point
 			return try_lock();
 		}
-		void unlock() {
+		MSE_CONSTEXPR20 void unlock() {
 		}
-		void nonrecursive_lock() {
+		MSE_CONSTEXPR20 void nonrecursive_lock() {
 			lock();
 		}
-		bool try_nonrecursive_lock() {	// try to lock nonrecursive
+		MSE_CONSTEXPR20 bool try_nonrecursive_lock() {	// try to lock nonrecursive
 			return try_lock();
 		}
 		template<class _Rep, class _Period>
@@ -309,12 +309,12 @@ namespace mse {
 		bool try_nonrecursive_lock_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {	// try to nonrecursive lock until time point
 			return try_lock_until(_Abs_time);
 		}
-		void nonrecursive_unlock() {
+		MSE_CONSTEXPR20 void nonrecursive_unlock() {
 			unlock();
 		}
-		void lock_shared() {	// lock non-exclusive
+		MSE_CONSTEXPR20 void lock_shared() {	// lock non-exclusive
 		}
-		bool try_lock_shared() {	// try to lock non-exclusive
+		MSE_CONSTEXPR20 bool try_lock_shared() {	// try to lock non-exclusive
 			return true;
 		}
 		template<class _Rep, class _Period>
@@ -325,7 +325,7 @@ namespace mse {
 		bool try_lock_shared_until(const std::chrono::time_point<_Clock, _Duration>& _Abs_time) {	// try to lock non-exclusive until absolute time
 			return try_lock_shared();
 		}
-		void unlock_shared() {	// unlock non-exclusive
+		MSE_CONSTEXPR20 void unlock_shared() {	// unlock non-exclusive
 		}
 
 		dummy_recursive_shared_timed_mutex(const dummy_recursive_shared_timed_mutex&) = delete;
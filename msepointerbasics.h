@@ -21,11 +21,17 @@
 #if __cplusplus >= 201703L
 #define MSE_HAS_CXX17
 #endif // __cplusplus >= 201703L
+#if __cplusplus >= 202002L
+#define MSE_HAS_CXX20
+#endif // __cplusplus >= 202002L
 /*compiler specific defines*/
 #ifdef _MSC_VER
 #if _MSVC_LANG >= 201703L || (defined(_HAS_CXX17) && (_HAS_CXX17 >= 1))
 #define MSE_HAS_CXX17
 #endif // _MSVC_LANG >= 201703L || (defined(_HAS_CXX17) && (_HAS_CXX17 >= 1))
+#if _MSVC_LANG >= 202002L
+#define MSE_HAS_CXX20
+#endif // _MSVC_LANG >= 202002L
 #if (1700 > _MSC_VER)
 #define MSVC2010_COMPATIBLE 1
 #endif /*(1700 > _MSC_VER)*/
@@ -226,12 +232,23 @@ namespace mse {
 
 #define MSE_IMPL_DESTRUCTOR_PREFIX1
 
+/* Some elements (like nii_array<>) support being used in constant expressions, but only as of C++20, which permits
+constexpr destructors and try blocks in constexpr functions. */
+#ifdef MSE_HAS_CXX20
+#define MSE_CONSTEXPR20 constexpr
+#else // MSE_HAS_CXX20
+#define MSE_CONSTEXPR20
+#endif // MSE_HAS_CXX20
+
 	/* This macro roughly simulates constructor inheritance. */
 #define MSE_USING_V1(Derived, Base) \
     template<typename ...Args, typename = typename std::enable_if<std::is_constructible<Base, Args...>::value>::type> \
     Derived(Args &&...args) : Base(std::forward<Args>(args)...) {}
 
 	namespace impl {
+		/* A common cache line size (which we assume, in lieu of a portable way to obtain it). */
+		static const size_t sc_cache_line_size = 64;
+
 		template<bool _Val>
 		struct Cat_base_msepointerbasics : std::integral_constant<bool, _Val> {	// base class for type predicates
 		};
@@ -254,7 +271,7 @@ namespace mse {
 	std::is_constructible<Base, Args...>::value \
 	&& !mse::impl::is_a_pair_with_the_first_a_base_of_the_second_msepointerbasics<Derived, Args...>::value \
 	>::type> \
-    Derived(Args &&...args) : Base(std::forward<Args>(args)...) {}
+    MSE_CONSTEXPR20 Derived(Args &&...args) : Base(std::forward<Args>(args)...) {}
 
 	/* This macro roughly simulates constructor inheritance, but adds an additional initialization statement
 	to each constructor. */
@@ -937,6 +937,193 @@ namespace std {
 
 namespace mse {
 
+	/* TXScopeCacheLineAlignedAtomicObj<> is a version of TXScopeAtomicObj<> that is aligned to, and occupies a whole
+	multiple of, the (presumed) cache line size. So unlike adjacent TXScopeAtomicObj<>s, adjacent
+	TXScopeCacheLineAlignedAtomicObj<>s (in a struct or array, for example) don't share a cache line, and threads
+	modifying different ones don't contend with each other (i.e. there's no "false sharing"). Pointers to it are just
+	(passable) TXScopeAtomicFixedPointer<>s. */
+	template<typename _TROy>
+	class alignas(mse::impl::sc_cache_line_size) TXScopeCacheLineAlignedAtomicObj : public TXScopeAtomicObj<_TROy> {
+	public:
+		typedef TXScopeAtomicObj<_TROy> base_class;
+		MSE_SCOPE_ATOMIC_USING(TXScopeCacheLineAlignedAtomicObj, base_class);
+		using base_class::operator=;
+	};
+
+	namespace impl {
+		namespace ns_scope_atomic {
+			/* A counter split into a number of "stripes", each residing in its own cache line. Each thread adds to
+			(and subtracts from) "its" stripe (assigned in round-robin fashion), so threads concurrently modifying the
+			counter don't (generally) contend for the same cache line. The value of the counter is the sum of the
+			stripes. */
+			template<typename _Ty>
+			class TShardedAtomicCounterState {
+			public:
+				static_assert(std::is_integral<_Ty>::value, "the value type of a sharded atomic counter must be an integral type - mse::TXScopeShardedAtomicCounter<>");
+
+				TShardedAtomicCounterState(_Ty initial_value = _Ty(0)) {
+					m_stripes[0].m_value.store(initial_value, std::memory_order_relaxed);
+				}
+
+				void add(_Ty x, std::memory_order order = std::memory_order_relaxed) {
+					this_thread_stripe().m_value.fetch_add(x, order);
+				}
+				void subtract(_Ty x, std::memory_order order = std::memory_order_relaxed) {
+					this_thread_stripe().m_value.fetch_sub(x, order);
+				}
+				void operator+=(_Ty x) { add(x); }
+				void operator-=(_Ty x) { subtract(x); }
+				void operator++() { add(_Ty(1)); }
+				void operator++(int) { add(_Ty(1)); }
+				void operator--() { subtract(_Ty(1)); }
+				void operator--(int) { subtract(_Ty(1)); }
+
+				/* Returns the sum of the stripes. Note that if the counter is being concurrently modified, the result
+				does not necessarily correspond to the value of the counter at any single point in time. */
+				_Ty load(std::memory_order order = std::memory_order_seq_cst) const {
+					_Ty sum = _Ty(0);
+					for (const auto& stripe : m_stripes) {
+						sum += stripe.m_value.load(order);
+					}
+					return sum;
+				}
+				operator _Ty() const { return load(); }
+
+			private:
+				TShardedAtomicCounterState(const TShardedAtomicCounterState&) = delete;
+				TShardedAtomicCounterState& operator=(const TShardedAtomicCounterState&) = delete;
+
+				static const size_t sc_stripe_count = 16;
+
+				struct alignas(mse::impl::sc_cache_line_size) stripe_t {
+					std::atomic<_Ty> m_value{ _Ty(0) };
+				};
+
+				stripe_t& this_thread_stripe() {
+					return m_stripes[mse::rsv::impl::cts::this_thread_round_robin_index() % sc_stripe_count];
+				}
+
+				stripe_t m_stripes[sc_stripe_count];
+			};
+		}
+	}
+
+#ifdef MSE_SCOPEPOINTER_DISABLED
+	template<typename _Ty> using TXScopeShardedAtomicCounter = mse::impl::ns_scope_atomic::TShardedAtomicCounterState<_Ty>;
+	template<typename _Ty> using TXScopeShardedAtomicCounterFixedPointer = TXScopeShardedAtomicCounter<_Ty>* /*const*/;
+	template<typename _Ty> using TXScopeShardedAtomicCounterFixedConstPointer = const TXScopeShardedAtomicCounter<_Ty>* /*const*/;
+#else /*MSE_SCOPEPOINTER_DISABLED*/
+
+	template<typename _Ty> class TXScopeShardedAtomicCounter;
+
+	namespace us {
+		namespace impl {
+#ifdef MSE_SCOPEPOINTER_RUNTIME_CHECKS_ENABLED
+			template<typename _Ty> using TXScopeShardedAtomicCounterBase = mse::rsv::impl::cts::TCheckedThreadSafeObj<mse::impl::ns_scope_atomic::TShardedAtomicCounterState<_Ty> >;
+			template<typename _Ty> using TXScopeShardedAtomicCounterPointerBase = mse::rsv::impl::cts::TCheckedThreadSafePointer<mse::impl::ns_scope_atomic::TShardedAtomicCounterState<_Ty> >;
+			template<typename _Ty> using TXScopeShardedAtomicCounterConstPointerBase = mse::rsv::impl::cts::TCheckedThreadSafeConstPointer<mse::impl::ns_scope_atomic::TShardedAtomicCounterState<_Ty> >;
+#else // MSE_SCOPEPOINTER_RUNTIME_CHECKS_ENABLED
+			template<typename _Ty> using TXScopeShardedAtomicCounterBase = mse::impl::ns_scope_atomic::TShardedAtomicCounterState<_Ty>;
+			template<typename _Ty> using TXScopeShardedAtomicCounterPointerBase = mse::us::impl::TPointerForLegacy<TXScopeShardedAtomicCounterBase<_Ty>, mse::impl::TScopeAtomicID<const TXScopeShardedAtomicCounterBase<_Ty> > >;
+			template<typename _Ty> using TXScopeShardedAtomicCounterConstPointerBase = mse::us::impl::TPointerForLegacy<const TXScopeShardedAtomicCounterBase<_Ty>, mse::impl::TScopeAtomicID<const TXScopeShardedAtomicCounterBase<_Ty> > >;
+#endif // MSE_SCOPEPOINTER_RUNTIME_CHECKS_ENABLED
+		}
+	}
+
+	/* A TXScopeShardedAtomicCounterFixedPointer points to a TXScopeShardedAtomicCounter. Like TXScopeAtomicFixedPointer, it
+	can be passed to (scope) threads. */
+	template<typename _Ty>
+	class TXScopeShardedAtomicCounterFixedPointer : public mse::us::impl::TXScopeShardedAtomicCounterPointerBase<_Ty>, public mse::us::impl::XScopeContainsNonOwningScopeReferenceTagBase
+		, public MSE_FIRST_OR_PLACEHOLDER_IF_A_BASE_OF_SECOND(mse::us::impl::StrongPointerTagBase, mse::us::impl::TXScopeShardedAtomicCounterPointerBase<_Ty>, TXScopeShardedAtomicCounterFixedPointer<_Ty>)
+	{
+	public:
+		typedef mse::us::impl::TXScopeShardedAtomicCounterPointerBase<_Ty> base_class;
+		TXScopeShardedAtomicCounterFixedPointer(const TXScopeShardedAtomicCounterFixedPointer& src_cref) = default;
+		~TXScopeShardedAtomicCounterFixedPointer() {}
+
+		TXScopeShardedAtomicCounter<_Ty>& operator*() const {
+			return static_cast<TXScopeShardedAtomicCounter<_Ty>&>(*(static_cast<const base_class&>(*this)));
+		}
+		TXScopeShardedAtomicCounter<_Ty>* operator->() const {
+			return std::addressof(*(*this));
+		}
+		operator bool() const { return true; }
+		void xscope_tag() const {}
+		void xscope_async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
+
+	private:
+		TXScopeShardedAtomicCounterFixedPointer(TXScopeShardedAtomicCounter<_Ty>& scpobj_ref)
+			: base_class(&(static_cast<mse::us::impl::TXScopeShardedAtomicCounterBase<_Ty>&>(scpobj_ref))) {}
+		TXScopeShardedAtomicCounterFixedPointer<_Ty>& operator=(const TXScopeShardedAtomicCounterFixedPointer<_Ty>& _Right_cref) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		friend class TXScopeShardedAtomicCounter<_Ty>;
+	};
+
+	template<typename _Ty>
+	class TXScopeShardedAtomicCounterFixedConstPointer : public mse::us::impl::TXScopeShardedAtomicCounterConstPointerBase<_Ty>, public mse::us::impl::XScopeContainsNonOwningScopeReferenceTagBase
+		, public MSE_FIRST_OR_PLACEHOLDER_IF_A_BASE_OF_SECOND(mse::us::impl::StrongPointerTagBase, mse::us::impl::TXScopeShardedAtomicCounterConstPointerBase<_Ty>, TXScopeShardedAtomicCounterFixedConstPointer<_Ty>)
+	{
+	public:
+		typedef mse::us::impl::TXScopeShardedAtomicCounterConstPointerBase<_Ty> base_class;
+		TXScopeShardedAtomicCounterFixedConstPointer(const TXScopeShardedAtomicCounterFixedConstPointer& src_cref) = default;
+		TXScopeShardedAtomicCounterFixedConstPointer(const TXScopeShardedAtomicCounterFixedPointer<_Ty>& src_cref)
+			: base_class(static_cast<const mse::us::impl::TXScopeShardedAtomicCounterPointerBase<_Ty>&>(src_cref)) {}
+		~TXScopeShardedAtomicCounterFixedConstPointer() {}
+
+		const TXScopeShardedAtomicCounter<_Ty>& operator*() const {
+			return static_cast<const TXScopeShardedAtomicCounter<_Ty>&>(*(static_cast<const base_class&>(*this)));
+		}
+		const TXScopeShardedAtomicCounter<_Ty>* operator->() const {
+			return std::addressof(*(*this));
+		}
+		operator bool() const { return true; }
+		void xscope_tag() const {}
+		void xscope_async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
+
+	private:
+		TXScopeShardedAtomicCounterFixedConstPointer(const TXScopeShardedAtomicCounter<_Ty>& scpobj_cref)
+			: base_class(&(static_cast<const mse::us::impl::TXScopeShardedAtomicCounterBase<_Ty>&>(scpobj_cref))) {}
+		TXScopeShardedAtomicCounterFixedConstPointer<_Ty>& operator=(const TXScopeShardedAtomicCounterFixedConstPointer<_Ty>& _Right_cref) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		friend class TXScopeShardedAtomicCounter<_Ty>;
+	};
+
+	/* TXScopeShardedAtomicCounter<> is an (integral) counter intended to be modified concurrently by multiple (scope)
+	threads, such as a statistics counter. Each thread adds to its own cache line sized "stripe" of the counter, so
+	modification doesn't incur contention between threads. Reading the value (via load()) sums the stripes, so it is
+	relatively expensive. The counter's "&" (address of) operator returns a TXScopeShardedAtomicCounterFixedPointer<>,
+	which can be passed to scope threads. */
+	template<typename _Ty>
+	class TXScopeShardedAtomicCounter : public mse::us::impl::TXScopeShardedAtomicCounterBase<_Ty>, public mse::us::impl::XScopeTagBase {
+	public:
+		typedef mse::us::impl::TXScopeShardedAtomicCounterBase<_Ty> base_class;
+		MSE_SCOPE_ATOMIC_USING(TXScopeShardedAtomicCounter, base_class);
+		~TXScopeShardedAtomicCounter() {
+			mse::impl::T_valid_if_is_marked_as_xscope_shareable_msemsearray<_Ty>();
+		}
+
+		const TXScopeShardedAtomicCounterFixedPointer<_Ty> operator&() & {
+			return *this;
+		}
+		const TXScopeShardedAtomicCounterFixedConstPointer<_Ty> operator&() const & {
+			return *this;
+		}
+		void operator&() && = delete;
+		void operator&() const && = delete;
+
+		void xscope_tag() const {}
+
+	private:
+		TXScopeShardedAtomicCounter(const TXScopeShardedAtomicCounter&) = delete;
+		TXScopeShardedAtomicCounter& operator=(const TXScopeShardedAtomicCounter&) = delete;
+
+		void* operator new(size_t size) { return ::operator new(size); }
+	};
+
+#endif /*MSE_SCOPEPOINTER_DISABLED*/
+
 	namespace us {
 		/* (Unsafely) obtain a scope pointer to any object. */
 		template<typename _Ty>
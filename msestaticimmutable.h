@@ -28,6 +28,8 @@
 #include "msenorad.h"
 #endif // !MSE_CHECKED_THREAD_SAFE_DO_NOT_USE_GNORAD
 #include <atomic>
+#include <mutex>
+#include <new>
 
 #ifdef _MSC_VER
 #pragma warning( push )  
@@ -81,12 +83,71 @@ namespace mse {
 				};
 				typedef CNoOpCopyAtomicInt atomic_int_t;
 
+				/* Threads are assigned (sequential) indexes in order of first use. Used to distribute threads among
+				per-thread "slots" in round-robin fashion. */
+				inline size_t this_thread_round_robin_index() {
+					static std::atomic<size_t> s_next_index{ 0 };
+					thread_local const size_t tl_index = s_next_index.fetch_add(1, std::memory_order_relaxed);
+					return tl_index;
+				}
+
+				/* CShardedAtomicInt is a reference counter split into a number of slots, each residing in its own cache
+				line. Each thread adds to and subtracts from "its" slot (assigned in round-robin fashion), so threads
+				concurrently copying and destroying pointers to the same object don't (generally) contend for the same
+				cache line. The value of the counter is the sum of the slots. (A reference obtained in one thread and
+				released in another may leave individual slots negative, but the sum remains correct.) Reading the value
+				is relatively expensive, but it's only done when the target object is destroyed. */
+				class CShardedAtomicInt {
+				public:
+					CShardedAtomicInt(int i) { m_slots[0].m_count.store(i, std::memory_order_relaxed); }
+					CShardedAtomicInt(const CShardedAtomicInt&) : CShardedAtomicInt(0) {}
+
+					CShardedAtomicInt& operator+=(int i) {
+						m_slots[this_thread_slot_index()].m_count.fetch_add(i, std::memory_order_relaxed);
+						return *this;
+					}
+					CShardedAtomicInt& operator-=(int i) {
+						m_slots[this_thread_slot_index()].m_count.fetch_sub(i, std::memory_order_relaxed);
+						return *this;
+					}
+					operator int() const {
+						int sum = 0;
+						for (const auto& slot : m_slots) {
+							sum += slot.m_count.load();
+						}
+						return sum;
+					}
+
+				private:
+					CShardedAtomicInt& operator=(const CShardedAtomicInt&) = delete;
+
+					static const size_t sc_slot_count = 16;
+
+					/* The padding ensures that (regardless of the alignment of the array) no two slots share a cache line. */
+					struct slot_t {
+						std::atomic<int> m_count{ 0 };
+						char m_padding[mse::impl::sc_cache_line_size - sizeof(std::atomic<int>)];
+					};
+
+					static size_t this_thread_slot_index() {
+						return this_thread_round_robin_index() % sc_slot_count;
+					}
+
+					slot_t m_slots[sc_slot_count];
+				};
+				typedef CShardedAtomicInt sharded_atomic_int_t;
+
 #ifndef MSE_CHECKED_THREAD_SAFE_DO_NOT_USE_GNORAD
 				template<typename _Ty> using TCheckedThreadSafeObj = mse::us::impl::TGNoradObj<_Ty, atomic_int_t>;
 				template<typename _Ty> using TCheckedThreadSafePointer = mse::us::impl::TGNoradPointer<_Ty, atomic_int_t>;
 				template<typename _Ty> using TCheckedThreadSafeConstPointer = mse::us::impl::TGNoradConstPointer<_Ty, atomic_int_t>;
 				template<typename _Ty> using TCheckedThreadSafeFixedPointer = mse::us::impl::TGNoradFixedPointer<_Ty, atomic_int_t>;
 				template<typename _Ty> using TCheckedThreadSafeFixedConstPointer = mse::us::impl::TGNoradFixedConstPointer<_Ty, atomic_int_t>;
+
+				/* Versions that use a sharded reference counter. Better suited to objects whose pointers are copied
+				concurrently from many threads (such as static immutables). */
+				template<typename _Ty> using TShardedCheckedThreadSafeObj = mse::us::impl::TGNoradObj<_Ty, sharded_atomic_int_t>;
+				template<typename _Ty> using TShardedCheckedThreadSafeConstPointer = mse::us::impl::TGNoradConstPointer<_Ty, sharded_atomic_int_t>;
 #else // !MSE_CHECKED_THREAD_SAFE_DO_NOT_USE_GNORAD
 				/* TCheckedThreadSafePointer<> is essentially just a simplified TNoradPointer<> with an atomic refcounter. */
 				template<typename _Ty> class TCheckedThreadSafeObj;
@@ -313,13 +374,25 @@ namespace mse {
 #endif // MSE_STATICIMMUTABLEPOINTER_RUNTIME_CHECKS_ENABLED
 				>::type;
 
+				/* Static immutable objects are potentially accessed from many threads at once, so by default (when
+				available), their reference counts are "sharded" to avoid contention between threads copying pointers to
+				the same object. Defining MSE_STATICIMMUTABLE_NO_SHARDED_REFCOUNT reverts to a single (smaller) atomic
+				counter. */
+#if !defined(MSE_CHECKED_THREAD_SAFE_DO_NOT_USE_GNORAD) && !defined(MSE_STATICIMMUTABLE_NO_SHARDED_REFCOUNT)
+				template<typename _Ty> using TCheckedObj = mse::rsv::impl::cts::TShardedCheckedThreadSafeObj<_Ty>;
+				template<typename _Ty> using TCheckedConstPointer = mse::rsv::impl::cts::TShardedCheckedThreadSafeConstPointer<_Ty>;
+#else // !defined(MSE_CHECKED_THREAD_SAFE_DO_NOT_USE_GNORAD) && !defined(MSE_STATICIMMUTABLE_NO_SHARDED_REFCOUNT)
+				template<typename _Ty> using TCheckedObj = mse::rsv::impl::cts::TCheckedThreadSafeObj<_Ty>;
+				template<typename _Ty> using TCheckedConstPointer = mse::rsv::impl::cts::TCheckedThreadSafeConstPointer<_Ty>;
+#endif // !defined(MSE_CHECKED_THREAD_SAFE_DO_NOT_USE_GNORAD) && !defined(MSE_STATICIMMUTABLE_NO_SHARDED_REFCOUNT)
+
 				template<typename _TROz>
 				using TStaticImmutableObjBaseBase = typename std::conditional<use_unchecked_base_type<_TROz>::value
-					, typename std::remove_const<_TROz>::type, mse::rsv::impl::cts::TCheckedThreadSafeObj<const _TROz>>::type;
+					, typename std::remove_const<_TROz>::type, TCheckedObj<const _TROz>>::type;
 
 				template<typename _Ty>
 				using TStaticImmutableConstPointerBaseBase = typename std::conditional<use_unchecked_base_type<_Ty>::value
-					, mse::us::impl::TPointerForLegacy<const _Ty, TStaticImmutableID<const _Ty>>, mse::rsv::impl::cts::TCheckedThreadSafeConstPointer<const _Ty>>::type;
+					, mse::us::impl::TPointerForLegacy<const _Ty, TStaticImmutableID<const _Ty>>, TCheckedConstPointer<const _Ty>>::type;
 
 				template<typename _TROz>
 				class TStaticImmutableObjBase : public TStaticImmutableObjBaseBase<_TROz> {
@@ -679,11 +752,74 @@ namespace mse {
 
 		/* end of template specializations */
 
+#endif /*MSE_STATICPOINTER_DISABLED*/
+
+		/* TLazyStaticImmutableObj<> is a version of TStaticImmutableObj<> whose (contained) object is not constructed
+		during static initialization, but rather on first access, from the value returned by the given initialization
+		function. Once the object has been initialized, each access costs just one (acquire) atomic load. Pointers to the
+		object are of the same type as pointers to a TStaticImmutableObj<>. Objects of this type should be declared via
+		the MSE_DECLARE_LAZY_STATIC_IMMUTABLE() or MSE_RSV_DECLARE_LAZY_GLOBAL_IMMUTABLE() macros. Note that the
+		initialization function must not (directly or indirectly) access the object being initialized. */
+		template<typename _TROy>
+		class TLazyStaticImmutableObj {
+		public:
+			typedef TStaticImmutableObj<_TROy> object_type;
+			typedef _TROy(*init_function_t)();
+
+			constexpr TLazyStaticImmutableObj(init_function_t init_function) : m_init_function(init_function) {}
+			MSE_IMPL_DESTRUCTOR_PREFIX1 ~TLazyStaticImmutableObj() {
+				if (m_is_initialized.load(std::memory_order_acquire)) {
+					object_ptr()->~object_type();
+				}
+			}
+
+			auto operator&() const & { return static_fptr_to(initialized_object()); }
+			auto mse_static_fptr() const & { return static_fptr_to(initialized_object()); }
+
+			void operator&() const && = delete;
+			void mse_static_fptr() const && = delete;
+
+			/* Returns whether the object has (already) been initialized. */
+			bool is_initialized() const { return m_is_initialized.load(std::memory_order_acquire); }
+
+			void static_tag() const {}
+
+		private:
+			TLazyStaticImmutableObj(const TLazyStaticImmutableObj&) = delete;
+			TLazyStaticImmutableObj& operator=(const TLazyStaticImmutableObj&) = delete;
+
+			const object_type& initialized_object() const {
+				if (!m_is_initialized.load(std::memory_order_acquire)) {
+					/* If the initialization function throws, the object remains uninitialized, and the next access will
+					try again. */
+					std::call_once(m_once_flag, [this]() {
+						::new (static_cast<void*>(m_storage)) object_type(m_init_function());
+						m_is_initialized.store(true, std::memory_order_release);
+					});
+				}
+				return *object_ptr();
+			}
+			const object_type* object_ptr() const {
+				return reinterpret_cast<const object_type*>(m_storage);
+			}
+
+			init_function_t m_init_function;
+			mutable std::atomic<bool> m_is_initialized{ false };
+			mutable std::once_flag m_once_flag;
+			alignas(object_type) mutable unsigned char m_storage[sizeof(object_type)] = {};
+
+			MSE_DEFAULT_OPERATOR_NEW_DECLARATION;
+		};
+
+#ifdef MSE_STATICPOINTER_DISABLED
+		template<typename _Ty> auto static_fptr_to(const TLazyStaticImmutableObj<_Ty>& _X) { return _X.mse_static_fptr(); }
 #endif /*MSE_STATICPOINTER_DISABLED*/
 	}
 
 #define MSE_DECLARE_STATIC_IMMUTABLE(type) static const mse::rsv::TStaticImmutableObj<type> 
 #define MSE_RSV_DECLARE_GLOBAL_IMMUTABLE(type) const mse::rsv::TStaticImmutableObj<type> 
+#define MSE_DECLARE_LAZY_STATIC_IMMUTABLE(type) static const mse::rsv::TLazyStaticImmutableObj<type> 
+#define MSE_RSV_DECLARE_LAZY_GLOBAL_IMMUTABLE(type) const mse::rsv::TLazyStaticImmutableObj<type> 
 
 
 #ifndef MSE_STATICPOINTER_DISABLED
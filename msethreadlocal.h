@@ -12,11 +12,15 @@
 #include "mseprimitives.h"
 #ifndef MSE_THREADLOCAL_NO_XSCOPE_DEPENDENCE
 #include "msescope.h"
+#include "mserefcounting.h"
 #endif // !MSE_THREADLOCAL_NO_XSCOPE_DEPENDENCE
 #include <utility>
 #include <unordered_set>
+#include <unordered_map>
+#include <list>
 #include <functional>
 #include <cassert>
+#include <stdexcept>
 
 /* moved to msepointerbasics.h */
 //#if defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)
@@ -50,12 +54,19 @@
 
 #ifndef MSE_PUSH_MACRO_NOT_SUPPORTED
 #pragma push_macro("_NOEXCEPT")
+#pragma push_macro("MSE_THROW")
 #endif // !MSE_PUSH_MACRO_NOT_SUPPORTED
 
 #ifndef _NOEXCEPT
 #define _NOEXCEPT
 #endif /*_NOEXCEPT*/
 
+#ifdef MSE_CUSTOM_THROW_DEFINITION
+#define MSE_THROW(x) MSE_CUSTOM_THROW_DEFINITION(x)
+#else // MSE_CUSTOM_THROW_DEFINITION
+#define MSE_THROW(x) throw(x)
+#endif // MSE_CUSTOM_THROW_DEFINITION
+
 
 namespace mse {
 	namespace rsv {
@@ -318,6 +329,7 @@ namespace mse {
 
 		private:
 			//TThreadLocalNotNullPointer(typename base_class::scope_obj_base_ptr_t src_cref) : base_class(src_cref) {}
+			TThreadLocalNotNullPointer(const TThreadLocalNotNullPointer<_Ty>& src_cref) : base_class(src_cref) {}
 			TThreadLocalNotNullPointer(const typename base_class::base_class& ptr) : base_class(ptr) {}
 			TThreadLocalNotNullPointer(TThreadLocalObj<_Ty>* ptr) : base_class(ptr) {}
 			template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2*, _Ty*>::value, void>::type>
@@ -676,6 +688,114 @@ namespace mse {
 #define MSE_DECLARE_THREAD_LOCAL_GLOBAL(type) MSE_DECLARE_THREAD_LOCAL(type) 
 #define MSE_DECLARE_THREAD_LOCAL_GLOBAL_CONST(type) MSE_DECLARE_THREAD_LOCAL_CONST(type) 
 
+#ifndef MSE_THREADLOCAL_NO_XSCOPE_DEPENDENCE
+	/* thread_local_cache<> is a bounded key-value cache with least-recently-used eviction. It's intended to be declared
+	thread_local (via MSE_DECLARE_THREAD_LOCAL() or MSE_DECLARE_THREAD_LOCAL_GLOBAL()) to serve as a per-thread cache of
+	values that are expensive to compute. The cached values are immutable and are held via reference counting pointers,
+	so a (reference counting) pointer obtained from the cache remains valid even after the corresponding entry has been
+	evicted or the cache has been destroyed. Like the reference counting pointers, the cache is not eligible to be
+	shared or passed between threads. */
+	template<class _TKey, class _TValue, class _THash = std::hash<_TKey>, class _TKeyEqual = std::equal_to<_TKey> >
+	class thread_local_cache {
+	public:
+		typedef _TKey key_type;
+		typedef _TValue mapped_type;
+		typedef size_t size_type;
+		typedef mse::TRefCountingConstPointer<_TValue> value_cptr_t;
+		typedef mse::TRefCountingFixedConstPointer<_TValue> value_fcptr_t;
+
+		explicit thread_local_cache(size_type capacity) : m_capacity(capacity) {
+			if (1 > capacity) { MSE_THROW(std::invalid_argument("invalid argument, the capacity must be at least one - mse::thread_local_cache")); }
+		}
+
+		/* Returns a pointer to the cached value associated with the given key, or a null pointer if there is none. */
+		value_cptr_t find(const key_type& key) {
+			auto found_it = m_index.find(key);
+			if (m_index.end() == found_it) {
+				return nullptr;
+			}
+			touch(found_it->second);
+			return (*(found_it->second)).m_value_ptr;
+		}
+
+		/* Returns a pointer to the cached value associated with the given key. If there is none, the value is obtained by
+		calling the given function with the key as its argument, and added to the cache (evicting the least recently used
+		entry if the cache is full). The given function is permitted to (recursively) access the cache. */
+		template<class _TFunction>
+		value_fcptr_t get_or_compute(const key_type& key, _TFunction&& compute_function) {
+			auto found_it = m_index.find(key);
+			if (m_index.end() != found_it) {
+				touch(found_it->second);
+				return (*(found_it->second)).m_value_ptr;
+			}
+			return insert_helper(key, mse::make_refcounting<_TValue>(compute_function(key)));
+		}
+
+		value_fcptr_t insert_or_assign(const key_type& key, const mapped_type& value) {
+			return insert_helper(key, mse::make_refcounting<_TValue>(value));
+		}
+		value_fcptr_t insert_or_assign(const key_type& key, mapped_type&& value) {
+			return insert_helper(key, mse::make_refcounting<_TValue>(std::forward<decltype(value)>(value)));
+		}
+
+		/* Returns whether there was an entry associated with the given key. */
+		bool erase(const key_type& key) {
+			auto found_it = m_index.find(key);
+			if (m_index.end() == found_it) {
+				return false;
+			}
+			m_entries.erase(found_it->second);
+			m_index.erase(found_it);
+			return true;
+		}
+		void clear() {
+			m_index.clear();
+			m_entries.clear();
+		}
+
+		size_type size() const { return m_entries.size(); }
+		bool empty() const { return m_entries.empty(); }
+		size_type capacity() const { return m_capacity; }
+
+	private:
+		thread_local_cache(const thread_local_cache&) = delete;
+		thread_local_cache& operator=(const thread_local_cache&) = delete;
+
+		struct entry_t {
+			key_type m_key;
+			mse::TRefCountingNotNullConstPointer<_TValue> m_value_ptr;
+		};
+		/* The entries are ordered from most recently used to least recently used. */
+		typedef std::list<entry_t> entries_t;
+
+		void touch(typename entries_t::iterator entry_it) {
+			m_entries.splice(m_entries.begin(), m_entries, entry_it);
+		}
+		value_fcptr_t insert_helper(const key_type& key, mse::TRefCountingNotNullConstPointer<_TValue>&& value_ptr) {
+			/* The key is looked up again, as the entry may have been added (by a recursive call) while computing the value. */
+			auto found_it = m_index.find(key);
+			if (m_index.end() != found_it) {
+				(*(found_it->second)).m_value_ptr = value_ptr;
+				touch(found_it->second);
+				return value_ptr;
+			}
+			if (m_capacity <= m_entries.size()) {
+				m_index.erase(m_entries.back().m_key);
+				m_entries.pop_back();
+			}
+			m_entries.push_front(entry_t{ key, value_ptr });
+			m_index.emplace(key, m_entries.begin());
+			return value_ptr;
+		}
+
+		size_type m_capacity;
+		entries_t m_entries;
+		std::unordered_map<key_type, typename entries_t::iterator, _THash, _TKeyEqual> m_index;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+	};
+#endif // !MSE_THREADLOCAL_NO_XSCOPE_DEPENDENCE
+
 
 #ifndef MSE_THREADLOCALPOINTER_DISABLED
 #ifndef MSE_THREADLOCAL_NO_XSCOPE_DEPENDENCE
@@ -902,6 +1022,7 @@ namespace mse {
 }
 
 #ifndef MSE_PUSH_MACRO_NOT_SUPPORTED
+#pragma pop_macro("MSE_THROW")
 #pragma pop_macro("_NOEXCEPT")
 #endif // !MSE_PUSH_MACRO_NOT_SUPPORTED
 
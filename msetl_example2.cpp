@@ -100,6 +100,20 @@ public:
 		return (l_xscope_ra_csection1.size() > l_xscope_ra_csection2.size()) ? false : true;
 	}
 
+#ifdef MSE_HAS_CXX20
+	/* As of C++20, nii_array<>s, their (scope) iterators and const sections can be used in constant expressions. */
+	static constexpr int constexpr_sum_of_squares() {
+		mse::nii_array<int, 4> na1{ 1, 2, 3, 4 };
+		auto xscope_citer1 = mse::TXScopeRAConstIterator<const mse::nii_array<int, 4>*>(&na1, 0);
+		auto xscope_ra_csection1 = mse::TXScopeRandomAccessConstSection<decltype(xscope_citer1)>(xscope_citer1, na1.size());
+		int retval = 0;
+		for (const auto& item : xscope_ra_csection1) {
+			retval += item * item;
+		}
+		return retval;
+	}
+#endif // MSE_HAS_CXX20
+
 #ifdef MSE_HAS_CXX17
 	/* While not encouraging their use, this is how you might declare an immutable static member (in C++17 and later). */
 	inline MSE_DECLARE_STATIC_IMMUTABLE(mse::mtnii_string) sm_simm_string = "abc";
@@ -109,6 +123,7 @@ public:
 
 MSE_DECLARE_THREAD_LOCAL_GLOBAL(mse::mstd::string) tlg_string1 = "some text";
 MSE_RSV_DECLARE_GLOBAL_IMMUTABLE(mse::mtnii_string) gimm_string1 = "some text";
+MSE_RSV_DECLARE_LAZY_GLOBAL_IMMUTABLE(mse::mtnii_string) lazy_gimm_string1([]() { return mse::mtnii_string("some lazily initialized text"); });
 
 
 void msetl_example2() {
@@ -1168,10 +1183,206 @@ void msetl_example2() {
 				mse::pointer_to(mse::TXScopeObj<mse::mtnii_string >(mse::mtnii_string{"abcd"}))));
 			auto res3 = CD::second_is_longer_any(xscope_string_csection1, mse::make_xscope_string_const_section(
 				mse::pointer_to(mse::TXScopeObj<mse::mtnii_string >(mse::mtnii_string{"abcd"}))));
+
+			/* The search member functions of string sections that reference contiguous storage (and of nii_string) use
+			vectorized implementations where supported. */
+			mse::TXScopeObj<mse::mtnii_string > log_line1(mse::mtnii_string{"GET /index.html 200; POST /login 403"});
+			auto xscope_log_csection1 = mse::make_xscope_string_const_section(&log_line1);
+			mse::TXScopeObj<mse::mtnii_string > status_prefix1(mse::mtnii_string{"40"});
+			mse::TXScopeObj<mse::mtnii_string > separators1(mse::mtnii_string{";/"});
+			assert(33 == xscope_log_csection1.find(mse::make_xscope_string_const_section(&status_prefix1)));
+			assert(4 == xscope_log_csection1.find_first_of(mse::make_xscope_string_const_section(&separators1)));
+			assert(26 == xscope_log_csection1.find_last_of(mse::make_xscope_string_const_section(&separators1)));
+			assert(21 == log_line1.rfind('P'));
+
+			/* Strings and string sections (that reference contiguous storage) with the same contents have the same hash
+			value, so string sections can be used to look up (or deduplicate) strings in hash tables. */
+			auto xscope_path_csection1 = mse::make_xscope_subsection(xscope_log_csection1, 4, 11);
+			mse::TXScopeObj<mse::mtnii_string > path1(mse::mtnii_string{"/index.html"});
+			assert(std::hash<decltype(xscope_path_csection1)>()(xscope_path_csection1) == std::hash<mse::mtnii_string>()(path1));
 		}
 #endif // !EXCLUDE_DUE_TO_MSVC2019_INTELLISENSE_BUGS1
 	}
 
+	{
+		/*************************************/
+		/*  TXScopeStringSectionTokenizer<>  */
+		/*************************************/
+
+		/* String section tokenizers lazily split a string section into tokens that are themselves (sub)sections of the
+		original section. No string contents are copied and no memory is allocated. */
+
+		mse::TXScopeObj<mse::mtnii_string > csv_row1(mse::mtnii_string{"alpha,beta,,gamma delta"});
+		auto xscope_row_csection1 = mse::make_xscope_string_const_section(&csv_row1);
+
+		size_t field_count = 0;
+		for (const auto& field_csection : mse::make_xscope_string_tokenizer(xscope_row_csection1, ',')) {
+			if (2 == field_count) {
+				/* Adjacent delimiters produce an empty token. */
+				assert(0 == field_csection.size());
+			}
+			field_count += 1;
+		}
+		assert(4 == field_count);
+
+		/* Tokenizing by a set of delimiter characters. */
+		auto tokenizer2 = mse::make_xscope_string_tokenizer_any_of(xscope_row_csection1, mse::make_xscope_string_const_section(", "));
+		auto token_iter2 = tokenizer2.begin();
+		++token_iter2;
+		assert((*token_iter2) == "beta");
+
+		/* Tokenizing by a predicate. */
+		size_t word_count = 0;
+		for (const auto& word_csection : mse::make_xscope_string_tokenizer_if(xscope_row_csection1, [](char ch) { return !std::isalpha(static_cast<unsigned char>(ch)); })) {
+			if (1 <= word_csection.size()) {
+				word_count += 1;
+			}
+		}
+		assert(4 == word_count);
+	}
+
+	{
+		/****************************************/
+		/*  mse::from_chars(), mse::to_chars()  */
+		/****************************************/
+
+		/* from_chars() and to_chars() parse and format numbers directly from/to string sections, without allocating
+		(std::string) temporaries. Errors are reported (rather than thrown) via the ec member of the returned result. */
+
+		mse::TXScopeObj<mse::mtnii_string > record1(mse::mtnii_string{"42,-7,ff,3.5,99999999999999999999"});
+		auto xscope_record_csection1 = mse::make_xscope_string_const_section(&record1);
+
+		mse::CInt field_values[3] = { 0, 0, 0 };
+		int bases[3] = { 10, 10, 16 };
+		size_t field_index = 0;
+		for (const auto& field_csection : mse::make_xscope_string_tokenizer(xscope_record_csection1, ',')) {
+			if (3 <= field_index) {
+				break;
+			}
+			auto res = mse::from_chars(field_csection, field_values[field_index], bases[field_index]);
+			assert((std::errc() == res.ec) && (field_csection.size() == res.count));
+			field_index += 1;
+		}
+		assert((42 == field_values[0]) && (-7 == field_values[1]) && (255 == field_values[2]));
+
+		double dbl1 = 0.0;
+		auto res2 = mse::from_chars(mse::make_xscope_subsection(xscope_record_csection1, 9, 3), dbl1);
+		assert((std::errc() == res2.ec) && (3.5 == dbl1));
+
+		/* Out of range values are reported rather than silently truncated. */
+		mse::CSize_t csize1 = 0;
+		auto res3 = mse::from_chars(mse::make_xscope_subsection(xscope_record_csection1, 13, 20), csize1);
+		assert(std::errc::result_out_of_range == res3.ec);
+		/* And a leading '-' is not accepted for unsigned types. */
+		auto res4 = mse::from_chars(mse::make_xscope_subsection(xscope_record_csection1, 3, 2), csize1);
+		assert(std::errc::invalid_argument == res4.ec);
+
+		/* parse_number<>() is a convenience function that requires the whole section to be a valid representation
+		and throws (like std::stoi()) on failure. */
+		auto int1 = mse::parse_number<int>(mse::make_xscope_subsection(xscope_record_csection1, 0, 2));
+		assert(42 == int1);
+		bool threw_flag = false;
+		try {
+			/* The section "42," is not (entirely) a valid integer representation. */
+			mse::parse_number<int>(mse::make_xscope_subsection(xscope_record_csection1, 0, 3));
+		}
+		catch (const std::invalid_argument&) {
+			threw_flag = true;
+		}
+		assert(threw_flag);
+
+		mse::TXScopeObj<mse::mtnii_string > buffer1(mse::mtnii_string(16, ' '));
+		auto xscope_buffer_section1 = mse::make_xscope_string_section(&buffer1);
+		auto res5 = mse::to_chars(xscope_buffer_section1, -1234);
+		assert((std::errc() == res5.ec) && (mse::make_xscope_subsection(xscope_buffer_section1, 0, res5.count) == "-1234"));
+		auto res6 = mse::to_chars(mse::make_xscope_subsection(xscope_buffer_section1, 0, 3), 1234);
+		assert(std::errc::value_too_large == res6.ec);
+	}
+
+	{
+		/****************************/
+		/*  TXScopeStringBuilder<>  */
+		/****************************/
+
+		/* String builders accumulate (references to) string sections, characters and numbers, and materialize the
+		concatenated result with a single allocation. */
+
+		mse::TXScopeObj<mse::mtnii_string > name1(mse::mtnii_string{"temperature"});
+		auto xscope_name_csection1 = mse::make_xscope_string_const_section(&name1);
+
+		mse::TXScopeStringBuilder<> builder1;
+		builder1.append('{').append('"').append(xscope_name_csection1).append(mse::make_xscope_string_const_section("\": "));
+		builder1.append_number(21).append('}');
+		assert(19 == builder1.size());
+
+		/* The pieces that make up the result can be accessed as string sections without materializing the result. */
+		size_t total_size = 0;
+		builder1.for_each_section([&total_size](const auto& piece_csection) { total_size += piece_csection.size(); });
+		assert(builder1.size() == total_size);
+
+		mse::TXScopeObj<mse::nii_string> str1(builder1.str());
+		assert(mse::make_xscope_string_const_section(&str1) == "{\"temperature\": 21}");
+	}
+
+	{
+		/*************************/
+		/*  TStringInternPool<>  */
+		/*************************/
+
+		/* String intern pools map string contents to compact handles that can be compared (and hashed) in constant
+		time. */
+
+		mse::TStringInternPool<> tag_pool1;
+
+		mse::TXScopeObj<mse::mtnii_string > log_tags1(mse::mtnii_string{"net,disk,net,cpu,disk"});
+		std::vector<mse::TInternedStringHandle<> > tag_handles1;
+		for (const auto& tag_csection : mse::make_xscope_string_tokenizer(mse::make_xscope_string_const_section(&log_tags1), ',')) {
+			tag_handles1.push_back(tag_pool1.intern(tag_csection));
+		}
+		assert(3 == tag_pool1.size());
+		assert(tag_handles1[0] == tag_handles1[2]);
+		assert(tag_handles1[0] != tag_handles1[1]);
+
+		auto net_handle1 = tag_pool1.find(mse::make_xscope_string_const_section("net"));
+		assert(net_handle1 == tag_handles1[0]);
+		assert(!tag_pool1.find(mse::make_xscope_string_const_section("gpu")).is_valid());
+
+		/* The (safe) string sections referencing the interned strings remain valid for (at least) the lifetime of the
+		pool. */
+		auto cpu_csection1 = tag_pool1.section(tag_handles1[3]);
+		assert(cpu_csection1 == "cpu");
+	}
+
+	{
+		/*****************************************************/
+		/*  UTF-8 validation and TXScopeUTF8CodePointSection  */
+		/*****************************************************/
+
+		/* "caf\xC3\xA9" is the UTF-8 encoding of "café". */
+		mse::TXScopeObj<mse::mtnii_string > utf8_text1(mse::mtnii_string{"caf\xC3\xA9 \xE2\x82\xAC" "5"});
+		auto xscope_utf8_csection1 = mse::make_xscope_string_const_section(&utf8_text1);
+		assert(mse::is_valid_utf8(xscope_utf8_csection1));
+
+		/* Code point sections present string sections as sequences of (char32_t) code points. */
+		size_t code_point_count = 0;
+		for (const auto code_point : mse::make_xscope_utf8_code_point_section(xscope_utf8_csection1)) {
+			if (3 == code_point_count) {
+				assert(char32_t(0xE9) == code_point);
+			}
+			else if (5 == code_point_count) {
+				/* the euro sign */
+				assert(char32_t(0x20AC) == code_point);
+			}
+			code_point_count += 1;
+		}
+		assert(7 == code_point_count);
+
+		/* "\xC3" is not followed by a continuation byte. */
+		mse::TXScopeObj<mse::mtnii_string > invalid_utf8_text1(mse::mtnii_string{"ab\xC3z"});
+		auto xscope_invalid_utf8_csection1 = mse::make_xscope_string_const_section(&invalid_utf8_text1);
+		assert(2 == mse::find_invalid_utf8(xscope_invalid_utf8_csection1));
+	}
+
 	{
 		/*************************/
 		/*  TAnyStringSection<>  */
@@ -1434,6 +1645,20 @@ void msetl_example2() {
 		}
 	}
 
+#ifdef MSE_HAS_CXX20
+	{
+		/* constexpr nii_array<> */
+
+		/* Lookup tables can be initialized at compile time rather than during static initialization. */
+		static constexpr mse::nii_array<int, 4> lookup_table1{ 2, 3, 5, 7 };
+		static_assert(5 == lookup_table1[2], "");
+		/* Out of bounds accesses evaluated at compile time result in compile errors. */
+		//static_assert(0 == lookup_table1[4], "");
+
+		static_assert(30 == J::constexpr_sum_of_squares(), "");
+	}
+#endif // MSE_HAS_CXX20
+
 	{
 		/*****************************************/
 		/*  MSE_DECLARE_THREAD_LOCAL()           */
@@ -1466,6 +1691,27 @@ void msetl_example2() {
 		*xs_cptr3 += "def";
 		std::cout << *xs_cptr3 << std::endl;
 
+		/* thread_local_cache<> is a bounded (least-recently-used) cache intended to be declared thread_local. The cached
+		values are held by (non-thread-safe) reference counting pointers, so pointers obtained from the cache remain
+		valid even after their entries are evicted. */
+		typedef mse::thread_local_cache<int, mse::mstd::string> string_cache_t;
+		MSE_DECLARE_THREAD_LOCAL(string_cache_t) tl_string_cache(2/*capacity*/);
+		auto make_string = [](int n) { return mse::mstd::string(size_t(n), '*'); };
+		/* The cache can be accessed via a (thread local) pointer to it. */
+		auto cached_string = [&make_string](const mse::rsv::TThreadLocalFixedPointer<string_cache_t>& cache_ptr, int n) {
+			return cache_ptr->get_or_compute(n, make_string);
+		};
+		auto cached_str_ptr1 = cached_string(&tl_string_cache, 3);
+		/* This time the value is retrieved from the cache rather than computed. */
+		auto cached_str_ptr2 = cached_string(&tl_string_cache, 3);
+		assert(std::addressof(*cached_str_ptr1) == std::addressof(*cached_str_ptr2));
+		cached_string(&tl_string_cache, 4);
+		/* The capacity has been reached, so this will evict the least recently used entry (the one for 3). */
+		cached_string(&tl_string_cache, 5);
+		assert(!(tl_string_cache.find(3)));
+		/* But the pointer we obtained earlier remains valid. */
+		std::cout << *cached_str_ptr1 << std::endl;
+
 		mse::self_test::CThreadLocalPtrTest1::s_test1();
 	}
 
@@ -1499,6 +1745,13 @@ void msetl_example2() {
 		auto xs_cptr3 = xs_simm_store3.xscope_ptr();
 		std::cout << *xs_cptr3 << std::endl;
 
+		/* A "lazy" static immutable isn't constructed during static initialization, but rather upon first access. Pointers
+		to it are of the same type as pointers to an ordinary static immutable. */
+		auto lazy_gimm_ptr1 = &lazy_gimm_string1;
+		auto xs_lazy_gimm_store1 = mse::make_xscope_strong_pointer_store(lazy_gimm_ptr1);
+		auto xs_ptr4 = xs_lazy_gimm_store1.xscope_ptr();
+		std::cout << *xs_ptr4 << std::endl;
+
 		mse::self_test::CStaticImmutablePtrTest1::s_test1();
 	}
 
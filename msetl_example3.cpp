@@ -93,6 +93,58 @@ public:
 			std::this_thread::sleep_for(std::chrono::milliseconds(delay_in_milliseconds));
 		}
 	}
+	/* These functions are used with channels. */
+	static void send_numbers(mse::TAsyncChannelSender<int> sender, int count) {
+		for (int i = 1; i <= count; i += 1) {
+			/* send() blocks while the channel is full. */
+			sender.send(i);
+		}
+	}
+	static void send_text(mse::TAsyncSPSCChannelSender<mse::mstd::string> sender) {
+		sender.send("some text");
+	}
+#ifdef MSE_HAS_COROUTINES
+	/* These coroutines are used with coroutine_scheduler. */
+	template<class _TAccessRequester>
+	static mse::TAsyncTask<void> increment_coroutine(_TAccessRequester ar, int count) {
+		for (int i = 0; i < count; i += 1) {
+			/* If the lock is unavailable, the coroutine is suspended (rather than blocking the thread). */
+			auto writelock_ptr = co_await mse::co_writelock_ptr(ar);
+			writelock_ptr->b += 1;
+		}
+	}
+	static mse::TAsyncTask<int> sum_coroutine(int a, int b) {
+		/* Lets the scheduler run other tasks before resuming this one. */
+		co_await mse::co_reschedule();
+		co_return a + b;
+	}
+	static mse::TAsyncTask<int> sum_of_sums_coroutine(int a, int b, int c) {
+		int a_plus_b = co_await sum_coroutine(a, b);
+		co_return co_await sum_coroutine(a_plus_b, c);
+	}
+#endif /*MSE_HAS_COROUTINES*/
+	/* These functions are used with xscope_parallel_for() and xscope_parallel_reduce(). */
+	template<class _TStringRASection>
+	static void append_exclamation_mark(_TStringRASection ra_section) {
+		for (size_t i = 0; i < ra_section.size(); i += 1) {
+			ra_section[i] += "!";
+		}
+	}
+	template<class _TStringRASection>
+	static size_t total_string_length(_TStringRASection ra_section) {
+		size_t retval = 0;
+		for (size_t i = 0; i < ra_section.size(); i += 1) {
+			retval += ra_section[i].size();
+		}
+		return retval;
+	}
+	static size_t sum_of_sizes(size_t a, size_t b) {
+		return a + b;
+	}
+	/* This function is used as a continuation of a future. */
+	static int doubled(int x) {
+		return 2 * x;
+	}
 	/* This function just obtains a writelock_ra_section from the given "splitter access requester" and calls the given
 	function with the writelock_ra_section as the first argument. */
 	template<class TAsyncSplitterRASectionReadWriteAccessRequester, class TFunction, class... Args>
@@ -211,6 +263,12 @@ void msetl_example3() {
 				std::this_thread::sleep_for(std::chrono::milliseconds(10));
 				return (*xs_D_atomic_ptr).load().b;
 			}
+			static void foo5(mse::TXScopeShardedAtomicCounterFixedPointer<long long> xs_counter_ptr, mse::TXScopeAtomicFixedPointer<long long> xs_atomic_ptr) {
+				for (int i = 0; i < 1000; i += 1) {
+					++(*xs_counter_ptr);
+					(*xs_atomic_ptr) += 1;
+				}
+			}
 		protected:
 			~B() {}
 		};
@@ -263,6 +321,73 @@ void msetl_example3() {
 			}
 			std::cout << std::endl;
 		}
+		{
+			/* mstd::async() generally creates a new thread for each call. When there are many (small) tasks, a thread_pool,
+			which executes tasks using a fixed set of threads, can be significantly cheaper. Like mstd::async(), its async()
+			member function ensures that the arguments and return value are safely passable. */
+			mse::thread_pool pool1(2);
+			auto ash_access_requester = mse::make_asyncsharedv2readwrite<ShareableA>(7);
+
+			std::list<mse::mstd::future<int>> futures;
+			for (size_t i = 0; i < 100; i += 1) {
+				futures.emplace_back(pool1.async([](mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableA> ar, int increment) {
+					auto writelock_ptr = ar.writelock_ptr();
+					writelock_ptr->b += increment;
+					return writelock_ptr->b;
+				}, ash_access_requester, 1));
+			}
+			for (auto& future : futures) {
+				future.get();
+			}
+			assert(107 == ash_access_requester.readlock_ptr()->b);
+			/* The thread_pool's destructor waits for any remaining tasks to complete. */
+		}
+		{
+			/* A channel is a bounded (lock-free) queue for passing values between threads. make_async_channel() returns a
+			(sender, receiver) pair of handles, which can be copied and passed to other threads. Only values of types that
+			are safely passable to another thread can be sent. */
+			auto channel1 = mse::make_async_channel<int>(16/*capacity*/);
+
+			mse::mstd::thread producer_thread(K::send_numbers, channel1.first, 100);
+
+			int sum = 0;
+			for (int i = 1; i <= 100; i += 1) {
+				/* receive() blocks while the channel is empty. */
+				sum += channel1.second.receive();
+			}
+			producer_thread.join();
+			assert(5050 == sum);
+
+			/* There are also "try" and timed versions of send() and receive(). */
+			auto maybe_value = channel1.second.try_receive_for(std::chrono::milliseconds(10));
+			assert(!maybe_value.has_value());
+
+			/* make_async_spsc_channel() returns a (somewhat more efficient) single-producer/single-consumer channel,
+			whose sender and receiver are movable, but not copyable. */
+			auto spsc_channel1 = mse::make_async_spsc_channel<mse::mstd::string>(4/*capacity*/);
+			mse::mstd::thread spsc_producer_thread(K::send_text, std::move(spsc_channel1.first));
+			auto str1 = spsc_channel1.second.receive();
+			spsc_producer_thread.join();
+		}
+#ifdef MSE_HAS_COROUTINES
+		{
+			/* The parameters (and return value) of coroutines returning a TAsyncTask<> are required to be of a safely
+			passable type, as are the arguments of mstd::thread. A coroutine_scheduler runs tasks in the calling thread. */
+			mse::coroutine_scheduler scheduler1;
+			auto ash_access_requester = mse::make_asyncsharedv2readwrite<ShareableA>(7);
+
+			/* The scheduler takes ownership of spawned tasks. run() runs them until they've all completed. */
+			scheduler1.spawn(K::increment_coroutine(ash_access_requester, 10));
+			scheduler1.spawn(K::increment_coroutine(ash_access_requester, 10));
+			scheduler1.run();
+			assert(27 == ash_access_requester.readlock_ptr()->b);
+
+			/* run_until_complete() runs the given task (and any other scheduled tasks) and returns its return value. */
+			auto task1 = K::sum_of_sums_coroutine(1, 2, 3);
+			int res1 = scheduler1.run_until_complete(task1);
+			assert(6 == res1);
+		}
+#endif /*MSE_HAS_COROUTINES*/
 #ifndef EXCLUDE_DUE_TO_MSVC2019_INTELLISENSE_BUGS1
 		{
 			/* Just demonstrating the existence of the "try" versions. */
@@ -276,6 +401,125 @@ void msetl_example3() {
 			auto writelock_ptr3 = access_requester.try_writelock_ptr_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
 		}
 #endif // !EXCLUDE_DUE_TO_MSVC2019_INTELLISENSE_BUGS1
+		{
+			/* By default, access requesters use a (recursive) mutex that supports "upgrade" locking and deadlock detection.
+			When those features aren't needed, a cheaper "access mutex" type can be specified. Note that with these
+			mutex types, a thread must not hold more than one lock pointer (to the same object) at a time. */
+			typedef mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableD, mse::spin_shared_mutex> spin_access_requester_t;
+			auto access_requester = spin_access_requester_t::make(0);
+
+			std::list<mse::mstd::future<int>> futures;
+			for (size_t i = 0; i < 3; i += 1) {
+				futures.emplace_back(mse::mstd::async([](spin_access_requester_t ar) {
+					for (int j = 0; j < 1000; j += 1) {
+						/* short critical section */
+						ar.writelock_ptr()->b += 1;
+					}
+					return 0;
+				}, access_requester));
+			}
+			for (auto& future : futures) {
+				future.get();
+			}
+			assert(3000 == access_requester.readlock_ptr()->b);
+
+			/* Read-only access requesters (and weak access requesters) take the same (optional) template parameter. */
+			mse::TAsyncSharedV2ReadOnlyAccessRequester<ShareableD, mse::spin_shared_mutex> ro_access_requester(access_requester);
+			int res1 = ro_access_requester.readlock_ptr()->b;
+
+			/* brlock_shared_mutex favors shared (read) locks, which don't contend with each other. */
+			auto br_access_requester = mse::TAsyncSharedV2ReadOnlyAccessRequester<ShareableD, mse::brlock_shared_mutex>::make(5);
+			int res2 = br_access_requester.readlock_ptr()->b;
+		}
+#ifdef MSE_ASYNC_LOCK_REQUESTS
+		{
+			/* async_writelock_ptr() and async_readlock_ptr() (available if MSE_ASYNC_LOCK_REQUESTS is defined) don't block. The lock request is queued, and the given function
+			is invoked (with a lock pointer) once the lock is obtained, possibly in another thread (whichever one releases
+			the lock the request was waiting on). A future for the function's return value is returned. Because the function
+			may be passed to another thread, as with mstd::thread, it must be of a (safely) passable type. */
+			typedef mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableD, mse::spin_shared_mutex> access_requester_t;
+			typedef mse::TAsyncSharedV2ReadOnlyAccessRequester<ShareableD, mse::spin_shared_mutex> ro_access_requester_t;
+			struct CB {
+				static int increment_b(access_requester_t::xscope_writelock_ptr_t& xs_writelock_ptr) {
+					xs_writelock_ptr->b += 1;
+					return xs_writelock_ptr->b;
+				}
+				static int read_b(ro_access_requester_t::xscope_readlock_ptr_t& xs_readlock_ptr) {
+					return xs_readlock_ptr->b;
+				}
+			};
+			auto access_requester = access_requester_t::make(0);
+			std::future<int> future1;
+			{
+				auto writelock_ptr = access_requester.writelock_ptr();
+				future1 = access_requester.async_writelock_ptr(CB::increment_b);
+				/* The request can't be granted while the write lock is held (even by the same thread). */
+				assert(std::future_status::ready != future1.wait_for(std::chrono::seconds(0)));
+			}
+			/* Releasing the write lock (above) resulted in the queued request being granted. */
+			assert(std::future_status::ready == future1.wait_for(std::chrono::seconds(0)));
+			int res1 = future1.get();
+
+			ro_access_requester_t ro_access_requester(access_requester);
+			auto future2 = ro_access_requester.async_readlock_ptr(CB::read_b);
+			int res2 = future2.get();
+		}
+#endif // MSE_ASYNC_LOCK_REQUESTS
+		{
+			/* xscope_lock_all() obtains lock pointers from multiple access requesters without risk of deadlock, regardless
+			of the order in which other threads request them. */
+			typedef decltype(mse::make_asyncsharedv2readwrite<ShareableD>(0)) account_ar_t;
+			auto account1_ar = mse::make_asyncsharedv2readwrite<ShareableD>(100);
+			auto account2_ar = mse::make_asyncsharedv2readwrite<ShareableD>(100);
+			auto rate_ar = mse::make_asyncsharedv2readonly<ShareableD>(2);
+
+			auto transfer = [](account_ar_t from_ar, account_ar_t to_ar, mse::TAsyncSharedV2ReadOnlyAccessRequester<ShareableD> rate_ar) {
+				for (int j = 0; j < 100; j += 1) {
+					auto xs_ptrs = mse::xscope_lock_all(mse::writelock_request(from_ar), mse::writelock_request(to_ar), mse::readlock_request(rate_ar));
+					std::get<0>(xs_ptrs)->b -= std::get<2>(xs_ptrs)->b;
+					std::get<1>(xs_ptrs)->b += std::get<2>(xs_ptrs)->b;
+				}
+				return 0;
+			};
+			/* These two tasks request the same locks in opposite orders. */
+			auto future1 = mse::mstd::async(transfer, account1_ar, account2_ar, rate_ar);
+			auto future2 = mse::mstd::async(transfer, account2_ar, account1_ar, rate_ar);
+			future1.get();
+			future2.get();
+
+			auto xs_ptrs = mse::xscope_lock_all(mse::readlock_request(account1_ar), mse::readlock_request(account2_ar));
+			assert(200 == std::get<0>(xs_ptrs)->b + std::get<1>(xs_ptrs)->b);
+		}
+		{
+			/* Lock statistics. If MSE_ASYNC_LOCK_STATS is defined, the locks on all TAsyncSharedV2 shared objects are
+			instrumented. Here we explicitly specify an instrumented access mutex, so that it's instrumented regardless. */
+			typedef mse::instrumented_mutex<mse::spin_shared_mutex> instrumented_mutex_t;
+			auto access_requester = mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableD, instrumented_mutex_t>::make(0);
+			/* The label identifies the shared object in the reported statistics. */
+			access_requester.set_lock_stats_label("msetl_example3 counter");
+
+			auto increment = [](mse::TAsyncSharedV2ReadWriteAccessRequester<ShareableD, instrumented_mutex_t> ar) {
+				for (int j = 0; j < 100; j += 1) {
+					ar.writelock_ptr()->b += 1;
+					int b = ar.readlock_ptr()->b;
+				}
+				return 0;
+			};
+			auto future1 = mse::mstd::async(increment, access_requester);
+			auto future2 = mse::mstd::async(increment, access_requester);
+			future1.get();
+			future2.get();
+
+			/* The statistics of all (existing) instrumented mutexes can be obtained as structured data, text or JSON. */
+			for (const auto& stats : mse::lock_stats_snapshots()) {
+				if ("msetl_example3 counter" == stats.label) {
+					assert(200 == stats.exclusive_lock_count);
+					assert(200 == stats.shared_lock_count);
+				}
+			}
+			auto stats_text = mse::lock_stats_text();
+			auto stats_json = mse::lock_stats_json();
+		}
 		{
 			/* TAsyncSharedV2WeakReadWriteAccessRequester<> is the weak counterpart to TAsyncSharedV2ReadWriteAccessRequester<>
 			analogous to how std::weak_ptr<> is the weak counterpart to std::shared_ptr<>. */
@@ -316,6 +560,37 @@ void msetl_example3() {
 
 			auto A_b_safe_cptr = mse::make_const_pointer_to_member_v2(A_immptr, &A::b);
 		}
+		{
+			/* For scenarios where the shared object is read frequently but modified only occasionally, the RCU access
+			requester provides (wait-free) read pointers to immutable "snapshots" of the object. Writers modify a copy of
+			the current snapshot, which is then published as the new current snapshot. */
+			typedef mse::rsv::TAsyncShareableAndPassableObj<mse::nii_vector<int> > ShareableRouteTable;
+			auto rcu_access_requester = mse::make_asyncsharedv2rcu<ShareableRouteTable>(mse::nii_vector<int>{ 1, 2, 3 });
+
+			std::list<mse::mstd::future<int>> futures;
+			for (size_t i = 0; i < 3; i += 1) {
+				futures.emplace_back(mse::mstd::async([](mse::TAsyncSharedV2RCUAccessRequester<ShareableRouteTable> ar) {
+					int sum = 0;
+					for (int j = 0; j < 1000; j += 1) {
+						/* The snapshot a read pointer references is not affected by subsequent updates. The scope read
+						pointer borrows the requester's state, so obtaining one doesn't touch any shared reference count. */
+						auto readlock_ptr = ar.xscope_readlock_ptr();
+						sum += readlock_ptr->at(readlock_ptr->size() - 1);
+					}
+					return sum;
+				}, rcu_access_requester));
+			}
+			rcu_access_requester.update([](ShareableRouteTable& route_table) { route_table.push_back(4); });
+			for (auto& future : futures) {
+				int res1 = future.get();
+			}
+			assert(4 == rcu_access_requester.readlock_ptr()->size());
+
+			/* The current snapshot can also be replaced with a newly constructed object. */
+			rcu_access_requester.replace(mse::nii_vector<int>{ 5, 6 });
+			auto xs_readlock_ptr = rcu_access_requester.xscope_readlock_ptr();
+			assert(2 == xs_readlock_ptr->size());
+		}
 		{
 			/* For scenarios where the shared object is atomic, you can get away without using locks
 			or access requesters. */
@@ -331,6 +606,43 @@ void msetl_example3() {
 				int res2 = (*it).get();
 			}
 		}
+		{
+			/* For small, trivially copyable objects that are too large to be (lock-free) atomic, a seqlock<> allows
+			concurrent reads without locking. (Reads that overlap a write are retried.) */
+			struct CQuote {
+				double m_bid = 0.0;
+				double m_ask = 0.0;
+				long long m_timestamp = 0;
+				int m_sizes[10] = { 0 };
+			};
+			typedef mse::rsv::TAsyncShareableAndPassableObj<CQuote> ShareableQuote;
+			auto quote_seqlock_ptr = mse::make_asyncsharedv2seqlock<ShareableQuote>();
+
+			std::list<mse::mstd::future<double>> futures;
+			for (size_t i = 0; i < 3; i += 1) {
+				futures.emplace_back(mse::mstd::async([](mse::TAsyncSharedV2SeqLockFixedPointer<ShareableQuote> seqlock_ptr) {
+					double spread = 0.0;
+					for (int j = 0; j < 100; j += 1) {
+						/* load() returns a (consistent) copy of the value. */
+						ShareableQuote quote = seqlock_ptr->load();
+						assert(quote.m_ask >= quote.m_bid);
+						spread = quote.m_ask - quote.m_bid;
+					}
+					return spread;
+				}, quote_seqlock_ptr));
+			}
+			for (int j = 1; j <= 100; j += 1) {
+				quote_seqlock_ptr->update([j](ShareableQuote& quote) { quote.m_bid = j; quote.m_ask = j + 0.5; quote.m_timestamp += 1; });
+			}
+			for (auto& future : futures) {
+				double res1 = future.get();
+			}
+			assert(100 == quote_seqlock_ptr->load().m_timestamp);
+
+			ShareableQuote quote2 = quote_seqlock_ptr->load();
+			quote2.m_sizes[0] = 10;
+			quote_seqlock_ptr->store(quote2);
+		}
 		{
 			/* mse::TAsyncSharedV2ReadWriteAccessRequester's flexibilty in allowing coexisting read and write lock
 			pointers in the same thread introduces new ways to produce logical deadlocks. This block (likely)
@@ -501,6 +813,59 @@ void msetl_example3() {
 			}
 			std::cout << std::endl;
 		}
+		{
+			/* xscope_thread_pool is the scope version of thread_pool. Tasks can be submitted to it via an
+			xscope_future_carrier. */
+			mse::TXScopeObj<mse::TXScopeAccessControlledObj<ShareableA> > a_xscpacobj(7);
+			auto xscope_access_requester = mse::make_xscope_asyncsharedv2acoreadwrite(&a_xscpacobj);
+
+			mse::xscope_thread_pool xscope_pool1(2);
+			mse::xscope_future_carrier<int> xscope_futures;
+			std::list<mse::xscope_future_carrier<int>::handle_t> future_handles;
+			for (size_t i = 0; i < 10; i += 1) {
+				future_handles.emplace_back(xscope_futures.new_future(xscope_pool1, [](decltype(xscope_access_requester) ar) {
+					auto writelock_ptr = ar.writelock_ptr();
+					writelock_ptr->b += 1;
+					return writelock_ptr->b;
+				}, xscope_access_requester));
+			}
+			for (const auto& handle : future_handles) {
+				xscope_futures.xscope_ptr_at(handle)->get();
+			}
+			assert(17 == xscope_access_requester.readlock_ptr()->b);
+		}
+		{
+			/* Rather than (a thread) waiting on a future, a continuation can be attached to it. The continuation is
+			called with the future's value once it's ready. when_all() and when_any() provide futures that become
+			ready once all, or any, of a set of futures are ready. */
+			mse::TXScopeObj<mse::TXScopeAccessControlledObj<ShareableA> > a_xscpacobj(7);
+			auto xscope_access_requester = mse::make_xscope_asyncsharedv2acoreadwrite(&a_xscpacobj);
+
+			mse::xscope_thread_pool xscope_pool1(2);
+			mse::xscope_future_carrier<int> xscope_futures;
+			std::vector<mse::xscope_future_carrier<int>::handle_t> future_handles;
+			for (size_t i = 0; i < 3; i += 1) {
+				future_handles.push_back(xscope_futures.new_future(xscope_pool1, [](decltype(xscope_access_requester) ar) {
+					auto writelock_ptr = ar.writelock_ptr();
+					writelock_ptr->b += 1;
+					return writelock_ptr->b;
+				}, xscope_access_requester));
+			}
+
+			/* The when_any() future yields the handle of the first future to become ready. */
+			auto&& any_ready_future = xscope_futures.when_any(future_handles);
+			auto first_handle = any_ready_future.get();
+			assert(8 <= xscope_futures.xscope_ptr_at(first_handle)->get());
+
+			/* The when_all() future doesn't consume the futures; their values are still obtained from them. */
+			auto&& all_ready_future = xscope_futures.when_all(future_handles);
+			all_ready_future.wait();
+			assert(10 == xscope_access_requester.readlock_ptr()->b);
+
+			/* The continuation consumes the given future (and its handle). */
+			auto doubled_handle = xscope_futures.new_future_then(future_handles.back(), K::doubled);
+			assert(16 <= xscope_futures.xscope_ptr_at(doubled_handle)->get());
+		}
 
 		{
 			mse::TXScopeObj<mse::TXScopeAccessControlledObj<ShareableA> > a_xscpacobj1(3);
@@ -663,6 +1028,26 @@ void msetl_example3() {
 			int res2 = (*xscope_D_atomic_ptr).load().b;
 		}
 
+		{
+			/* Atomic objects that are concurrently modified by different threads should generally not share a cache line
+			(i.e. suffer "false sharing"). TXScopeCacheLineAlignedAtomicObj<> is a version of TXScopeAtomicObj<> aligned to
+			the cache line size. And an atomic counter that is incremented by several threads at once is itself a point of
+			contention. TXScopeShardedAtomicCounter<> spreads the increments over per-thread "stripes", and load() returns
+			their sum. */
+			mse::TXScopeShardedAtomicCounter<long long> xscope_event_counter;
+			mse::TXScopeCacheLineAlignedAtomicObj<long long> xscope_worker1_counter(0);
+			mse::TXScopeCacheLineAlignedAtomicObj<long long> xscope_worker2_counter(0);
+
+			{
+				mse::xscope_thread xscp_thread1(B::foo5, &xscope_event_counter, &xscope_worker1_counter);
+				mse::xscope_thread xscp_thread2(B::foo5, &xscope_event_counter, &xscope_worker2_counter);
+			}
+
+			long long total_events = xscope_event_counter.load();
+			assert(2000 == total_events);
+			assert(1000 == xscope_worker1_counter.load());
+		}
+
 #ifndef EXCLUDE_DUE_TO_MSVC2019_INTELLISENSE_BUGS1
 		{
 			/* This block is similar to a previous one that demonstrates safely allowing different threads to (simultaneously)
@@ -767,6 +1152,46 @@ void msetl_example3() {
 				}
 			}
 
+			{
+				/* Rather than a list of section sizes, you can specify the number of (roughly equal sized) sections you want.
+				The section boundaries will be adjusted to coincide with cache line boundaries (where possible), so that
+				threads modifying adjacent sections won't be contending for the same cache lines. */
+				mse::TXScopeAsyncACORASectionSplitter<async_shareable_vector1_t> xscope_ra_section_split1(&xscope_acobj, mse::equal_ra_sections(num_sections));
+				assert(num_sections == xscope_ra_section_split1.ra_section_count());
+				auto ar0 = xscope_ra_section_split1.ra_section_access_requester(0);
+
+				const auto my_append_function = K::append_exclamation_mark<decltype(ar0.writelock_ra_section())>;
+				const auto my_append_proxy_function = K::invoke_with_writelock_ra_section1<decltype(ar0), decltype(my_append_function)>;
+
+				mse::xscope_thread_carrier xscope_threads;
+				for (size_t i = 0; i < xscope_ra_section_split1.ra_section_count(); i += 1) {
+					xscope_threads.new_thread(my_append_proxy_function, xscope_ra_section_split1.ra_section_access_requester(i), my_append_function);
+				}
+			}
+
+			std::cout << "mse::xscope_parallel_for(): " << std::endl;
+
+			{
+				/* Rather than using a (scope) thread for each section, xscope_parallel_for() splits the vector into sections of
+				(at most) the given "grain" size and distributes them among the threads of a (work-stealing) thread pool. So one
+				slow section doesn't hold up the processing of the remaining ones. The calling thread blocks (and participates)
+				until all the sections have been processed. */
+				typedef mse::TXScopeAsyncACORASectionSplitter<async_shareable_vector1_t>::xscope_ras_ar_t xscope_ras_ar_t;
+				const auto my_append_function = K::append_exclamation_mark<xscope_ras_ar_t::xscope_rw_ra_section_t>;
+				mse::xscope_parallel_for(&xscope_acobj, 4/*grain*/, my_append_function);
+
+				/* xscope_parallel_reduce() applies the given function to (read-only versions of) the sections, and combines
+				the results (in order) using the other given function. */
+				const auto my_length_function = K::total_string_length<xscope_ras_ar_t::xscope_rwc_ra_section_t>;
+				const auto total_length = mse::xscope_parallel_reduce(&xscope_acobj, 4/*grain*/, size_t(0), my_length_function, K::sum_of_sizes);
+
+				/* Existing splitters can be used as well. */
+				mse::TXScopeAsyncACORASectionSplitter<async_shareable_vector1_t> xscope_ra_section_split1(&xscope_acobj, std::array<size_t, 2>{ { 10, 20 } });
+				mse::xscope_parallel_for(xscope_ra_section_split1, my_append_function);
+				const auto total_length2 = mse::xscope_parallel_reduce(xscope_ra_section_split1, size_t(0), my_length_function, K::sum_of_sizes);
+				assert(total_length2 == total_length + num_elements);
+			}
+
 			/* Now that we're done sharing the (controlled access) vector, we can swap it back to our original vector. */
 			std::swap(vector1, *(xscope_acobj.xscope_pointer()));
 			auto first_element_value = vector1[0];
@@ -71,6 +71,11 @@ them to be enabled. */
 #endif /*(1910 > _MSC_VER)*/
 #endif /*_MSC_VER*/
 
+/* The following enables the asynchronous (non-blocking) lock requests of the TAsyncSharedV2 access requesters (i.e.
+async_writelock_ptr() and async_readlock_ptr()). Supporting them adds a small cost to every lock pointer, so they are
+not available by default. */
+#define MSE_ASYNC_LOCK_REQUESTS
+
 #define MSE_SELF_TESTS
 
 #endif /*ndef MSETL_EXAMPLE_DEFS_H*/